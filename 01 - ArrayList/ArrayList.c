@@ -30,145 +30,1348 @@
 /// @brief Library implementation of the ArrayList.
 
 // Standard C includes
+#include <limits.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "ArrayList.h"
+#include "ArrayListFile.h"
+#include "ArrayListSimd.h"
 
-/// @def MIN_ARRAY_SIZE
+/// @def DEFAULT_GROWTH_FACTOR
 ///
-/// @brief Minimum size we allow the array of the ArrayList to be
-#define MIN_ARRAY_SIZE 4
+/// @brief Growth factor used by an array-backed list until a policy is set.
+#define DEFAULT_GROWTH_FACTOR 2.0
+
+/// @def DEFAULT_SHRINK_BELOW
+///
+/// @brief Usage below which an array-backed list shrinks its array until a
+/// policy is set.
+#define DEFAULT_SHRINK_BELOW 0.25
+
+/// @fn static int arrayListResize(ArrayList *arrayList, size_t newArraySize)
+///
+/// @brief Change the size of the array of an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to resize.
+/// @param newArraySize The number of elements the array should be able to hold.
+///
+/// @note On failure the ArrayList is left exactly as it was.  File-backed
+/// arrays are resized by ArrayListFile.c instead of the list's allocator.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int arrayListResize(ArrayList *arrayList, size_t newArraySize) {
+    if (newArraySize > (SIZE_MAX / sizeof(int))) {
+        // Can't be allocated
+        return -1;
+    } else if (arrayList->fileMapping != NULL) {
+        return alFileResize(arrayList, newArraySize);
+    }
+
+    uintptr_t oldAddress = (uintptr_t) arrayList->array;
+    void *check = alArrayResize(&arrayList->allocator, arrayList->array,
+        sizeof(int), arrayList->arraySize, newArraySize);
+    if (check == NULL) {
+        // Out of memory.
+        return -1;
+    }
+
+    // realloc only copies the old array when it can't resize it in place, and
+    // then only as much of it as fits in the new one
+    size_t copied = (arrayList->arraySize < newArraySize)
+        ? arrayList->arraySize : newArraySize;
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_REALLOCS, 1);
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_BYTES_COPIED,
+        ((uintptr_t) check != oldAddress) ? copied * sizeof(int) : 0);
+
+    arrayList->array = (int*) check;
+    arrayList->arraySize = newArraySize;
+
+    return 0;
+}
+
+/// @fn static int arrayListGrow(ArrayList *arrayList, size_t minArraySize)
+///
+/// @brief Grow the array of an ArrayList, following its growth policy, so that
+/// it can hold at least minArraySize elements.
+///
+/// @param arrayList A pointer to the ArrayList to grow.
+/// @param minArraySize The number of elements the array must be able to hold.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int arrayListGrow(ArrayList *arrayList, size_t minArraySize) {
+    if (minArraySize <= arrayList->arraySize) {
+        // Already big enough
+        return 0;
+    }
+
+    size_t newArraySize = alGrowthPolicyNextSize(&arrayList->growthPolicy,
+        arrayList->arraySize, minArraySize, SIZE_MAX / sizeof(int));
+    if (newArraySize == 0) {
+        // Too big
+        return -1;
+    }
+
+    return arrayListResize(arrayList, newArraySize);
+}
+
+/// @fn static void arrayListShrink(ArrayList *arrayList)
+///
+/// @brief Give back part of the array of an ArrayList if removals have left
+/// too little of it in use, following its growth policy.
+///
+/// @param arrayList A pointer to the ArrayList to shrink.
+///
+/// @note File-backed arrays are left alone.  Shrinking a read-only mapping
+/// would copy it onto the heap.  arrayListShrinkToFit still works on them.
+static void arrayListShrink(ArrayList *arrayList) {
+    if (arrayList->fileMapping != NULL) {
+        return;
+    }
+
+    size_t newArraySize = alGrowthPolicyShrinkSize(&arrayList->growthPolicy,
+        arrayList->arraySize, arrayList->listSize, arrayList->reservedSize);
+    if (newArraySize != 0) {
+        // Keeping the bigger array is fine if this fails
+        arrayListResize(arrayList, newArraySize);
+    }
+}
+
+/// @fn static int compareInts(const void *a, const void *b)
+///
+/// @brief qsort comparison function for ints.
+///
+/// @return Returns a negative value, 0 or a positive value if the int at a is
+/// less than, equal to or greater than the int at b.
+static int compareInts(const void *a, const void *b) {
+    int left = *((const int*) a);
+    int right = *((const int*) b);
+
+    // Don't subtract, that can overflow
+    return (left > right) - (left < right);
+}
+
+/// @fn static size_t sortedRank(const int *array, size_t count, int value,
+///   int inclusive)
+///
+/// @brief Binary search a sorted array for the position of a value.
+///
+/// @param array A pointer to the sorted array.
+/// @param count The number of elements in the array.
+/// @param value The value to search for.
+/// @param inclusive If nonzero, count the elements equal to value too.
+///
+/// @return Returns the number of elements less than value, or less than or
+/// equal to value if inclusive is set.
+static size_t sortedRank(const int *array, size_t count, int value,
+    int inclusive
+) {
+    const int *base = array;
+    size_t remaining = count;
+
+    // Halve the range every time without branching on the comparison so
+    // the loop runs the same way no matter where the value is.
+    while (remaining > 1) {
+        size_t half = remaining / 2;
+        size_t goRight = inclusive
+            ? (base[half - 1] <= value) : (base[half - 1] < value);
+        base += goRight * half;
+        remaining -= half;
+    }
+    if (remaining == 1) {
+        base += inclusive ? (base[0] <= value) : (base[0] < value);
+    }
+
+    return (size_t) (base - array);
+}
+
+// Eytzinger helpers.  Node k (counting from 1) of the implicit tree is stored
+// at array[k - 1] and its children are nodes 2k and 2k + 1.
+
+/// @fn static size_t eytzingerFill(int *tree, const int *sorted, size_t next,
+///   size_t node, size_t count)
+///
+/// @brief Copy sorted values into an Eytzinger tree with an in-order walk.
+///
+/// @return Returns the index of the next sorted value to place.
+static size_t eytzingerFill(int *tree, const int *sorted, size_t next,
+    size_t node, size_t count
+) {
+    if (node <= count) {
+        next = eytzingerFill(tree, sorted, next, 2 * node, count);
+        tree[node - 1] = sorted[next++];
+        next = eytzingerFill(tree, sorted, next, 2 * node + 1, count);
+    }
+
+    return next;
+}
+
+/// @fn static size_t eytzingerDrain(int *sorted, const int *tree, size_t next,
+///   size_t node, size_t count)
+///
+/// @brief Copy the values of an Eytzinger tree back into sorted order with an
+/// in-order walk.
+///
+/// @return Returns the index of the next sorted slot to fill.
+static size_t eytzingerDrain(int *sorted, const int *tree, size_t next,
+    size_t node, size_t count
+) {
+    if (node <= count) {
+        next = eytzingerDrain(sorted, tree, next, 2 * node, count);
+        sorted[next++] = tree[node - 1];
+        next = eytzingerDrain(sorted, tree, next, 2 * node + 1, count);
+    }
+
+    return next;
+}
+
+/// @fn static size_t eytzingerLowerBound(const int *tree, size_t count,
+///   int value)
+///
+/// @brief Find the node holding the smallest value not less than value.
+///
+/// @return Returns the node number (counting from 1) of the lower bound, or 0
+/// if every value in the tree is less than value.
+static size_t eytzingerLowerBound(const int *tree, size_t count, int value) {
+    size_t node = 1;
+    while (node <= count) {
+        node = 2 * node + (tree[node - 1] < value);
+    }
+
+    // Every right turn after the last left turn appended a 1 bit.  Strip
+    // those and the left turn itself to get back to the node we want.
+    while ((node & 1) != 0) {
+        node >>= 1;
+    }
+    node >>= 1;
+
+    return node;
+}
+
+/// @fn static size_t eytzingerRank(const int *tree, size_t count, int value,
+///   int inclusive)
+///
+/// @brief Find the sorted position of a value in an Eytzinger tree.
+///
+/// @param tree A pointer to the Eytzinger-ordered array.
+/// @param count The number of elements in the array.
+/// @param value The value to search for.
+/// @param inclusive If nonzero, count the elements equal to value too.
+///
+/// @return Returns the number of elements less than value, or less than or
+/// equal to value if inclusive is set.
+static size_t eytzingerRank(const int *tree, size_t count, int value,
+    int inclusive
+) {
+    int height = 0;
+    for (size_t remaining = count; remaining > 0; remaining >>= 1) {
+        height++;
+    }
+
+    size_t rank = 0;
+    size_t node = 1;
+    for (int depth = 0; node <= count; depth++) {
+        size_t goRight = inclusive
+            ? (tree[node - 1] <= value) : (tree[node - 1] < value);
+
+        // Going right passes this node and everything in its left subtree.
+        // Every level of that subtree is full except possibly the last one.
+        size_t leftSize = 0;
+        int levelsBelow = height - depth - 1;
+        if (levelsBelow > 0) {
+            size_t lastWidth = (size_t) 1 << (levelsBelow - 1);
+            size_t lastFirst = (2 * node) << (levelsBelow - 1);
+            size_t lastCount = (count >= lastFirst) ? count - lastFirst + 1 : 0;
+            if (lastCount > lastWidth) {
+                lastCount = lastWidth;
+            }
+            leftSize = (lastWidth - 1) + lastCount;
+        }
+
+        rank += goRight * (leftSize + 1);
+        node = 2 * node + goRight;
+    }
+
+    return rank;
+}
+
+/// @fn static size_t arrayListRank(const ArrayList *arrayList, int value,
+///   int inclusive)
+///
+/// @brief Find the sorted position of a value in a sorted or frozen ArrayList.
+///
+/// @return Returns the number of elements less than value, or less than or
+/// equal to value if inclusive is set.
+static size_t arrayListRank(const ArrayList *arrayList, int value,
+    int inclusive
+) {
+    size_t listSize = arrayList->listSize;
+    if (arrayList->layout == AL_LAYOUT_EYTZINGER) {
+        return eytzingerRank(arrayList->array, listSize, value, inclusive);
+    }
+
+    return sortedRank(arrayList->array, listSize, value, inclusive);
+}
 
 /// @fn ArrayList* arrayListCreate(void)
 ///
-/// @brief Allocate and initialize an ArrayList.
+/// @brief Allocate and initialize an ArrayList.
+///
+/// @return Returns a pointer to a allocated and initialized ArrayList on
+/// success, NULL on failure.
+ArrayList* arrayListCreate(void) {
+    return arrayListCreateWithAllocator(NULL);
+}
+
+/// @fn ArrayList* arrayListCreateWithAllocator(const Allocator *allocator)
+///
+/// @brief Allocate and initialize an ArrayList that gets all of its memory
+/// from a given allocator.
+///
+/// @param allocator The allocator to use, or NULL for malloc and free.  It is
+///   copied, so only its context has to outlive the ArrayList.
+///
+/// @return Returns a pointer to a allocated and initialized ArrayList on
+/// success, NULL on failure.
+ArrayList* arrayListCreateWithAllocator(const Allocator *allocator) {
+    Allocator listAllocator
+        = (allocator != NULL) ? *allocator : allocatorLibc();
+
+    ArrayList *arrayList
+        = (ArrayList*) allocatorAlloc(&listAllocator, sizeof(ArrayList));
+    if (arrayList == NULL) {
+        return NULL;
+    }
+
+    arrayList->array = (int*) allocatorAlloc(&listAllocator,
+        AL_MIN_ARRAY_SIZE * sizeof(int));
+    if (arrayList->array == NULL) {
+        allocatorFree(&listAllocator, arrayList, sizeof(ArrayList));
+        arrayList = NULL;
+        return NULL;
+    }
+
+    arrayList->arraySize = AL_MIN_ARRAY_SIZE;
+    arrayList->listSize = 0;
+    arrayList->reservedSize = 0;
+    alGrowthPolicyInit(&arrayList->growthPolicy);
+    arrayList->layout = AL_LAYOUT_UNSORTED;
+    arrayList->fileMapping = NULL;
+    arrayList->allocator = listAllocator;
+    arrayList->stats = listStatsRegister("ArrayList", arrayList);
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_MALLOCS, 2);
+
+    return arrayList;
+}
+
+/// @fn ArrayList* arrayListDestroy(ArrayList *arrayList)
+///
+/// @brief Release all the memory held by an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to destroy.
+///
+/// @note A file-backed ArrayList is synced to its file and unmapped.
+///
+/// @return This function always succeeds and always returns NULL.
+ArrayList* arrayListDestroy(ArrayList *arrayList) {
+    if (arrayList != NULL) {
+        if (arrayList->fileMapping != NULL) {
+            alFileUnmap(arrayList);
+        } else {
+            allocatorFree(&arrayList->allocator, arrayList->array,
+                arrayList->arraySize * sizeof(int));
+        }
+        arrayList->array = NULL;
+        arrayList->stats = listStatsUnregister(arrayList->stats);
+
+        // The allocator is about to be freed along with the ArrayList
+        Allocator allocator = arrayList->allocator;
+        allocatorFree(&allocator, arrayList, sizeof(ArrayList));
+        arrayList = NULL;
+    }
+
+    return NULL;
+}
+
+/// @fn int arrayListInsert(ArrayList *arrayList, int value)
+///
+/// @brief Insert a new value at the end of an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to append the value to.
+/// @param value The value to append.
+///
+/// @note The array is grown before the value is written, so if growing fails
+/// the ArrayList is unchanged and the insert can be retried later.
+///
+/// @note Appending a value smaller than the last one to a sorted ArrayList
+/// makes it unsorted.  A frozen ArrayList cannot be inserted into.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListInsert(ArrayList *arrayList, int value) {
+    if ((arrayList == NULL) || (arrayList->layout == AL_LAYOUT_EYTZINGER)) {
+        return -1;
+    }
+
+    LIST_STATS_TIMER(start);
+
+    if (arrayList->listSize == arrayList->arraySize) {
+        if (arrayListGrow(arrayList, arrayList->listSize + 1) != 0) {
+            // Out of memory.
+            return -1;
+        }
+    }
+
+    if ((arrayList->layout == AL_LAYOUT_SORTED) && (arrayList->listSize > 0)
+        && (value < arrayList->array[arrayList->listSize - 1])
+    ) {
+        arrayList->layout = AL_LAYOUT_UNSORTED;
+    }
+
+    arrayList->array[arrayList->listSize] = value;
+    arrayList->listSize++;
+    LIST_STATS_LATENCY(arrayList->stats, LIST_STATS_OP_INSERT, start);
+
+    return 0;
+}
+
+/// @fn int arrayListInsertMany(ArrayList *arrayList, const int *values,
+///   size_t count)
+///
+/// @brief Insert a span of values at the end of an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to append the values to.
+/// @param values A pointer to the first of the values to append.
+/// @param count The number of values to append.
+///
+/// @note The array is grown at most once and the values are copied with a
+/// single memcpy.  On failure the ArrayList is unchanged.
+///
+/// @note As with arrayListInsert, a sorted ArrayList stays sorted only if the
+/// appended values keep it in order.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListInsertMany(ArrayList *arrayList, const int *values, size_t count) {
+    if ((arrayList == NULL) || ((values == NULL) && (count > 0))) {
+        return -1;
+    } else if (arrayList->layout == AL_LAYOUT_EYTZINGER) {
+        return -1;
+    } else if (count == 0) {
+        // Nothing to do
+        return 0;
+    }
+
+    size_t listSize = arrayList->listSize;
+    if (count > SIZE_MAX - listSize) {
+        // listSize can't represent this
+        return -1;
+    }
+
+    if (arrayListGrow(arrayList, listSize + count) != 0) {
+        return -1;
+    }
+
+    if (arrayList->layout == AL_LAYOUT_SORTED) {
+        int previous = (listSize > 0) ? arrayList->array[listSize - 1] : INT_MIN;
+        for (size_t ii = 0; ii < count; ii++) {
+            if (values[ii] < previous) {
+                arrayList->layout = AL_LAYOUT_UNSORTED;
+                break;
+            }
+            previous = values[ii];
+        }
+    }
+
+    memcpy(&arrayList->array[listSize], values, count * sizeof(int));
+    arrayList->listSize += count;
+
+    return 0;
+}
+
+/// @fn int arrayListReserve(ArrayList *arrayList, size_t capacity)
+///
+/// @brief Make sure the array of an ArrayList can hold at least capacity
+/// elements without growing again.
+///
+/// @param arrayList A pointer to the ArrayList to reserve space in.
+/// @param capacity The number of elements the array must be able to hold.
+///
+/// @note The array is grown to exactly capacity elements, regardless of the
+/// growth policy.  It is never shrunk here, and removals won't shrink it below
+/// capacity either until the next call to arrayListReserve or
+/// arrayListShrinkToFit.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListReserve(ArrayList *arrayList, size_t capacity) {
+    if (arrayList == NULL) {
+        return -1;
+    } else if (capacity <= arrayList->arraySize) {
+        // Already big enough
+        arrayList->reservedSize = capacity;
+        return 0;
+    }
+
+    if (arrayListResize(arrayList, capacity) != 0) {
+        return -1;
+    }
+    arrayList->reservedSize = capacity;
+
+    return 0;
+}
+
+/// @fn int arrayListShrinkToFit(ArrayList *arrayList)
+///
+/// @brief Shrink the array of an ArrayList to just hold its elements.
+///
+/// @param arrayList A pointer to the ArrayList to shrink.
+///
+/// @note The array never gets smaller than AL_MIN_ARRAY_SIZE elements.  Any
+/// capacity reserved with arrayListReserve is given up.  A file-backed list
+/// shrinks its file as well.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListShrinkToFit(ArrayList *arrayList) {
+    if (arrayList == NULL) {
+        return -1;
+    }
+    arrayList->reservedSize = 0;
+
+    size_t newArraySize = (arrayList->listSize > AL_MIN_ARRAY_SIZE)
+        ? arrayList->listSize : AL_MIN_ARRAY_SIZE;
+    if (newArraySize >= arrayList->arraySize) {
+        // Already as small as it gets
+        return 0;
+    }
+
+    return arrayListResize(arrayList, newArraySize);
+}
+
+/// @fn int arrayListSetGrowthPolicy(ArrayList *arrayList,
+///   const ALGrowthPolicy *growthPolicy)
+///
+/// @brief Set the policy used to grow the array of an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to set the policy of.
+/// @param growthPolicy A pointer to the policy to copy into the ArrayList.
+///
+/// @return Returns 0 on success, -1 if the policy is not valid.
+int arrayListSetGrowthPolicy(ArrayList *arrayList,
+    const ALGrowthPolicy *growthPolicy
+) {
+    if ((arrayList == NULL) || (alGrowthPolicyValidate(growthPolicy) != 0)) {
+        return -1;
+    }
+
+    arrayList->growthPolicy = *growthPolicy;
+
+    return 0;
+}
+
+/// @fn ALGrowthPolicy* alGrowthPolicyInit(ALGrowthPolicy *growthPolicy)
+///
+/// @brief Set a growth policy to the one every array-backed list starts with.
+///
+/// @param growthPolicy A pointer to the policy to set.
+///
+/// @return Returns the policy.
+ALGrowthPolicy* alGrowthPolicyInit(ALGrowthPolicy *growthPolicy) {
+    if (growthPolicy != NULL) {
+        growthPolicy->factor = DEFAULT_GROWTH_FACTOR;
+        growthPolicy->maxGrowth = 0;
+        growthPolicy->exactFit = 0;
+        growthPolicy->shrinkBelow = DEFAULT_SHRINK_BELOW;
+    }
+
+    return growthPolicy;
+}
+
+/// @fn size_t alGrowthPolicyNextSize(const ALGrowthPolicy *growthPolicy,
+///   size_t arraySize, size_t minArraySize, size_t maxArraySize)
+///
+/// @brief Work out how many elements an array should grow to hold under a
+/// growth policy.
+///
+/// @param growthPolicy A pointer to the policy to follow.
+/// @param arraySize The number of elements the array can hold now.
+/// @param minArraySize The number of elements the array must be able to hold.
+/// @param maxArraySize The most elements the array could ever hold, usually
+///   SIZE_MAX divided by the element size.
+///
+/// @note Shared by every array-backed list so that they all grow the same way.
+///
+/// @return Returns the new number of elements, which is at least minArraySize,
+/// or 0 if minArraySize is more than maxArraySize.
+size_t alGrowthPolicyNextSize(const ALGrowthPolicy *growthPolicy,
+    size_t arraySize, size_t minArraySize, size_t maxArraySize
+) {
+    if ((growthPolicy == NULL) || (minArraySize > maxArraySize)) {
+        return 0;
+    } else if (growthPolicy->exactFit != 0) {
+        return minArraySize;
+    }
+
+    double grown = (double) arraySize * growthPolicy->factor;
+    size_t newArraySize
+        = (grown < (double) maxArraySize) ? (size_t) grown : maxArraySize;
+
+    if ((growthPolicy->maxGrowth > 0) && (newArraySize > arraySize)
+        && (newArraySize - arraySize > growthPolicy->maxGrowth)
+    ) {
+        newArraySize = arraySize + growthPolicy->maxGrowth;
+    }
+
+    if (newArraySize < AL_MIN_ARRAY_SIZE) {
+        newArraySize = AL_MIN_ARRAY_SIZE;
+    }
+    if (newArraySize < minArraySize) {
+        newArraySize = minArraySize;
+    }
+
+    return newArraySize;
+}
+
+/// @fn size_t alGrowthPolicyShrinkSize(const ALGrowthPolicy *growthPolicy,
+///   size_t arraySize, size_t listSize, size_t minArraySize)
+///
+/// @brief Work out whether, and to what, an array should shrink after a
+/// removal under a growth policy.
+///
+/// @param growthPolicy A pointer to the policy to follow.
+/// @param arraySize The number of elements the array can hold now.
+/// @param listSize The number of elements in the array now.
+/// @param minArraySize The fewest elements the array may shrink to, usually
+///   the capacity reserved by the caller, or 0 for no floor.
+///
+/// @note Shared by every array-backed list, like alGrowthPolicyNextSize.  The
+/// array shrinks to twice listSize, so it takes as many removals again to
+/// shrink it next time as it takes inserts to grow it.  That keeps a list
+/// sitting near the threshold from reallocating on every operation.
+///
+/// @return Returns the new number of elements, or 0 if the array should stay
+/// as it is.
+size_t alGrowthPolicyShrinkSize(const ALGrowthPolicy *growthPolicy,
+    size_t arraySize, size_t listSize, size_t minArraySize
+) {
+    if ((growthPolicy == NULL) || !(growthPolicy->shrinkBelow > 0.0)
+        || (arraySize <= AL_MIN_ARRAY_SIZE)
+        || ((double) listSize >= (double) arraySize * growthPolicy->shrinkBelow)
+    ) {
+        return 0;
+    }
+
+    size_t newArraySize = listSize * 2;
+    if (newArraySize < AL_MIN_ARRAY_SIZE) {
+        newArraySize = AL_MIN_ARRAY_SIZE;
+    }
+    if (newArraySize < minArraySize) {
+        newArraySize = minArraySize;
+    }
+
+    return (newArraySize < arraySize) ? newArraySize : 0;
+}
+
+/// @fn int alGrowthPolicyValidate(const ALGrowthPolicy *growthPolicy)
+///
+/// @brief Check that a growth policy can be followed.
+///
+/// @param growthPolicy A pointer to the policy to check.
+///
+/// @return Returns 0 if the policy is valid, -1 if not.
+int alGrowthPolicyValidate(const ALGrowthPolicy *growthPolicy) {
+    if (growthPolicy == NULL) {
+        return -1;
+    } else if ((growthPolicy->exactFit == 0) && !(growthPolicy->factor > 1.0)) {
+        // A factor this small would never grow the array
+        return -1;
+    } else if (!(growthPolicy->shrinkBelow >= 0.0)
+        || !(growthPolicy->shrinkBelow < 0.5)
+    ) {
+        // A list shrunk to half full would be shrunk again straight away
+        return -1;
+    }
+
+    return 0;
+}
+
+/// @fn void* alArrayResize(const Allocator *allocator, void *array,
+///   size_t elementSize, size_t arraySize, size_t newArraySize)
+///
+/// @brief Reallocate the array of an array-backed list.
+///
+/// @param allocator The allocator the array came from.
+/// @param array A pointer to the array.
+/// @param elementSize The number of bytes in each element.
+/// @param arraySize The number of elements the array can hold now.
+/// @param newArraySize The number of elements the array should be able to
+///   hold.
+///
+/// @note Shared by every array-backed list, like alGrowthPolicyNextSize.  On
+/// failure the old array is left as it was.
+///
+/// @return Returns a pointer to the resized array on success, NULL on failure.
+void* alArrayResize(const Allocator *allocator, void *array,
+    size_t elementSize, size_t arraySize, size_t newArraySize
+) {
+    if ((elementSize == 0) || (newArraySize > (SIZE_MAX / elementSize))) {
+        // Can't be allocated
+        return NULL;
+    }
+
+    return allocatorRealloc(allocator, array, arraySize * elementSize,
+        newArraySize * elementSize);
+}
+
+/// @fn ptrdiff_t arrayListSearch(ArrayList *arrayList, int value)
+///
+/// @brief Search an ArrayList for a given value.
+///
+/// @param arrayList A pointer to the ArrayList to search.
+/// @param value The value to search for.
+///
+/// @note An unsorted ArrayList is scanned with the widest vector instruction
+/// set the CPU supports.  Sorted and frozen ArrayLists are binary searched and
+/// return the first occurrence in sorted order.
+///
+/// @return Returns the index of the value in the ArrayList's array if found, -1
+/// if the value was not found in the list.
+ptrdiff_t arrayListSearch(ArrayList *arrayList, int value) {
+    if (arrayList == NULL) {
+        // Cannot search
+        return -1;
+    }
+
+    LIST_STATS_TIMER(start);
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_SEARCHES, 1);
+
+    size_t listSize = arrayList->listSize;
+    size_t foundIndex = listSize;
+    if (arrayList->layout == AL_LAYOUT_EYTZINGER) {
+        size_t node = eytzingerLowerBound(arrayList->array, listSize, value);
+        if ((node > 0) && (arrayList->array[node - 1] == value)) {
+            foundIndex = node - 1;
+        }
+    } else if (arrayList->layout == AL_LAYOUT_SORTED) {
+        size_t rank = sortedRank(arrayList->array, listSize, value, 0);
+        if ((rank < listSize) && (arrayList->array[rank] == value)) {
+            foundIndex = rank;
+        }
+    } else {
+        foundIndex = alSimdFindFirst(arrayList->array, listSize, value);
+    }
+    LIST_STATS_LATENCY(arrayList->stats, LIST_STATS_OP_SEARCH, start);
+
+    if (foundIndex == listSize) {
+        // value not found
+        return -1;
+    }
+
+    return (ptrdiff_t) foundIndex;
+}
+
+/// @fn ptrdiff_t arrayListCount(ArrayList *arrayList, int value)
+///
+/// @brief Count how many times a value appears in an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to search.
+/// @param value The value to count.
+///
+/// @return Returns the number of times the value appears on success, -1 on
+/// failure.
+ptrdiff_t arrayListCount(ArrayList *arrayList, int value) {
+    if (arrayList == NULL) {
+        return -1;
+    } else if (arrayList->layout != AL_LAYOUT_UNSORTED) {
+        return (ptrdiff_t) (arrayListRank(arrayList, value, 1)
+            - arrayListRank(arrayList, value, 0));
+    }
+
+    return (ptrdiff_t) alSimdCount(arrayList->array, arrayList->listSize,
+        value);
+}
+
+/// @fn ptrdiff_t arrayListFindAll(ArrayList *arrayList, int value,
+///   size_t *indices, size_t maxIndices)
+///
+/// @brief Find the index of every occurrence of a value in an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to search.
+/// @param value The value to search for.
+/// @param indices The array to store the indices of the matches in, in
+///   ascending order.  May be NULL if maxIndices is 0.
+/// @param maxIndices The number of elements indices can hold.
+///
+/// @return Returns the total number of matches on success, which may be more
+/// than maxIndices, or -1 on failure.
+ptrdiff_t arrayListFindAll(ArrayList *arrayList, int value, size_t *indices,
+    size_t maxIndices
+) {
+    if ((arrayList == NULL) || ((indices == NULL) && (maxIndices > 0))) {
+        return -1;
+    }
+
+    return (ptrdiff_t) alSimdFindAll(arrayList->array, arrayList->listSize,
+        value, indices, maxIndices);
+}
+
+/// @fn int arrayListRemove(ArrayList *arrayList, int value)
+///
+/// @brief Remove a given value from an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to remove a value from.
+/// @param value The value to remove from the list.
+///
+/// @note A sorted ArrayList stays sorted.  A frozen ArrayList cannot be
+/// removed from.
+///
+/// @return Returns 0 if the value was successfully removed from the list, -1 if
+/// the value was not in the list to start with.
+int arrayListRemove(ArrayList *arrayList, int value) {
+    if ((arrayList != NULL) && (arrayList->layout == AL_LAYOUT_EYTZINGER)) {
+        return -1;
+    }
+
+    ptrdiff_t foundIndex = arrayListSearch(arrayList, value);
+    if (foundIndex < 0) {
+        // Value not in list
+        return -1;
+    }
+
+    return arrayListRemoveAt(arrayList, (size_t) foundIndex);
+}
+
+/// @fn int arrayListRemoveAt(ArrayList *arrayList, size_t index)
+///
+/// @brief Remove the element at a given index from an ArrayList, keeping the
+/// remaining elements in order.
 ///
-/// @return Returns a pointer to a allocated and initialized ArrayList on
-/// success, NULL on failure.
-ArrayList* arrayListCreate(void) {
-    ArrayList *arrayList = (ArrayList*) malloc(sizeof(ArrayList));
-    if (arrayList == NULL) {
-        return NULL;
+/// @param arrayList A pointer to the ArrayList to remove an element from.
+/// @param index The index of the element to remove.
+///
+/// @note The elements after index are shifted down with a single memmove.
+///
+/// @return Returns 0 on success, -1 if index is out of range or the ArrayList
+/// is frozen.
+int arrayListRemoveAt(ArrayList *arrayList, size_t index) {
+    if ((arrayList == NULL) || (arrayList->layout == AL_LAYOUT_EYTZINGER)) {
+        return -1;
+    } else if (index >= arrayList->listSize) {
+        return -1;
     }
 
-    arrayList->array = (int*) malloc(MIN_ARRAY_SIZE * sizeof(int));
-    if (arrayList->array == NULL) {
-        free(arrayList); arrayList = NULL;
-        return NULL;
+    LIST_STATS_TIMER(start);
+    memmove(&arrayList->array[index], &arrayList->array[index + 1],
+        (arrayList->listSize - index - 1) * sizeof(int));
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_ELEMENTS_SHIFTED,
+        arrayList->listSize - index - 1);
+    arrayList->listSize--;
+    arrayListShrink(arrayList);
+    LIST_STATS_LATENCY(arrayList->stats, LIST_STATS_OP_REMOVE, start);
+
+    return 0;
+}
+
+/// @fn int arrayListSwapRemove(ArrayList *arrayList, int value)
+///
+/// @brief Remove a given value from an ArrayList by moving the last element
+/// into its place.
+///
+/// @param arrayList A pointer to the ArrayList to remove a value from.
+/// @param value The value to remove from the list.
+///
+/// @note Only the search is O(n); the removal itself is O(1).  The order of the
+/// remaining elements is not preserved, so a sorted ArrayList becomes
+/// unsorted.
+///
+/// @return Returns 0 if the value was successfully removed from the list, -1 if
+/// the value was not in the list to start with.
+int arrayListSwapRemove(ArrayList *arrayList, int value) {
+    if ((arrayList != NULL) && (arrayList->layout == AL_LAYOUT_EYTZINGER)) {
+        return -1;
     }
 
-    arrayList->arraySize = MIN_ARRAY_SIZE;
-    arrayList->listSize = 0;
+    ptrdiff_t foundIndex = arrayListSearch(arrayList, value);
+    if (foundIndex < 0) {
+        // Value not in list
+        return -1;
+    }
 
-    return arrayList;
+    return arrayListSwapRemoveAt(arrayList, (size_t) foundIndex);
 }
 
-/// @fn int arrayListInsert(ArrayList *arrayList, int value)
+/// @fn int arrayListSwapRemoveAt(ArrayList *arrayList, size_t index)
 ///
-/// @brief Insert a new value at the end of an ArrayList.
+/// @brief Remove the element at a given index from an ArrayList in O(1) by
+/// moving the last element into its place.
 ///
-/// @param arrayList A pointer to the ArrayList to append the value to.
-/// @param value The value to append.
+/// @param arrayList A pointer to the ArrayList to remove an element from.
+/// @param index The index of the element to remove.
+///
+/// @note The order of the remaining elements is not preserved, so a sorted
+/// ArrayList becomes unsorted.
+///
+/// @return Returns 0 on success, -1 if index is out of range or the ArrayList
+/// is frozen.
+int arrayListSwapRemoveAt(ArrayList *arrayList, size_t index) {
+    if ((arrayList == NULL) || (arrayList->layout == AL_LAYOUT_EYTZINGER)) {
+        return -1;
+    } else if (index >= arrayList->listSize) {
+        return -1;
+    }
+
+    size_t lastIndex = arrayList->listSize - 1;
+    if (index != lastIndex) {
+        arrayList->array[index] = arrayList->array[lastIndex];
+        arrayList->layout = AL_LAYOUT_UNSORTED;
+    }
+    arrayList->listSize--;
+    arrayListShrink(arrayList);
+
+    return 0;
+}
+
+/// @fn ptrdiff_t arrayListRemoveIf(ArrayList *arrayList,
+///   int (*predicate)(int value, void *context), void *context)
+///
+/// @brief Remove every element of an ArrayList that a predicate selects.
+///
+/// @param arrayList A pointer to the ArrayList to remove elements from.
+/// @param predicate The function that returns nonzero for values to remove.
+/// @param context An arbitrary pointer passed through to predicate.
+///
+/// @note The array is compacted in a single pass, so removing any number of
+/// elements is O(n).  The remaining elements keep their order.
+///
+/// @return Returns the number of elements removed on success, -1 on failure.
+ptrdiff_t arrayListRemoveIf(ArrayList *arrayList,
+    int (*predicate)(int value, void *context), void *context
+) {
+    if ((arrayList == NULL) || (predicate == NULL)) {
+        return -1;
+    } else if (arrayList->layout == AL_LAYOUT_EYTZINGER) {
+        return -1;
+    }
+
+    int *array = arrayList->array;
+    size_t listSize = arrayList->listSize;
+    size_t kept = 0;
+    for (size_t ii = 0; ii < listSize; ii++) {
+        int value = array[ii];
+        array[kept] = value;
+        kept += (predicate(value, context) == 0);
+    }
+    arrayList->listSize = kept;
+    arrayListShrink(arrayList);
+
+    return (ptrdiff_t) (listSize - kept);
+}
+
+/// @fn ptrdiff_t arrayListRemoveAll(ArrayList *arrayList, int value)
+///
+/// @brief Remove every occurrence of a value from an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to remove the value from.
+/// @param value The value to remove.
+///
+/// @note Unsorted ArrayLists are compacted in a single pass.  In a sorted
+/// ArrayList the occurrences are adjacent and are removed with one memmove.
+///
+/// @return Returns the number of elements removed on success, -1 on failure.
+ptrdiff_t arrayListRemoveAll(ArrayList *arrayList, int value) {
+    if ((arrayList == NULL) || (arrayList->layout == AL_LAYOUT_EYTZINGER)) {
+        return -1;
+    }
+
+    int *array = arrayList->array;
+    size_t listSize = arrayList->listSize;
+
+    if (arrayList->layout == AL_LAYOUT_SORTED) {
+        size_t first = sortedRank(array, listSize, value, 0);
+        size_t last = sortedRank(array, listSize, value, 1);
+        memmove(&array[first], &array[last], (listSize - last) * sizeof(int));
+        LIST_STATS_ADD(arrayList->stats, LIST_STATS_ELEMENTS_SHIFTED,
+            listSize - last);
+        arrayList->listSize -= last - first;
+        arrayListShrink(arrayList);
+        return (ptrdiff_t) (last - first);
+    }
+
+    // Write every element back unconditionally and only advance past the ones
+    // we keep, which leaves the loop without a data-dependent branch.
+    size_t kept = 0;
+    for (size_t ii = 0; ii < listSize; ii++) {
+        int current = array[ii];
+        array[kept] = current;
+        kept += (current != value);
+    }
+    arrayList->listSize = kept;
+    arrayListShrink(arrayList);
+
+    return (ptrdiff_t) (listSize - kept);
+}
+
+/// @fn int arrayListPrint(ArrayList *arrayList)
+///
+/// @brief Print out all of the values in an ArrayList, with one value per line.
+///
+/// @param arrayList A pointer to the ArrayList to print the values from.
 ///
 /// @return Returns 0 on success, -1 on failure.
-int arrayListInsert(ArrayList *arrayList, int value) {
+int arrayListPrint(ArrayList *arrayList) {
     if (arrayList == NULL) {
         return -1;
-    } else if (arrayList->listSize == arrayList->arraySize) {
-        // Array is full.  This means the previous attempt
-        // to extend the array failed.  Nothing we can do.
+    }
+
+    printf("ArrayList contents:\n");
+    ALIter iterStorage;
+    for (ALIter *alIter = alIterInit(&iterStorage, arrayList);
+        alIter != NULL;
+        alIter = alIterStep(alIter)
+    ) {
+        printf("%d\n", alIterValue(alIter));
+    }
+
+    return 0;
+}
+
+// Sorted ArrayList functions follow
+
+/// @fn int arrayListSort(ArrayList *arrayList)
+///
+/// @brief Sort an ArrayList in ascending order and keep it sorted from then on.
+///
+/// @param arrayList A pointer to the ArrayList to sort.
+///
+/// @note A frozen ArrayList is already sorted and is thawed instead.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListSort(ArrayList *arrayList) {
+    if (arrayList == NULL) {
         return -1;
+    } else if (arrayList->layout == AL_LAYOUT_EYTZINGER) {
+        return arrayListThaw(arrayList);
     }
 
-    arrayList->array[arrayList->listSize] = value;
-    arrayList->listSize++;
+    if (arrayList->layout == AL_LAYOUT_UNSORTED) {
+        qsort(arrayList->array, arrayList->listSize, sizeof(int), compareInts);
+        arrayList->layout = AL_LAYOUT_SORTED;
+    }
+
+    return 0;
+}
+
+/// @fn int arrayListInsertSorted(ArrayList *arrayList, int value)
+///
+/// @brief Insert a value into a sorted ArrayList, keeping it in order.
+///
+/// @param arrayList A pointer to a sorted ArrayList.
+/// @param value The value to insert.  It is placed after any equal values.
+///
+/// @return Returns 0 on success, -1 on failure or if the ArrayList is not
+/// sorted.
+int arrayListInsertSorted(ArrayList *arrayList, int value) {
+    if ((arrayList == NULL) || (arrayList->layout != AL_LAYOUT_SORTED)) {
+        return -1;
+    }
 
     if (arrayList->listSize == arrayList->arraySize) {
-        // Double the size of the array
-        int newArraySize = arrayList->arraySize * 2;
-        void *check = realloc(arrayList->array, newArraySize * sizeof(int));
-        if (check == NULL) {
+        if (arrayListGrow(arrayList, arrayList->listSize + 1) != 0) {
             // Out of memory.
             return -1;
         }
+    }
+
+    size_t listSize = arrayList->listSize;
+    size_t insertIndex = sortedRank(arrayList->array, listSize, value, 1);
+    memmove(&arrayList->array[insertIndex + 1], &arrayList->array[insertIndex],
+        (listSize - insertIndex) * sizeof(int));
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_ELEMENTS_SHIFTED,
+        listSize - insertIndex);
+    arrayList->array[insertIndex] = value;
+    arrayList->listSize++;
+
+    return 0;
+}
+
+/// @fn int arrayListFreeze(ArrayList *arrayList)
+///
+/// @brief Rearrange an ArrayList into Eytzinger order for fast lookups.
+///
+/// @param arrayList A pointer to the ArrayList to freeze.  It is sorted first
+///   if it is not already.
+///
+/// @note The top levels of the implicit search tree share a handful of cache
+/// lines, so a lookup touches far fewer lines than a binary search of a sorted
+/// array.  While frozen the list cannot be inserted into or removed from, and
+/// iterators visit the elements in tree order rather than sorted order.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListFreeze(ArrayList *arrayList) {
+    if (arrayList == NULL) {
+        return -1;
+    } else if (arrayList->layout == AL_LAYOUT_EYTZINGER) {
+        // Already frozen
+        return 0;
+    }
+
+    size_t listSize = arrayList->listSize;
+    size_t scratchBytes = (listSize > 0 ? listSize : 1) * sizeof(int);
+    int *tree = (int*) allocatorAlloc(&arrayList->allocator, scratchBytes);
+    if (tree == NULL) {
+        return -1;
+    }
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_MALLOCS, 1);
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_FREES, 1);
+
+    arrayListSort(arrayList);
+    eytzingerFill(tree, arrayList->array, 0, 1, listSize);
+    memcpy(arrayList->array, tree, listSize * sizeof(int));
+    allocatorFree(&arrayList->allocator, tree, scratchBytes);
+    tree = NULL;
+    arrayList->layout = AL_LAYOUT_EYTZINGER;
+
+    return 0;
+}
+
+/// @fn int arrayListThaw(ArrayList *arrayList)
+///
+/// @brief Return a frozen ArrayList to sorted order so it can be modified.
+///
+/// @param arrayList A pointer to the ArrayList to thaw.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListThaw(ArrayList *arrayList) {
+    if (arrayList == NULL) {
+        return -1;
+    } else if (arrayList->layout != AL_LAYOUT_EYTZINGER) {
+        // Not frozen
+        return 0;
+    }
 
-        arrayList->array = (int*) check;
-        arrayList->arraySize = newArraySize;
+    size_t listSize = arrayList->listSize;
+    size_t scratchBytes = (listSize > 0 ? listSize : 1) * sizeof(int);
+    int *sorted = (int*) allocatorAlloc(&arrayList->allocator, scratchBytes);
+    if (sorted == NULL) {
+        return -1;
     }
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_MALLOCS, 1);
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_FREES, 1);
+
+    eytzingerDrain(sorted, arrayList->array, 0, 1, listSize);
+    memcpy(arrayList->array, sorted, listSize * sizeof(int));
+    allocatorFree(&arrayList->allocator, sorted, scratchBytes);
+    sorted = NULL;
+    arrayList->layout = AL_LAYOUT_SORTED;
 
     return 0;
 }
 
-/// @fn int arrayListSearch(ArrayList *arrayList, int value)
+/// @fn ptrdiff_t arrayListLowerBound(ArrayList *arrayList, int value)
 ///
-/// @brief Search an ArrayList for a given value.
+/// @brief Find the sorted position of the first element not less than value.
 ///
-/// @param arrayList A pointer to the ArrayList to search.
+/// @param arrayList A pointer to a sorted or frozen ArrayList.
 /// @param value The value to search for.
 ///
-/// @return Returns the index of the value in the ArrayList's array if found, -1
-/// if the value was not found in the list.
-int arrayListSearch(ArrayList *arrayList, int value) {
-    if (arrayList == NULL) {
-        // Cannot search
+/// @return Returns the number of elements less than value on success, -1 on
+/// failure or if the ArrayList is not sorted.
+ptrdiff_t arrayListLowerBound(ArrayList *arrayList, int value) {
+    if ((arrayList == NULL) || (arrayList->layout == AL_LAYOUT_UNSORTED)) {
         return -1;
     }
 
-    for (int ii = 0; ii < arrayList->listSize; ii++) {
-        if (arrayList->array[ii] == value) {
-            return ii;
-        }
+    return (ptrdiff_t) arrayListRank(arrayList, value, 0);
+}
+
+/// @fn ptrdiff_t arrayListUpperBound(ArrayList *arrayList, int value)
+///
+/// @brief Find the sorted position of the first element greater than value.
+///
+/// @param arrayList A pointer to a sorted or frozen ArrayList.
+/// @param value The value to search for.
+///
+/// @return Returns the number of elements less than or equal to value on
+/// success, -1 on failure or if the ArrayList is not sorted.
+ptrdiff_t arrayListUpperBound(ArrayList *arrayList, int value) {
+    if ((arrayList == NULL) || (arrayList->layout == AL_LAYOUT_UNSORTED)) {
+        return -1;
     }
 
-    // value not found
-    return -1;
+    return (ptrdiff_t) arrayListRank(arrayList, value, 1);
 }
 
-/// @fn int arrayListRemove(ArrayList *arrayList, int value)
+/// @fn ptrdiff_t arrayListCountRange(ArrayList *arrayList, int low,
+///   int high)
 ///
-/// @brief Remove a given value from an ArrayList.
+/// @brief Count the elements of a sorted or frozen ArrayList in [low, high].
 ///
-/// @param arrayList A pointer to the ArrayList to remove a value from.
-/// @param value The value to remove from the list.
+/// @param arrayList A pointer to a sorted or frozen ArrayList.
+/// @param low The smallest value to count.
+/// @param high The largest value to count.
 ///
-/// @return Returns 0 if the value was successfully removed from the list, -1 if
-/// the value was not in the list to start with.
-int arrayListRemove(ArrayList *arrayList, int value) {
-    int foundIndex = arrayListSearch(arrayList, value);
-    if (foundIndex < 0) {
-        // Value not in list
+/// @return Returns the number of elements between low and high inclusive on
+/// success, -1 on failure or if the ArrayList is not sorted.
+ptrdiff_t arrayListCountRange(ArrayList *arrayList, int low, int high) {
+    if ((arrayList == NULL) || (arrayList->layout == AL_LAYOUT_UNSORTED)) {
         return -1;
+    } else if (low > high) {
+        return 0;
     }
 
-    for (int ii = foundIndex; ii < (arrayList->listSize - 1); ii++) {
-        arrayList->array[ii] = arrayList->array[ii + 1];
+    return (ptrdiff_t) (arrayListRank(arrayList, high, 1)
+        - arrayListRank(arrayList, low, 0));
+}
+
+// Bulk traversal functions follow
+
+/// @fn const int* arrayListData(ArrayList *arrayList, size_t *count)
+///
+/// @brief Get direct read access to the elements of an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to access.
+/// @param count Set to the number of elements in the returned span.
+///
+/// @note The span is only valid until the ArrayList is next modified, since
+/// growing the array may move it.
+///
+/// @return Returns a pointer to the first element on success, NULL on failure.
+const int* arrayListData(ArrayList *arrayList, size_t *count) {
+    if ((arrayList == NULL) || (count == NULL)) {
+        return NULL;
+    }
+
+    *count = arrayList->listSize;
+
+    return arrayList->array;
+}
+
+/// @fn int arrayListCopyTo(ArrayList *arrayList, int *values)
+///
+/// @brief Copy the values of an ArrayList out in list order.
+///
+/// @param arrayList A pointer to the ArrayList to copy.
+/// @param values Where to put the values.  Must have room for listSize ints.
+///
+/// @note A frozen ArrayList is copied in sorted order, as if it had been
+/// thawed, but is left frozen.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListCopyTo(ArrayList *arrayList, int *values) {
+    if ((arrayList == NULL)
+        || ((values == NULL) && (arrayList->listSize > 0))
+    ) {
+        return -1;
+    }
+
+    if (arrayList->layout == AL_LAYOUT_EYTZINGER) {
+        eytzingerDrain(values, arrayList->array, 0, 1, arrayList->listSize);
+    } else if (arrayList->listSize > 0) {
+        memcpy(values, arrayList->array, arrayList->listSize * sizeof(int));
     }
-    arrayList->listSize--;
 
     return 0;
 }
 
-/// @fn int arrayListPrint(ArrayList *arrayList)
+/// @fn int arrayListForEach(ArrayList *arrayList,
+///   void (*visit)(int value, void *context), void *context)
 ///
-/// @brief Print out all of the values in an ArrayList, with one value per line.
+/// @brief Call a function for every value in an ArrayList, in array order.
 ///
-/// @param arrayList A pointer to the ArrayList to print the values from.
+/// @param arrayList A pointer to the ArrayList to traverse.
+/// @param visit The function to call with each value.
+/// @param context An arbitrary pointer passed through to visit.
 ///
 /// @return Returns 0 on success, -1 on failure.
-int arrayListPrint(ArrayList *arrayList) {
+int arrayListForEach(ArrayList *arrayList,
+    void (*visit)(int value, void *context), void *context
+) {
+    if ((arrayList == NULL) || (visit == NULL)) {
+        return -1;
+    }
+
+    const int *array = arrayList->array;
+    size_t listSize = arrayList->listSize;
+    for (size_t ii = 0; ii < listSize; ii++) {
+        visit(array[ii], context);
+    }
+
+    return 0;
+}
+
+/// @fn long long arrayListReduce(ArrayList *arrayList, long long initial,
+///   long long (*reduce)(long long accumulator, const int *span, size_t count,
+///   void *context), void *context)
+///
+/// @brief Fold the values of an ArrayList into a single result.
+///
+/// @param arrayList A pointer to the ArrayList to reduce.
+/// @param initial The starting value of the accumulator.
+/// @param reduce The function that folds a contiguous span of values into the
+///   accumulator and returns the new accumulator.
+/// @param context An arbitrary pointer passed through to reduce.
+///
+/// @note reduce is handed the array itself rather than one value at a time, so
+/// the loop inside it can be vectorized by the compiler.
+///
+/// @return Returns the final accumulator, or initial if there was nothing to
+/// reduce.
+long long arrayListReduce(ArrayList *arrayList, long long initial,
+    long long (*reduce)(long long accumulator, const int *span, size_t count,
+        void *context),
+    void *context
+) {
+    if ((arrayList == NULL) || (reduce == NULL) || (arrayList->listSize == 0)) {
+        return initial;
+    }
+
+    return reduce(initial, arrayList->array, arrayList->listSize, context);
+}
+
+// Instrumentation functions follow
+
+/// @fn int arrayListGetStats(ArrayList *arrayList, ListStats *stats)
+///
+/// @brief Get a snapshot of the instrumentation counters of an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to query.
+/// @param stats The snapshot to fill in.
+///
+/// @note Counters are only kept when the library is built with
+/// DS_INSTRUMENTATION.  listStatsDump prints every live list at once.
+///
+/// @return Returns 0 on success, -1 on failure or if instrumentation was not
+/// built in.
+int arrayListGetStats(ArrayList *arrayList, ListStats *stats) {
     if (arrayList == NULL) {
         return -1;
     }
 
-    printf("ArrayList contents:\n");
-    for (ALIter *alIter = alIterCreate(arrayList);
-        alIter != NULL;
-        alIter = alIterNext(alIter)
-    ) {
-        printf("%d\n", alIterValue(alIter));
+    return listStatsGet(arrayList->stats, stats);
+}
+
+/// @fn int arrayListMemoryUsage(ArrayList *arrayList,
+///   ALMemoryUsage *memoryUsage)
+///
+/// @brief Report how much memory an ArrayList holds and how much of it is in
+/// use.
+///
+/// @param arrayList A pointer to the ArrayList to report on.
+/// @param memoryUsage The report to fill in.
+///
+/// @note For a file-backed list the array is the mapped file, not the heap.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListMemoryUsage(ArrayList *arrayList, ALMemoryUsage *memoryUsage) {
+    if ((arrayList == NULL) || (memoryUsage == NULL)) {
+        return -1;
     }
 
+    memoryUsage->usedBytes = arrayList->listSize * sizeof(int);
+    memoryUsage->reservedBytes = arrayList->arraySize * sizeof(int);
+    memoryUsage->slackBytes
+        = memoryUsage->reservedBytes - memoryUsage->usedBytes;
+    memoryUsage->overheadBytes = sizeof(ArrayList);
+
     return 0;
 }
 
@@ -178,6 +1381,8 @@ int arrayListPrint(ArrayList *arrayList) {
 ///
 /// @param arrayList A pointer to the ArrayList to create the iterator for.
 ///
+/// @note Prefer alIterInit, which does the same thing without allocating.
+///
 /// @return Returns a pointer to an allocated and initialized ALIter on success,
 /// NULL on failure.
 ALIter* alIterCreate(ArrayList *arrayList) {
@@ -185,7 +1390,8 @@ ALIter* alIterCreate(ArrayList *arrayList) {
         return NULL;
     }
 
-    ALIter *alIter = (ALIter*) malloc(sizeof(ALIter));
+    ALIter *alIter
+        = (ALIter*) allocatorAlloc(&arrayList->allocator, sizeof(ALIter));
     if (alIter == NULL) {
         return NULL;
     }
@@ -209,9 +1415,12 @@ ALIter* alIterNext(ALIter *alIter) {
         return NULL;
     }
 
+    // Use >= rather than == so that an iterator over a list that shrank
+    // underneath it still stops instead of running off the end.
     alIter->nextIndex++;
-    if (alIter->nextIndex == alIter->arrayList->listSize) {
-        free(alIter); alIter = NULL;
+    if (alIter->nextIndex >= alIter->arrayList->listSize) {
+        allocatorFree(&alIter->arrayList->allocator, alIter, sizeof(ALIter));
+        alIter = NULL;
         return NULL;
     }
 
@@ -233,3 +1442,47 @@ int alIterValue(ALIter *alIter) {
     return alIter->arrayList->array[alIter->nextIndex];
 }
 
+/// @fn ALIter* alIterInit(ALIter *alIter, ArrayList *arrayList)
+///
+/// @brief Initialize caller-provided storage as an iterator for an ArrayList.
+///
+/// @param alIter A pointer to the ALIter to initialize.  It can live on the
+///   stack or be embedded in another structure.
+/// @param arrayList A pointer to the ArrayList to iterate over.
+///
+/// @note Iterators initialized this way are advanced with alIterStep, never
+/// alIterNext, and are never allocated or freed by the library.
+///
+/// @return Returns alIter if the ArrayList has a value to retrieve, NULL if it
+/// is empty or on failure.
+ALIter* alIterInit(ALIter *alIter, ArrayList *arrayList) {
+    if ((alIter == NULL) || (arrayList == NULL) || (arrayList->listSize == 0)) {
+        return NULL;
+    }
+
+    alIter->arrayList = arrayList;
+    alIter->nextIndex = 0;
+
+    return alIter;
+}
+
+/// @fn ALIter* alIterStep(ALIter *alIter)
+///
+/// @brief Prepare an iterator initialized by alIterInit for retrieving the
+/// next value.
+///
+/// @param alIter A pointer to the ALIter to prepare.
+///
+/// @return Returns alIter if there is another value to retrieve, NULL if not.
+ALIter* alIterStep(ALIter *alIter) {
+    if (alIter == NULL) {
+        return NULL;
+    }
+
+    alIter->nextIndex++;
+    if (alIter->nextIndex >= alIter->arrayList->listSize) {
+        return NULL;
+    }
+
+    return alIter;
+}
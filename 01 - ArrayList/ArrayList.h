@@ -36,11 +36,77 @@
 #ifndef ARRAY_LIST_H
 #define ARRAY_LIST_H
 
+// Standard C includes
+#include <stddef.h>
+
+#include "Allocator.h"
+#include "ListStats.h"
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+/// @def AL_MIN_ARRAY_SIZE
+///
+/// @brief Minimum size we allow the array of any array-backed list to be.
+#define AL_MIN_ARRAY_SIZE 4
+
+/// @struct ALGrowthPolicy
+///
+/// @brief Controls how the array of an ArrayList grows when it runs out of
+/// room, and how it shrinks again when elements are removed.
+///
+/// @var factor The multiplier applied to arraySize on each growth step.  Must
+///   be greater than 1.0 unless exactFit is set.
+/// @var maxGrowth The largest number of elements a single growth step may add,
+///   or 0 for no limit.
+/// @var exactFit If nonzero, the array is only ever grown to exactly the size
+///   needed for the elements being inserted.
+/// @var shrinkBelow The fraction of the array that has to be in use after a
+///   removal for it to be left alone, or 0 to never shrink it automatically.
+///   Below that the array is shrunk to twice the number of elements, so that
+///   usage lands well between the shrink and grow points.  Must be less than
+///   0.5.
+typedef struct ALGrowthPolicy {
+    double factor;
+    size_t maxGrowth;
+    int exactFit;
+    double shrinkBelow;
+} ALGrowthPolicy;
+
+/// @enum ALLayout
+///
+/// @brief How the elements of an ArrayList are arranged in its array.
+///
+/// @var AL_LAYOUT_UNSORTED Elements are in insertion order.
+/// @var AL_LAYOUT_SORTED Elements are in ascending order.
+/// @var AL_LAYOUT_EYTZINGER Elements are in ascending order arranged as an
+///   implicit binary search tree in breadth-first (Eytzinger) order.  The list
+///   is frozen in this layout and cannot be modified until it is thawed.
+typedef enum ALLayout {
+    AL_LAYOUT_UNSORTED = 0,
+    AL_LAYOUT_SORTED,
+    AL_LAYOUT_EYTZINGER
+} ALLayout;
+
+/// @enum ALOpenMode
+///
+/// @brief How arrayListOpen maps a file.
+///
+/// @var AL_OPEN_READ_ONLY Map an existing file copy-on-write.  The list can
+///   still be modified, but changes are private to the process and never
+///   reach the file.
+/// @var AL_OPEN_READ_WRITE Map an existing file shared, so changes to the list
+///   are changes to the file.
+/// @var AL_OPEN_CREATE Like AL_OPEN_READ_WRITE, but create an empty list file
+///   first if there isn't one.
+typedef enum ALOpenMode {
+    AL_OPEN_READ_ONLY = 0,
+    AL_OPEN_READ_WRITE,
+    AL_OPEN_CREATE
+} ALOpenMode;
+
 /// @struct ArrayList
 ///
 /// @brief Base container for an array-based implementation of a list.
@@ -49,10 +115,33 @@ extern "C"
 ///   elements of the list.
 /// @var arraySize The number of elements that the array can hold.
 /// @var listSize The number of elements currently in the array.
+/// @var reservedSize The capacity last asked for with arrayListReserve.
+///   Removals never shrink the array below it.
+/// @var growthPolicy How the array is grown when it runs out of room.
+/// @var layout How the elements are arranged in the array.
+/// @var fileMapping The file the array is mapped from, or NULL if the array
+///   is on the heap.  See arrayListOpen.
+/// @var stats The list's instrumentation counters, or NULL if built without
+///   DS_INSTRUMENTATION.  See arrayListGetStats.
+/// @var allocator Where the ArrayList, its array and its iterators get their
+///   memory.  See arrayListCreateWithAllocator.
+///
+/// @note ArrayList is the int counterpart of GenericArrayList, and the two
+/// share their growth policy, sizing and reallocation code.  Sizes and indices
+/// are size_t so that a list can hold more than 2^31 elements.  Functions
+/// that return an index or a count return ptrdiff_t, with -1 for failure, and
+/// arrayListFindAll fills size_t indices.  All of these used to be int, so
+/// callers that kept the results in an int need to widen them.
 typedef struct ArrayList {
     int *array;
-    int arraySize;
-    int listSize;
+    size_t arraySize;
+    size_t listSize;
+    size_t reservedSize;
+    ALGrowthPolicy growthPolicy;
+    ALLayout layout;
+    struct ALFileMapping *fileMapping;
+    struct ListStatsRecord *stats;
+    Allocator allocator;
 } ArrayList;
 
 /// @struct ALIter
@@ -63,20 +152,91 @@ typedef struct ArrayList {
 /// @var nextIndex The index of the next element in the ArrayList to return.
 typedef struct ALIter {
     ArrayList *arrayList;
-    int nextIndex;
+    size_t nextIndex;
 } ALIter;
 
+/// @struct ALMemoryUsage
+///
+/// @brief Where the memory of an ArrayList goes.  See arrayListMemoryUsage.
+///
+/// @var usedBytes The bytes of the array holding elements.
+/// @var reservedBytes The bytes of the whole array.
+/// @var slackBytes The bytes of the array not holding elements, i.e.
+///   reservedBytes - usedBytes.
+/// @var overheadBytes The bytes of the ArrayList itself.
+typedef struct ALMemoryUsage {
+    size_t usedBytes;
+    size_t reservedBytes;
+    size_t slackBytes;
+    size_t overheadBytes;
+} ALMemoryUsage;
+
+// Growth policy prototypes
+ALGrowthPolicy* alGrowthPolicyInit(ALGrowthPolicy *growthPolicy);
+size_t alGrowthPolicyNextSize(const ALGrowthPolicy *growthPolicy,
+    size_t arraySize, size_t minArraySize, size_t maxArraySize);
+size_t alGrowthPolicyShrinkSize(const ALGrowthPolicy *growthPolicy,
+    size_t arraySize, size_t listSize, size_t minArraySize);
+int alGrowthPolicyValidate(const ALGrowthPolicy *growthPolicy);
+void* alArrayResize(const Allocator *allocator, void *array,
+    size_t elementSize, size_t arraySize, size_t newArraySize);
+
 // Base ArrayList prototypes
 ArrayList* arrayListCreate(void);
+ArrayList* arrayListCreateWithAllocator(const Allocator *allocator);
+ArrayList* arrayListDestroy(ArrayList *arrayList);
 int arrayListInsert(ArrayList *arrayList, int value);
-int arrayListSearch(ArrayList *arrayList, int value);
+int arrayListInsertMany(ArrayList *arrayList, const int *values, size_t count);
+int arrayListReserve(ArrayList *arrayList, size_t capacity);
+int arrayListShrinkToFit(ArrayList *arrayList);
+int arrayListSetGrowthPolicy(ArrayList *arrayList,
+    const ALGrowthPolicy *growthPolicy);
+ptrdiff_t arrayListSearch(ArrayList *arrayList, int value);
+ptrdiff_t arrayListCount(ArrayList *arrayList, int value);
+ptrdiff_t arrayListFindAll(ArrayList *arrayList, int value, size_t *indices,
+    size_t maxIndices);
 int arrayListRemove(ArrayList *arrayList, int value);
+int arrayListRemoveAt(ArrayList *arrayList, size_t index);
+int arrayListSwapRemove(ArrayList *arrayList, int value);
+int arrayListSwapRemoveAt(ArrayList *arrayList, size_t index);
+ptrdiff_t arrayListRemoveIf(ArrayList *arrayList,
+    int (*predicate)(int value, void *context), void *context);
+ptrdiff_t arrayListRemoveAll(ArrayList *arrayList, int value);
 int arrayListPrint(ArrayList *arrayList);
 
+// Sorted ArrayList prototypes
+int arrayListSort(ArrayList *arrayList);
+int arrayListInsertSorted(ArrayList *arrayList, int value);
+int arrayListFreeze(ArrayList *arrayList);
+int arrayListThaw(ArrayList *arrayList);
+ptrdiff_t arrayListLowerBound(ArrayList *arrayList, int value);
+ptrdiff_t arrayListUpperBound(ArrayList *arrayList, int value);
+ptrdiff_t arrayListCountRange(ArrayList *arrayList, int low, int high);
+
+// Bulk traversal prototypes
+const int* arrayListData(ArrayList *arrayList, size_t *count);
+int arrayListCopyTo(ArrayList *arrayList, int *values);
+int arrayListForEach(ArrayList *arrayList,
+    void (*visit)(int value, void *context), void *context);
+long long arrayListReduce(ArrayList *arrayList, long long initial,
+    long long (*reduce)(long long accumulator, const int *span, size_t count,
+        void *context),
+    void *context);
+
+// File-backed ArrayList prototypes
+ArrayList* arrayListOpen(const char *path, ALOpenMode mode);
+int arrayListSync(ArrayList *arrayList);
+
+// Instrumentation prototypes
+int arrayListGetStats(ArrayList *arrayList, ListStats *stats);
+int arrayListMemoryUsage(ArrayList *arrayList, ALMemoryUsage *memoryUsage);
+
 // ArrayList iterator prototypes
 ALIter* alIterCreate(ArrayList *arrayList);
 ALIter* alIterNext(ALIter *alIter);
 int alIterValue(ALIter *alIter);
+ALIter* alIterInit(ALIter *alIter, ArrayList *arrayList);
+ALIter* alIterStep(ALIter *alIter);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -0,0 +1,444 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ArrayListFile.c
+///
+/// @brief File-backed storage for the ArrayList.
+///
+/// A list file is a fixed-size header followed directly by the array, in the
+/// byte order of the machine that wrote it.  The whole file is mapped into
+/// memory and ArrayList.array points just past the header, so opening a list
+/// costs the same no matter how big it is and the OS page cache decides what
+/// is actually in memory.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ArrayList.h"
+#include "ArrayListFile.h"
+
+/// @def AL_FILE_MAGIC
+///
+/// @brief First four bytes of every list file, "ALST" when read as ASCII on a
+/// little-endian machine.
+#define AL_FILE_MAGIC 0x54534C41u
+
+/// @def AL_FILE_VERSION
+///
+/// @brief Version of the file layout written by this code.
+#define AL_FILE_VERSION 1u
+
+/// @def AL_FILE_MIN_ARRAY_SIZE
+///
+/// @brief Number of elements a newly created list file has room for.
+#define AL_FILE_MIN_ARRAY_SIZE 4
+
+/// @struct ALFileHeader
+///
+/// @brief The header at the start of every list file.  It is padded to 64
+/// bytes so the array after it starts on a cache line.
+///
+/// @var magic Always AL_FILE_MAGIC.
+/// @var version Always AL_FILE_VERSION.
+/// @var elementSize Number of bytes in each element, sizeof(int).
+/// @var listSize Number of elements in the list as of the last sync.
+/// @var arraySize Number of elements the file has room for.
+/// @var layout The ALLayout of the list as of the last sync.
+typedef struct ALFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t elementSize;
+    uint64_t listSize;
+    uint64_t arraySize;
+    uint32_t layout;
+    unsigned char reserved[28];
+} ALFileHeader;
+
+/// @struct ALFileMapping
+///
+/// @brief What a file-backed ArrayList needs to know about its file.
+///
+/// @var fd The open file.
+/// @var writable Nonzero if the file is mapped shared, zero if it is mapped
+///   copy-on-write.
+/// @var header Pointer to the start of the mapping, which is the header.
+/// @var mappedBytes Length of the mapping.
+struct ALFileMapping {
+    int fd;
+    int writable;
+    ALFileHeader *header;
+    size_t mappedBytes;
+};
+
+/// @fn static size_t alFileBytes(size_t arraySize)
+///
+/// @brief Get the size of a list file with room for arraySize elements.
+///
+/// @return Returns the number of bytes, or 0 if that would overflow.
+static size_t alFileBytes(size_t arraySize) {
+    if (arraySize > (SIZE_MAX - sizeof(ALFileHeader)) / sizeof(int)) {
+        return 0;
+    }
+
+    return sizeof(ALFileHeader) + (arraySize * sizeof(int));
+}
+
+/// @fn static int alFileTruncate(int fd, size_t bytes)
+///
+/// @brief Set the length of a list file.
+///
+/// @note Callers that only give space back may ignore the result.  The file
+/// can be longer than its header claims without harm.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int alFileTruncate(int fd, size_t bytes) {
+    return (ftruncate(fd, (off_t) bytes) == 0) ? 0 : -1;
+}
+
+/// @fn static ALFileHeader* alFileMap(int fd, size_t bytes, int writable)
+///
+/// @brief Map the first bytes of a list file.
+///
+/// @return Returns a pointer to the mapping on success, NULL on failure.
+static ALFileHeader* alFileMap(int fd, size_t bytes, int writable) {
+    // A copy-on-write mapping is still writable.  The writes just don't go
+    // back to the file.
+    void *mapping = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+        writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+        return NULL;
+    }
+
+    return (ALFileHeader*) mapping;
+}
+
+/// @fn static int alFileCreate(int fd)
+///
+/// @brief Write the header of an empty list into an empty file.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int alFileCreate(int fd) {
+    if (ftruncate(fd, (off_t) alFileBytes(AL_FILE_MIN_ARRAY_SIZE)) != 0) {
+        return -1;
+    }
+
+    ALFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = AL_FILE_MAGIC;
+    header.version = AL_FILE_VERSION;
+    header.elementSize = sizeof(int);
+    header.listSize = 0;
+    header.arraySize = AL_FILE_MIN_ARRAY_SIZE;
+    header.layout = AL_LAYOUT_UNSORTED;
+
+    if (pwrite(fd, &header, sizeof(header), 0) != (ssize_t) sizeof(header)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/// @fn static int alFileCheckHeader(const ALFileHeader *header,
+///   size_t fileBytes)
+///
+/// @brief Make sure a header describes a list this code can use and that the
+/// file is big enough to hold it.
+///
+/// @return Returns 0 if the header is good, -1 if not.
+static int alFileCheckHeader(const ALFileHeader *header, size_t fileBytes) {
+    if ((header->magic != AL_FILE_MAGIC)
+        || (header->version != AL_FILE_VERSION)
+        || (header->elementSize != sizeof(int))
+        || (header->layout > AL_LAYOUT_EYTZINGER)
+        || (header->arraySize > SIZE_MAX)
+        || (header->listSize > header->arraySize)
+    ) {
+        return -1;
+    }
+
+    size_t neededBytes = alFileBytes((size_t) header->arraySize);
+    if ((neededBytes == 0) || (neededBytes > fileBytes)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/// @fn static ALFileHeader* alFileMapExisting(int fd, ALOpenMode mode,
+///   size_t *fileBytes)
+///
+/// @brief Map an open list file, creating its header first if the file is
+/// empty and mode allows it.
+///
+/// @param fd The open file.
+/// @param mode How the file was opened.
+/// @param fileBytes Set to the length of the mapping.
+///
+/// @return Returns a pointer to the mapped header on success, NULL on failure
+/// or if the file is not a list file this code can use.
+static ALFileHeader* alFileMapExisting(int fd, ALOpenMode mode,
+    size_t *fileBytes
+) {
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0) {
+        return NULL;
+    }
+
+    if ((fileStat.st_size == 0) && (mode == AL_OPEN_CREATE)) {
+        if ((alFileCreate(fd) != 0) || (fstat(fd, &fileStat) != 0)) {
+            return NULL;
+        }
+    }
+
+    if ((size_t) fileStat.st_size < sizeof(ALFileHeader)) {
+        // Not a list file
+        return NULL;
+    }
+
+    *fileBytes = (size_t) fileStat.st_size;
+    ALFileHeader *header = alFileMap(fd, *fileBytes,
+        mode != AL_OPEN_READ_ONLY);
+    if (header == NULL) {
+        return NULL;
+    } else if (alFileCheckHeader(header, *fileBytes) != 0) {
+        munmap(header, *fileBytes);
+        return NULL;
+    }
+
+    return header;
+}
+
+/// @fn ArrayList* arrayListOpen(const char *path, ALOpenMode mode)
+///
+/// @brief Open a list file as an ArrayList.
+///
+/// @param path The path of the list file.
+/// @param mode How to open and map the file.
+///
+/// @note Only the header is read.  The elements are paged in from the file on
+/// first touch, so this is O(1) in the size of the list.  Files are in native
+/// byte order and are not portable between machines of different endianness.
+///
+/// @note A list opened with AL_OPEN_READ_ONLY that outgrows its file is
+/// copied to the heap and stops being file-backed.
+///
+/// @return Returns a pointer to the opened ArrayList on success, NULL on
+/// failure.  Destroy it with arrayListDestroy.
+ArrayList* arrayListOpen(const char *path, ALOpenMode mode) {
+    if (path == NULL) {
+        return NULL;
+    }
+
+    int flags = (mode == AL_OPEN_READ_ONLY) ? O_RDONLY : O_RDWR;
+    if (mode == AL_OPEN_CREATE) {
+        flags |= O_CREAT;
+    }
+
+    int fd = open(path, flags, 0644);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    size_t fileBytes = 0;
+    ALFileHeader *header = alFileMapExisting(fd, mode, &fileBytes);
+    if (header == NULL) {
+        close(fd);
+        return NULL;
+    }
+
+    struct ALFileMapping *fileMapping
+        = (struct ALFileMapping*) malloc(sizeof(struct ALFileMapping));
+    ArrayList *arrayList = arrayListCreate();
+    if ((fileMapping == NULL) || (arrayList == NULL)) {
+        // Out of memory
+        free(fileMapping); fileMapping = NULL;
+        arrayList = arrayListDestroy(arrayList);
+        munmap(header, fileBytes);
+        close(fd);
+        return NULL;
+    }
+
+    fileMapping->fd = fd;
+    fileMapping->writable = (mode != AL_OPEN_READ_ONLY);
+    fileMapping->header = header;
+    fileMapping->mappedBytes = fileBytes;
+
+    allocatorFree(&arrayList->allocator, arrayList->array,
+        arrayList->arraySize * sizeof(int));
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_FREES, 1);
+    arrayList->array = (int*) (header + 1);
+    arrayList->arraySize = (size_t) header->arraySize;
+    arrayList->listSize = (size_t) header->listSize;
+    arrayList->layout = (ALLayout) header->layout;
+    arrayList->fileMapping = fileMapping;
+
+    return arrayList;
+}
+
+/// @fn int arrayListSync(ArrayList *arrayList)
+///
+/// @brief Write the size and layout of a file-backed ArrayList to its header
+/// and flush the whole mapping to the file.
+///
+/// @param arrayList A pointer to the ArrayList to sync.
+///
+/// @note Elements are written through the mapping as they change, but the
+/// listSize in the file only moves forward when the list is synced or
+/// destroyed.  Syncing a heap or copy-on-write list does nothing.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListSync(ArrayList *arrayList) {
+    if (arrayList == NULL) {
+        return -1;
+    }
+
+    struct ALFileMapping *fileMapping = arrayList->fileMapping;
+    if ((fileMapping == NULL) || (fileMapping->writable == 0)) {
+        // Nothing to write back to
+        return 0;
+    }
+
+    fileMapping->header->listSize = arrayList->listSize;
+    fileMapping->header->layout = (uint32_t) arrayList->layout;
+    if (msync(fileMapping->header, fileMapping->mappedBytes, MS_SYNC) != 0) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/// @fn static int alFileDetach(ArrayList *arrayList, size_t newArraySize)
+///
+/// @brief Move the elements of a copy-on-write ArrayList to the heap and
+/// drop its file.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int alFileDetach(ArrayList *arrayList, size_t newArraySize) {
+    int *array = (int*) allocatorAlloc(&arrayList->allocator,
+        newArraySize * sizeof(int));
+    if (array == NULL) {
+        // Out of memory
+        return -1;
+    }
+
+    size_t keep = (arrayList->listSize < newArraySize)
+        ? arrayList->listSize : newArraySize;
+    memcpy(array, arrayList->array, keep * sizeof(int));
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_MALLOCS, 1);
+    LIST_STATS_ADD(arrayList->stats, LIST_STATS_BYTES_COPIED,
+        keep * sizeof(int));
+    alFileUnmap(arrayList);
+    arrayList->array = array;
+    arrayList->arraySize = newArraySize;
+
+    return 0;
+}
+
+/// @fn int alFileResize(ArrayList *arrayList, size_t newArraySize)
+///
+/// @brief Change the number of elements the file of an ArrayList can hold and
+/// remap it.
+///
+/// @param arrayList A pointer to a file-backed ArrayList.
+/// @param newArraySize The number of elements the file should be able to hold.
+///
+/// @note On failure the ArrayList and its file are left as they were.
+///
+/// @return Returns 0 on success, -1 on failure.
+int alFileResize(ArrayList *arrayList, size_t newArraySize) {
+    struct ALFileMapping *fileMapping = arrayList->fileMapping;
+    if (fileMapping->writable == 0) {
+        return alFileDetach(arrayList, newArraySize);
+    }
+
+    size_t newBytes = alFileBytes(newArraySize);
+    if ((newBytes == 0) || (newBytes > (size_t) INTMAX_MAX)) {
+        return -1;
+    }
+
+    // Grow the file before mapping past its old end, but only shrink it once
+    // the old, longer mapping is gone
+    size_t oldBytes = fileMapping->mappedBytes;
+    if ((newBytes > oldBytes)
+        && (alFileTruncate(fileMapping->fd, newBytes) != 0)
+    ) {
+        return -1;
+    }
+
+    ALFileHeader *header = alFileMap(fileMapping->fd, newBytes, 1);
+    if (header == NULL) {
+        if (newBytes > oldBytes) {
+            // If this fails the file keeps the extra space, which the header
+            // doesn't claim, so the list is still good
+            alFileTruncate(fileMapping->fd, oldBytes);
+        }
+        return -1;
+    }
+
+    munmap(fileMapping->header, oldBytes);
+    if (newBytes < oldBytes) {
+        // Failing to give the space back only wastes disk, the list is fine
+        alFileTruncate(fileMapping->fd, newBytes);
+    }
+
+    header->arraySize = newArraySize;
+    fileMapping->header = header;
+    fileMapping->mappedBytes = newBytes;
+    arrayList->array = (int*) (header + 1);
+    arrayList->arraySize = newArraySize;
+
+    return 0;
+}
+
+/// @fn void alFileUnmap(ArrayList *arrayList)
+///
+/// @brief Sync a file-backed ArrayList, unmap it and close its file.
+///
+/// @param arrayList A pointer to a file-backed ArrayList.
+///
+/// @note Afterwards the ArrayList has no array at all.  The caller either
+/// frees it or gives it a new one.
+void alFileUnmap(ArrayList *arrayList) {
+    struct ALFileMapping *fileMapping = arrayList->fileMapping;
+
+    arrayListSync(arrayList);
+    munmap(fileMapping->header, fileMapping->mappedBytes);
+    close(fileMapping->fd);
+    free(fileMapping); fileMapping = NULL;
+
+    arrayList->fileMapping = NULL;
+    arrayList->array = NULL;
+    arrayList->arraySize = 0;
+}
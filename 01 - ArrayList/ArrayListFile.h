@@ -0,0 +1,61 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              ArrayListFile.h
+///
+/// @brief             Memory-mapped file storage used by the ArrayList.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ARRAY_LIST_FILE_H
+#define ARRAY_LIST_FILE_H
+
+// Standard C includes
+#include <stddef.h>
+
+#include "ArrayList.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// These are only for ArrayList.c.  The public side of file-backed lists,
+// arrayListOpen and arrayListSync, is declared in ArrayList.h.
+
+// ArrayList file mapping prototypes
+int alFileResize(ArrayList *arrayList, size_t newArraySize);
+void alFileUnmap(ArrayList *arrayList);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // ARRAY_LIST_FILE_H
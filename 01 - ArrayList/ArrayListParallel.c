@@ -0,0 +1,578 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ArrayListParallel.c
+///
+/// @brief Library implementation of the parallel ArrayList functions.
+///
+/// Every function cuts the array into chunks of at least AL_PARALLEL_CHUNK
+/// elements, a few per thread so that a slow thread doesn't hold up the rest,
+/// and hands them to a ThreadPool.  Results are combined with atomics, once
+/// per chunk rather than once per element.  Lists that are too small, or
+/// calls without a pool, run the same chunked code on the calling thread.
+
+// Standard C includes
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ArrayListParallel.h"
+#include "ArrayListSimd.h"
+
+/// @def AL_PARALLEL_CHUNK
+///
+/// @brief Fewest elements in one task.
+#define AL_PARALLEL_CHUNK ((size_t) 1 << 15)
+
+/// @def AL_TASKS_PER_THREAD
+///
+/// @brief How many chunks each thread of the pool gets on average.
+#define AL_TASKS_PER_THREAD 4
+
+/// @def AL_CANCEL_STRIDE
+///
+/// @brief Elements a search scans between checks for an earlier match found
+/// by another thread.
+#define AL_CANCEL_STRIDE 4096
+
+/// @def AL_SORT_OVERSAMPLE
+///
+/// @brief Samples taken per bucket when choosing sample sort splitters.  More
+/// samples give more even buckets.
+#define AL_SORT_OVERSAMPLE 32
+
+/// @struct ALScanJob
+///
+/// @brief Shared state of a parallel search, count or reduce.
+///
+/// @param array The elements to scan.
+/// @param count The number of elements.
+/// @param chunkSize The number of elements in each task.
+/// @param value The value to search for or count.
+/// @param op The reduction to compute.
+/// @param found The lowest index a match has been found at so far, or count.
+/// @param result The running count, sum, minimum or maximum.
+typedef struct ALScanJob {
+    const int *array;
+    size_t count;
+    size_t chunkSize;
+    int value;
+    ALReduceOp op;
+    atomic_size_t found;
+    atomic_llong result;
+} ALScanJob;
+
+/// @struct ALSortJob
+///
+/// @brief Shared state of a parallel sample sort.
+///
+/// @param array The elements to sort.
+/// @param scratch A buffer as big as array that buckets are gathered in.
+/// @param count The number of elements.
+/// @param chunkSize The number of elements in each chunk.
+/// @param numChunks The number of chunks, which is also the number of buckets.
+/// @param splitters The numChunks - 1 values that separate the buckets.
+/// @param offsets A numChunks by numChunks table.  Row c first holds how many
+///   elements of chunk c fall in each bucket, then where in scratch chunk c
+///   writes its next element of each bucket.
+/// @param bucketStarts Where each bucket starts in scratch, plus count at the
+///   end.
+typedef struct ALSortJob {
+    int *array;
+    int *scratch;
+    size_t count;
+    size_t chunkSize;
+    size_t numChunks;
+    const int *splitters;
+    size_t *offsets;
+    size_t *bucketStarts;
+} ALSortJob;
+
+/// @fn static int compareInts(const void *a, const void *b)
+///
+/// @brief qsort comparison function for ints.
+///
+/// @return Returns a negative value, 0 or a positive value if the int at a is
+/// less than, equal to or greater than the int at b.
+static int compareInts(const void *a, const void *b) {
+    int left = *((const int*) a);
+    int right = *((const int*) b);
+
+    // Don't subtract, that can overflow
+    return (left > right) - (left < right);
+}
+
+/// @fn static ThreadPool* alParallelPool(const ArrayList *arrayList,
+///   ThreadPool *threadPool)
+///
+/// @brief Decide whether an ArrayList is big enough to be worth splitting
+/// across a pool.
+///
+/// @return Returns threadPool if so, NULL to run on the calling thread.
+static ThreadPool* alParallelPool(const ArrayList *arrayList,
+    ThreadPool *threadPool
+) {
+    if ((threadPoolSize(threadPool) < 2)
+        || (arrayList->listSize < AL_PARALLEL_MIN_ELEMENTS)
+    ) {
+        return NULL;
+    }
+
+    return threadPool;
+}
+
+/// @fn static size_t alParallelChunkSize(size_t count,
+///   const ThreadPool *threadPool)
+///
+/// @brief Get the number of elements to put in each task.
+///
+/// @return Returns the chunk size, a multiple of 16 so chunks start on cache
+/// line boundaries.
+static size_t alParallelChunkSize(size_t count, const ThreadPool *threadPool) {
+    size_t numTasks = (size_t) threadPoolSize(threadPool) * AL_TASKS_PER_THREAD;
+    size_t chunkSize = (count / numTasks) + 1;
+    if (chunkSize < AL_PARALLEL_CHUNK) {
+        chunkSize = AL_PARALLEL_CHUNK;
+    }
+
+    return (chunkSize + 15) & ~(size_t) 15;
+}
+
+/// @fn static void alScanJobInit(ALScanJob *job, const ArrayList *arrayList,
+///   const ThreadPool *threadPool)
+///
+/// @brief Set up the parts of an ALScanJob every scan uses.
+///
+/// @return Returns the number of tasks to run.
+static size_t alScanJobInit(ALScanJob *job, const ArrayList *arrayList,
+    const ThreadPool *threadPool
+) {
+    job->array = arrayList->array;
+    job->count = arrayList->listSize;
+    job->chunkSize = alParallelChunkSize(job->count, threadPool);
+    job->value = 0;
+    job->op = AL_REDUCE_SUM;
+    atomic_init(&job->found, job->count);
+    atomic_init(&job->result, 0);
+
+    return (job->count + job->chunkSize - 1) / job->chunkSize;
+}
+
+/// @fn static void alFindTask(size_t taskIndex, void *context)
+///
+/// @brief ThreadPool task that searches one chunk for the first match.
+///
+/// @note The chunk is scanned AL_CANCEL_STRIDE elements at a time, and the
+/// task gives up as soon as any thread has found a match before the part it is
+/// about to scan, since that match is a better answer than anything here.
+static void alFindTask(size_t taskIndex, void *context) {
+    ALScanJob *job = (ALScanJob*) context;
+    size_t start = taskIndex * job->chunkSize;
+    size_t end = (job->count - start < job->chunkSize)
+        ? job->count : start + job->chunkSize;
+
+    for (size_t block = start; block < end; block += AL_CANCEL_STRIDE) {
+        size_t found = atomic_load_explicit(&job->found, memory_order_relaxed);
+        if (found < block) {
+            // Someone already has an earlier match
+            return;
+        }
+
+        size_t blockSize = (end - block < AL_CANCEL_STRIDE)
+            ? end - block : AL_CANCEL_STRIDE;
+        size_t index = alSimdFindFirst(&job->array[block], blockSize,
+            job->value);
+        if (index < blockSize) {
+            // Keep whichever match is earliest
+            size_t mine = block + index;
+            while ((mine < found) && !atomic_compare_exchange_weak_explicit(
+                &job->found, &found, mine, memory_order_relaxed,
+                memory_order_relaxed)
+            ) {
+                // found was reloaded by the failed exchange
+            }
+            return;
+        }
+    }
+}
+
+/// @fn static void alCountTask(size_t taskIndex, void *context)
+///
+/// @brief ThreadPool task that counts the matches in one chunk.
+static void alCountTask(size_t taskIndex, void *context) {
+    ALScanJob *job = (ALScanJob*) context;
+    size_t start = taskIndex * job->chunkSize;
+    size_t end = (job->count - start < job->chunkSize)
+        ? job->count : start + job->chunkSize;
+
+    size_t matches = alSimdCount(&job->array[start], end - start, job->value);
+    atomic_fetch_add_explicit(&job->result, (long long) matches,
+        memory_order_relaxed);
+}
+
+/// @fn static void alReduceTask(size_t taskIndex, void *context)
+///
+/// @brief ThreadPool task that reduces one chunk and folds the result into
+/// the job's running result.
+static void alReduceTask(size_t taskIndex, void *context) {
+    ALScanJob *job = (ALScanJob*) context;
+    const int *array = job->array;
+    size_t start = taskIndex * job->chunkSize;
+    size_t end = (job->count - start < job->chunkSize)
+        ? job->count : start + job->chunkSize;
+
+    if (job->op == AL_REDUCE_SUM) {
+        long long sum = 0;
+        for (size_t ii = start; ii < end; ii++) {
+            sum += array[ii];
+        }
+        atomic_fetch_add_explicit(&job->result, sum, memory_order_relaxed);
+        return;
+    }
+
+    int extreme = array[start];
+    if (job->op == AL_REDUCE_MIN) {
+        for (size_t ii = start + 1; ii < end; ii++) {
+            extreme = (array[ii] < extreme) ? array[ii] : extreme;
+        }
+    } else {
+        for (size_t ii = start + 1; ii < end; ii++) {
+            extreme = (array[ii] > extreme) ? array[ii] : extreme;
+        }
+    }
+
+    long long current = atomic_load_explicit(&job->result,
+        memory_order_relaxed);
+    while (((job->op == AL_REDUCE_MIN) ? (extreme < current)
+            : (extreme > current))
+        && !atomic_compare_exchange_weak_explicit(&job->result, &current,
+            extreme, memory_order_relaxed, memory_order_relaxed)
+    ) {
+        // current was reloaded by the failed exchange
+    }
+}
+
+/// @fn ptrdiff_t arrayListParallelSearch(ArrayList *arrayList, int value,
+///   ThreadPool *threadPool)
+///
+/// @brief Find the first occurrence of a value in an ArrayList using every
+/// thread of a pool.
+///
+/// @param arrayList A pointer to the ArrayList to search.
+/// @param value The value to search for.
+/// @param threadPool The pool to search with, or NULL to search on the
+///   calling thread.
+///
+/// @note Threads stop scanning once a match has been found earlier in the
+/// array than where they are, so a value near the front is found quickly.
+/// Sorted and frozen ArrayLists are binary searched on the calling thread.
+///
+/// @return Returns the index of the first occurrence of the value, or -1 if
+/// the value was not found.
+ptrdiff_t arrayListParallelSearch(ArrayList *arrayList, int value,
+    ThreadPool *threadPool
+) {
+    if (arrayList == NULL) {
+        return -1;
+    } else if (arrayList->layout != AL_LAYOUT_UNSORTED) {
+        return arrayListSearch(arrayList, value);
+    }
+
+    ThreadPool *pool = alParallelPool(arrayList, threadPool);
+    ALScanJob job;
+    size_t numTasks = alScanJobInit(&job, arrayList, pool);
+    job.value = value;
+    threadPoolRun(pool, numTasks, alFindTask, &job);
+
+    size_t found = atomic_load(&job.found);
+    if (found == job.count) {
+        // value not found
+        return -1;
+    }
+
+    return (ptrdiff_t) found;
+}
+
+/// @fn ptrdiff_t arrayListParallelCount(ArrayList *arrayList, int value,
+///   ThreadPool *threadPool)
+///
+/// @brief Count how many times a value appears in an ArrayList using every
+/// thread of a pool.
+///
+/// @param arrayList A pointer to the ArrayList to search.
+/// @param value The value to count.
+/// @param threadPool The pool to count with, or NULL to count on the calling
+///   thread.
+///
+/// @return Returns the number of times the value appears on success, -1 on
+/// failure.
+ptrdiff_t arrayListParallelCount(ArrayList *arrayList, int value,
+    ThreadPool *threadPool
+) {
+    if (arrayList == NULL) {
+        return -1;
+    } else if (arrayList->layout != AL_LAYOUT_UNSORTED) {
+        return arrayListCount(arrayList, value);
+    }
+
+    ThreadPool *pool = alParallelPool(arrayList, threadPool);
+    ALScanJob job;
+    size_t numTasks = alScanJobInit(&job, arrayList, pool);
+    job.value = value;
+    threadPoolRun(pool, numTasks, alCountTask, &job);
+
+    return (ptrdiff_t) atomic_load(&job.result);
+}
+
+/// @fn int arrayListParallelReduce(ArrayList *arrayList, ALReduceOp op,
+///   long long *result, ThreadPool *threadPool)
+///
+/// @brief Compute the sum, minimum or maximum of an ArrayList using every
+/// thread of a pool.
+///
+/// @param arrayList A pointer to the ArrayList to reduce.
+/// @param op The reduction to compute.
+/// @param result Set to the result on success.
+/// @param threadPool The pool to reduce with, or NULL to reduce on the calling
+///   thread.
+///
+/// @note The sum of an empty ArrayList is 0.  The minimum and maximum of a
+/// sorted ArrayList are read off its ends without scanning.
+///
+/// @return Returns 0 on success, -1 on failure or if the minimum or maximum of
+/// an empty ArrayList was asked for.
+int arrayListParallelReduce(ArrayList *arrayList, ALReduceOp op,
+    long long *result, ThreadPool *threadPool
+) {
+    if ((arrayList == NULL) || (result == NULL)) {
+        return -1;
+    } else if ((op != AL_REDUCE_SUM) && (op != AL_REDUCE_MIN)
+        && (op != AL_REDUCE_MAX)
+    ) {
+        return -1;
+    }
+
+    size_t listSize = arrayList->listSize;
+    if (listSize == 0) {
+        *result = 0;
+        return (op == AL_REDUCE_SUM) ? 0 : -1;
+    } else if ((arrayList->layout == AL_LAYOUT_SORTED)
+        && (op != AL_REDUCE_SUM)
+    ) {
+        *result = (op == AL_REDUCE_MIN)
+            ? arrayList->array[0] : arrayList->array[listSize - 1];
+        return 0;
+    }
+
+    ThreadPool *pool = alParallelPool(arrayList, threadPool);
+    ALScanJob job;
+    size_t numTasks = alScanJobInit(&job, arrayList, pool);
+    job.op = op;
+    if (op != AL_REDUCE_SUM) {
+        // Any element is a valid starting point for a minimum or maximum
+        atomic_store(&job.result, arrayList->array[0]);
+    }
+    threadPoolRun(pool, numTasks, alReduceTask, &job);
+
+    *result = atomic_load(&job.result);
+
+    return 0;
+}
+
+// Parallel sample sort functions follow
+
+/// @fn static size_t alSortBucket(const int *splitters, size_t numSplitters,
+///   int value)
+///
+/// @brief Get the bucket a value belongs in.
+///
+/// @return Returns the number of splitters less than or equal to value, so
+/// equal values always share a bucket.
+static size_t alSortBucket(const int *splitters, size_t numSplitters,
+    int value
+) {
+    size_t low = 0;
+    size_t high = numSplitters;
+    while (low < high) {
+        size_t middle = low + ((high - low) / 2);
+        if (splitters[middle] <= value) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/// @fn static void alSortHistogramTask(size_t taskIndex, void *context)
+///
+/// @brief ThreadPool task that counts how many elements of one chunk fall in
+/// each bucket.
+static void alSortHistogramTask(size_t taskIndex, void *context) {
+    ALSortJob *job = (ALSortJob*) context;
+    size_t numBuckets = job->numChunks;
+    size_t *counts = &job->offsets[taskIndex * numBuckets];
+    size_t start = taskIndex * job->chunkSize;
+    size_t end = (job->count - start < job->chunkSize)
+        ? job->count : start + job->chunkSize;
+
+    memset(counts, 0, numBuckets * sizeof(size_t));
+    for (size_t ii = start; ii < end; ii++) {
+        counts[alSortBucket(job->splitters, numBuckets - 1, job->array[ii])]++;
+    }
+}
+
+/// @fn static void alSortScatterTask(size_t taskIndex, void *context)
+///
+/// @brief ThreadPool task that copies every element of one chunk to its
+/// bucket's region of scratch.
+static void alSortScatterTask(size_t taskIndex, void *context) {
+    ALSortJob *job = (ALSortJob*) context;
+    size_t numBuckets = job->numChunks;
+    size_t *offsets = &job->offsets[taskIndex * numBuckets];
+    size_t start = taskIndex * job->chunkSize;
+    size_t end = (job->count - start < job->chunkSize)
+        ? job->count : start + job->chunkSize;
+
+    for (size_t ii = start; ii < end; ii++) {
+        int value = job->array[ii];
+        job->scratch[offsets[alSortBucket(job->splitters, numBuckets - 1,
+            value)]++] = value;
+    }
+}
+
+/// @fn static void alSortBucketTask(size_t taskIndex, void *context)
+///
+/// @brief ThreadPool task that sorts one bucket and copies it back into the
+/// array, where it is already in its final position.
+static void alSortBucketTask(size_t taskIndex, void *context) {
+    ALSortJob *job = (ALSortJob*) context;
+    size_t start = job->bucketStarts[taskIndex];
+    size_t count = job->bucketStarts[taskIndex + 1] - start;
+
+    qsort(&job->scratch[start], count, sizeof(int), compareInts);
+    memcpy(&job->array[start], &job->scratch[start], count * sizeof(int));
+}
+
+/// @fn int arrayListParallelSort(ArrayList *arrayList, ThreadPool *threadPool)
+///
+/// @brief Sort an ArrayList in ascending order using every thread of a pool
+/// and keep it sorted from then on.
+///
+/// @param arrayList A pointer to the ArrayList to sort.
+/// @param threadPool The pool to sort with, or NULL to sort on the calling
+///   thread.
+///
+/// @note This is a sample sort.  Splitters chosen from a sorted sample divide
+/// the elements into one bucket per chunk, the chunks are scattered into their
+/// buckets in parallel, and the buckets are sorted in parallel.  It needs a
+/// scratch buffer as big as the array from the list's allocator and falls
+/// back to arrayListSort if it can't get one.  Lists dominated by one value
+/// put most elements in one bucket and sort mostly on one thread.
+///
+/// @return Returns 0 on success, -1 on failure.
+int arrayListParallelSort(ArrayList *arrayList, ThreadPool *threadPool) {
+    if (arrayList == NULL) {
+        return -1;
+    }
+
+    ThreadPool *pool = alParallelPool(arrayList, threadPool);
+    if ((pool == NULL) || (arrayList->layout != AL_LAYOUT_UNSORTED)) {
+        return arrayListSort(arrayList);
+    }
+
+    ALSortJob job;
+    job.array = arrayList->array;
+    job.count = arrayList->listSize;
+    job.chunkSize = alParallelChunkSize(job.count, pool);
+    job.numChunks = (job.count + job.chunkSize - 1) / job.chunkSize;
+
+    size_t numBuckets = job.numChunks;
+    size_t numSamples = numBuckets * AL_SORT_OVERSAMPLE;
+    size_t scratchBytes = job.count * sizeof(int);
+    size_t sampleBytes = numSamples * sizeof(int);
+    size_t offsetBytes = numBuckets * numBuckets * sizeof(size_t);
+    size_t startBytes = (numBuckets + 1) * sizeof(size_t);
+    const Allocator *allocator = &arrayList->allocator;
+    job.scratch = (int*) allocatorAlloc(allocator, scratchBytes);
+    int *samples = (int*) allocatorAlloc(allocator, sampleBytes);
+    job.offsets = (size_t*) allocatorAlloc(allocator, offsetBytes);
+    job.bucketStarts = (size_t*) allocatorAlloc(allocator, startBytes);
+
+    int status = -1;
+    if ((job.scratch != NULL) && (samples != NULL) && (job.offsets != NULL)
+        && (job.bucketStarts != NULL)
+    ) {
+        // Take one sample from a scrambled position in each stride, so that
+        // periodic data can't fool an evenly spaced sample
+        size_t stride = job.count / numSamples;
+        for (size_t ii = 0; ii < numSamples; ii++) {
+            uint64_t scramble = ((uint64_t) ii * 0x9E3779B97F4A7C15ull) >> 32;
+            samples[ii] = job.array[(ii * stride) + (scramble % stride)];
+        }
+        qsort(samples, numSamples, sizeof(int), compareInts);
+        for (size_t ii = 0; ii + 1 < numBuckets; ii++) {
+            samples[ii] = samples[(ii + 1) * AL_SORT_OVERSAMPLE];
+        }
+        job.splitters = samples;
+
+        threadPoolRun(pool, job.numChunks, alSortHistogramTask, &job);
+
+        // Lay the buckets out in order, and within each bucket give every
+        // chunk its own run to write into
+        size_t position = 0;
+        for (size_t bucket = 0; bucket < numBuckets; bucket++) {
+            job.bucketStarts[bucket] = position;
+            for (size_t chunk = 0; chunk < job.numChunks; chunk++) {
+                size_t *entry = &job.offsets[(chunk * numBuckets) + bucket];
+                size_t count = *entry;
+                *entry = position;
+                position += count;
+            }
+        }
+        job.bucketStarts[numBuckets] = position;
+
+        threadPoolRun(pool, job.numChunks, alSortScatterTask, &job);
+        threadPoolRun(pool, numBuckets, alSortBucketTask, &job);
+        arrayList->layout = AL_LAYOUT_SORTED;
+        status = 0;
+    }
+
+    allocatorFree(allocator, job.bucketStarts, startBytes);
+    allocatorFree(allocator, job.offsets, offsetBytes);
+    allocatorFree(allocator, samples, sampleBytes);
+    allocatorFree(allocator, job.scratch, scratchBytes);
+
+    if (status != 0) {
+        // Out of memory, but a sequential sort needs none
+        return arrayListSort(arrayList);
+    }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              ArrayListParallel.h
+///
+/// @brief             Multithreaded search, reduce and sort for big ArrayLists.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ARRAY_LIST_PARALLEL_H
+#define ARRAY_LIST_PARALLEL_H
+
+// Standard C includes
+#include <stddef.h>
+
+#include "ArrayList.h"
+#include "ThreadPool.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def AL_PARALLEL_MIN_ELEMENTS
+///
+/// @brief Smallest ArrayList the parallel functions split across threads.
+/// Below this, waking the pool costs more than it saves and the work is done
+/// on the calling thread.
+#define AL_PARALLEL_MIN_ELEMENTS ((size_t) 1 << 17)
+
+/// @enum ALReduceOp
+///
+/// @brief The reductions arrayListParallelReduce can compute.
+///
+/// @var AL_REDUCE_SUM The sum of all elements.
+/// @var AL_REDUCE_MIN The smallest element.
+/// @var AL_REDUCE_MAX The largest element.
+typedef enum ALReduceOp {
+    AL_REDUCE_SUM = 0,
+    AL_REDUCE_MIN,
+    AL_REDUCE_MAX
+} ALReduceOp;
+
+// Parallel ArrayList prototypes
+ptrdiff_t arrayListParallelSearch(ArrayList *arrayList, int value,
+    ThreadPool *threadPool);
+ptrdiff_t arrayListParallelCount(ArrayList *arrayList, int value,
+    ThreadPool *threadPool);
+int arrayListParallelReduce(ArrayList *arrayList, ALReduceOp op,
+    long long *result, ThreadPool *threadPool);
+int arrayListParallelSort(ArrayList *arrayList, ThreadPool *threadPool);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // ARRAY_LIST_PARALLEL_H
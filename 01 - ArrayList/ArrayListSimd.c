@@ -0,0 +1,644 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ArrayListSimd.c
+///
+/// @brief Vectorized search, bitmap and bit-unpacking kernels used by the
+/// ArrayList and the structures built on it, selected at runtime from the
+/// features of the CPU.
+
+// Standard C includes
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ArrayListSimd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define AL_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+/// @def COUNT_FLUSH_INTERVAL
+///
+/// @brief Number of vector iterations after which the 32-bit lane counters of
+/// the counting kernels are folded into the total so they can never overflow.
+#define COUNT_FLUSH_INTERVAL (1 << 20)
+
+/// @struct ALSimdKernels
+///
+/// @brief One complete set of search kernels for a particular instruction set.
+///
+/// @var findFirst Returns the index of the first match, or count if none.
+/// @var count Returns the number of matches.
+/// @var findAll Records the indices of up to maxIndices matches and returns
+///   the total number of matches.
+/// @var bitmapCombine Combines two bitmaps word by word and returns the
+///   number of bits set in the result.
+/// @var unpack Expands count bit-packed fields and adds base to each.
+/// @var name A human-readable name for the instruction set.
+typedef struct ALSimdKernels {
+    size_t (*findFirst)(const int*, size_t, int);
+    size_t (*count)(const int*, size_t, int);
+    size_t (*findAll)(const int*, size_t, int, size_t*, size_t);
+    size_t (*bitmapCombine)(uint64_t*, const uint64_t*, const uint64_t*,
+        size_t, ALBitmapOp);
+    void (*unpack)(const unsigned char*, unsigned, size_t, int, int*);
+    const char *name;
+} ALSimdKernels;
+
+/// @fn static inline size_t alSimdRecordMatches(unsigned long long mask,
+///   size_t base, size_t *indices, size_t maxIndices, size_t found)
+///
+/// @brief Record the index of every set bit of a comparison mask.
+///
+/// @param mask One bit per compared element, set where the element matched.
+/// @param base The index of the element that bit 0 of the mask refers to.
+/// @param indices The array to record matching indices in.
+/// @param maxIndices The number of elements indices can hold.
+/// @param found The number of matches found before this mask.
+///
+/// @return Returns the number of matches found including this mask.
+static inline size_t alSimdRecordMatches(unsigned long long mask,
+    size_t base, size_t *indices, size_t maxIndices, size_t found
+) {
+    while (mask != 0) {
+        if (found < maxIndices) {
+            indices[found] = base + (size_t) __builtin_ctzll(mask);
+        }
+        found++;
+        mask &= mask - 1;
+    }
+
+    return found;
+}
+
+// Scalar kernels.  These are used on CPUs without any of the vector
+// extensions and to finish off the elements left over by the vector kernels.
+
+static size_t scalarFindFirst(const int *array, size_t count, int value) {
+    for (size_t ii = 0; ii < count; ii++) {
+        if (array[ii] == value) {
+            return ii;
+        }
+    }
+
+    return count;
+}
+
+static size_t scalarCount(const int *array, size_t count, int value) {
+    size_t matches = 0;
+    for (size_t ii = 0; ii < count; ii++) {
+        matches += (array[ii] == value);
+    }
+
+    return matches;
+}
+
+static size_t scalarFindAll(const int *array, size_t count, int value,
+    size_t *indices, size_t maxIndices
+) {
+    size_t found = 0;
+    for (size_t ii = 0; ii < count; ii++) {
+        if (array[ii] == value) {
+            if (found < maxIndices) {
+                indices[found] = ii;
+            }
+            found++;
+        }
+    }
+
+    return found;
+}
+
+/// @fn static inline uint64_t alSimdLoad64(const unsigned char *bytes)
+///
+/// @brief Read 8 bytes as a little-endian integer, whatever the byte order of
+/// the CPU.  Compilers turn this into a single load on little-endian CPUs.
+static inline uint64_t alSimdLoad64(const unsigned char *bytes) {
+    uint64_t word = 0;
+    for (int ii = 7; ii >= 0; ii--) {
+        word = (word << 8) | bytes[ii];
+    }
+
+    return word;
+}
+
+static size_t scalarBitmapCombine(uint64_t *out, const uint64_t *a,
+    const uint64_t *b, size_t numWords, ALBitmapOp op
+) {
+    size_t bits = 0;
+    for (size_t ii = 0; ii < numWords; ii++) {
+        uint64_t word = (op == AL_BITMAP_AND) ? (a[ii] & b[ii])
+            : (op == AL_BITMAP_OR) ? (a[ii] | b[ii]) : (a[ii] & ~b[ii]);
+        out[ii] = word;
+        bits += (size_t) __builtin_popcountll(word);
+    }
+
+    return bits;
+}
+
+static void scalarUnpack(const unsigned char *packed, unsigned bitWidth,
+    size_t count, int base, int *values
+) {
+    uint64_t mask = ((uint64_t) 1 << bitWidth) - 1;
+    for (size_t ii = 0; ii < count; ii++) {
+        size_t bit = ii * bitWidth;
+        uint64_t field = (alSimdLoad64(&packed[bit >> 3]) >> (bit & 7)) & mask;
+
+        // Unsigned so that wrapping around is defined
+        values[ii] = (int) ((uint32_t) base + (uint32_t) field);
+    }
+}
+
+static const ALSimdKernels scalarKernels = {
+    scalarFindFirst, scalarCount, scalarFindAll, scalarBitmapCombine,
+    scalarUnpack, "scalar"
+};
+
+#ifdef AL_SIMD_X86
+
+// SSE2 kernels:  4 ints per compare.
+
+__attribute__((target("sse2")))
+static inline unsigned sse2Mask(const int *array, __m128i needle) {
+    __m128i eq = _mm_cmpeq_epi32(
+        _mm_loadu_si128((const __m128i*) array), needle);
+    return (unsigned) _mm_movemask_ps(_mm_castsi128_ps(eq));
+}
+
+__attribute__((target("sse2")))
+static size_t sse2FindFirst(const int *array, size_t count, int value) {
+    __m128i needle = _mm_set1_epi32(value);
+    size_t ii = 0;
+
+    // Test 16 elements per iteration and only work out which one matched
+    // once we know that one did.
+    for (; ii + 16 <= count; ii += 16) {
+        unsigned mask = sse2Mask(&array[ii], needle)
+            | (sse2Mask(&array[ii + 4], needle) << 4)
+            | (sse2Mask(&array[ii + 8], needle) << 8)
+            | (sse2Mask(&array[ii + 12], needle) << 12);
+        if (mask != 0) {
+            return ii + (size_t) __builtin_ctz(mask);
+        }
+    }
+    for (; ii + 4 <= count; ii += 4) {
+        unsigned mask = sse2Mask(&array[ii], needle);
+        if (mask != 0) {
+            return ii + (size_t) __builtin_ctz(mask);
+        }
+    }
+
+    return ii + scalarFindFirst(&array[ii], count - ii, value);
+}
+
+__attribute__((target("sse2")))
+static size_t sse2Count(const int *array, size_t count, int value) {
+    __m128i needle = _mm_set1_epi32(value);
+    size_t matches = 0;
+    size_t ii = 0;
+
+    while (ii + 4 <= count) {
+        // Each matching lane compares to -1, so subtracting the comparison
+        // result counts matches per lane.
+        __m128i lanes = _mm_setzero_si128();
+        for (size_t iterations = 0;
+            (iterations < COUNT_FLUSH_INTERVAL) && (ii + 4 <= count);
+            iterations++, ii += 4
+        ) {
+            __m128i eq = _mm_cmpeq_epi32(
+                _mm_loadu_si128((const __m128i*) &array[ii]), needle);
+            lanes = _mm_sub_epi32(lanes, eq);
+        }
+
+        int laneCounts[4];
+        _mm_storeu_si128((__m128i*) laneCounts, lanes);
+        matches += (size_t) laneCounts[0] + (size_t) laneCounts[1]
+            + (size_t) laneCounts[2] + (size_t) laneCounts[3];
+    }
+
+    return matches + scalarCount(&array[ii], count - ii, value);
+}
+
+__attribute__((target("sse2")))
+static size_t sse2FindAll(const int *array, size_t count, int value,
+    size_t *indices, size_t maxIndices
+) {
+    __m128i needle = _mm_set1_epi32(value);
+    size_t found = 0;
+    size_t ii = 0;
+
+    for (; ii + 4 <= count; ii += 4) {
+        found = alSimdRecordMatches(sse2Mask(&array[ii], needle),
+            ii, indices, maxIndices, found);
+    }
+    for (; ii < count; ii++) {
+        found = alSimdRecordMatches(array[ii] == value,
+            ii, indices, maxIndices, found);
+    }
+
+    return found;
+}
+
+static const ALSimdKernels sse2Kernels = {
+    sse2FindFirst, sse2Count, sse2FindAll, scalarBitmapCombine, scalarUnpack,
+    "sse2"
+};
+
+// AVX2 kernels:  8 ints per compare.
+
+__attribute__((target("avx2")))
+static inline unsigned avx2Mask(const int *array, __m256i needle) {
+    __m256i eq = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256((const __m256i*) array), needle);
+    return (unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+}
+
+__attribute__((target("avx2")))
+static size_t avx2FindFirst(const int *array, size_t count, int value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    size_t ii = 0;
+
+    for (; ii + 32 <= count; ii += 32) {
+        unsigned mask = avx2Mask(&array[ii], needle)
+            | (avx2Mask(&array[ii + 8], needle) << 8)
+            | (avx2Mask(&array[ii + 16], needle) << 16)
+            | (avx2Mask(&array[ii + 24], needle) << 24);
+        if (mask != 0) {
+            return ii + (size_t) __builtin_ctz(mask);
+        }
+    }
+    for (; ii + 8 <= count; ii += 8) {
+        unsigned mask = avx2Mask(&array[ii], needle);
+        if (mask != 0) {
+            return ii + (size_t) __builtin_ctz(mask);
+        }
+    }
+
+    return ii + scalarFindFirst(&array[ii], count - ii, value);
+}
+
+__attribute__((target("avx2")))
+static size_t avx2Count(const int *array, size_t count, int value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    size_t matches = 0;
+    size_t ii = 0;
+
+    while (ii + 8 <= count) {
+        __m256i lanes = _mm256_setzero_si256();
+        for (size_t iterations = 0;
+            (iterations < COUNT_FLUSH_INTERVAL) && (ii + 8 <= count);
+            iterations++, ii += 8
+        ) {
+            __m256i eq = _mm256_cmpeq_epi32(
+                _mm256_loadu_si256((const __m256i*) &array[ii]), needle);
+            lanes = _mm256_sub_epi32(lanes, eq);
+        }
+
+        int laneCounts[8];
+        _mm256_storeu_si256((__m256i*) laneCounts, lanes);
+        for (int lane = 0; lane < 8; lane++) {
+            matches += (size_t) laneCounts[lane];
+        }
+    }
+
+    return matches + scalarCount(&array[ii], count - ii, value);
+}
+
+__attribute__((target("avx2")))
+static size_t avx2FindAll(const int *array, size_t count, int value,
+    size_t *indices, size_t maxIndices
+) {
+    __m256i needle = _mm256_set1_epi32(value);
+    size_t found = 0;
+    size_t ii = 0;
+
+    for (; ii + 8 <= count; ii += 8) {
+        found = alSimdRecordMatches(avx2Mask(&array[ii], needle),
+            ii, indices, maxIndices, found);
+    }
+    for (; ii < count; ii++) {
+        found = alSimdRecordMatches(array[ii] == value,
+            ii, indices, maxIndices, found);
+    }
+
+    return found;
+}
+
+// Counts bits a nibble at a time with a shuffle table lookup, then adds the
+// byte counts up per 64-bit lane with a sum of absolute differences (Mula's
+// method).  Lane totals can't overflow for any bitmap that fits in memory.
+__attribute__((target("avx2")))
+static size_t avx2BitmapCombine(uint64_t *out, const uint64_t *a,
+    const uint64_t *b, size_t numWords, ALBitmapOp op
+) {
+    const __m256i table = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+    __m256i totals = _mm256_setzero_si256();
+    size_t ii = 0;
+
+    for (; ii + 4 <= numWords; ii += 4) {
+        __m256i left = _mm256_loadu_si256((const __m256i*) &a[ii]);
+        __m256i right = _mm256_loadu_si256((const __m256i*) &b[ii]);
+        __m256i word = (op == AL_BITMAP_AND) ? _mm256_and_si256(left, right)
+            : (op == AL_BITMAP_OR) ? _mm256_or_si256(left, right)
+            : _mm256_andnot_si256(right, left);
+        _mm256_storeu_si256((__m256i*) &out[ii], word);
+
+        __m256i counts = _mm256_add_epi8(
+            _mm256_shuffle_epi8(table, _mm256_and_si256(word, lowNibbles)),
+            _mm256_shuffle_epi8(table,
+                _mm256_and_si256(_mm256_srli_epi16(word, 4), lowNibbles)));
+        totals = _mm256_add_epi64(totals,
+            _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+    }
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*) lanes, totals);
+    size_t bits = (size_t) (lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+
+    return bits + scalarBitmapCombine(&out[ii], &a[ii], &b[ii],
+        numWords - ii, op);
+}
+
+/// @def AVX2_UNPACK_SEGMENT
+///
+/// @brief Most fields avx2Unpack expands before moving its base pointer up, so
+/// that the 32-bit bit offsets it gathers with can't overflow.
+#define AVX2_UNPACK_SEGMENT ((size_t) 1 << 20)
+
+// Each lane gathers the 4 bytes its field starts in and shifts the field down
+// by at most 7 bits, so fields of up to 25 bits fit.  Wider ones are rare
+// enough to leave to the scalar kernel.
+__attribute__((target("avx2")))
+static void avx2Unpack(const unsigned char *packed, unsigned bitWidth,
+    size_t count, int base, int *values
+) {
+    if (bitWidth > 25) {
+        scalarUnpack(packed, bitWidth, count, base, values);
+        return;
+    }
+
+    __m256i firstBits = _mm256_mullo_epi32(
+        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+        _mm256_set1_epi32((int) bitWidth));
+    __m256i step = _mm256_set1_epi32((int) (8 * bitWidth));
+    __m256i mask = _mm256_set1_epi32((int) ((1u << bitWidth) - 1));
+    __m256i baseVector = _mm256_set1_epi32(base);
+    __m256i seven = _mm256_set1_epi32(7);
+
+    while (count >= 8) {
+        size_t segment = (count < AVX2_UNPACK_SEGMENT)
+            ? (count & ~(size_t) 7) : AVX2_UNPACK_SEGMENT;
+        __m256i bits = firstBits;
+        for (size_t ii = 0; ii < segment; ii += 8) {
+            __m256i words = _mm256_i32gather_epi32((const int*) packed,
+                _mm256_srli_epi32(bits, 3), 1);
+            __m256i fields = _mm256_and_si256(_mm256_srlv_epi32(words,
+                _mm256_and_si256(bits, seven)), mask);
+            _mm256_storeu_si256((__m256i*) &values[ii],
+                _mm256_add_epi32(fields, baseVector));
+            bits = _mm256_add_epi32(bits, step);
+        }
+
+        // segment is a multiple of 8, so the next field starts on a byte
+        packed += (segment * bitWidth) / 8;
+        values += segment;
+        count -= segment;
+    }
+
+    scalarUnpack(packed, bitWidth, count, base, values);
+}
+
+static const ALSimdKernels avx2Kernels = {
+    avx2FindFirst, avx2Count, avx2FindAll, avx2BitmapCombine, avx2Unpack,
+    "avx2"
+};
+
+// AVX-512 kernels:  16 ints per compare, straight into a mask register.
+
+__attribute__((target("avx512f")))
+static inline unsigned long long avx512Mask(const int *array, __m512i needle) {
+    return (unsigned long long) _mm512_cmpeq_epi32_mask(
+        _mm512_loadu_si512((const void*) array), needle);
+}
+
+__attribute__((target("avx512f")))
+static size_t avx512FindFirst(const int *array, size_t count, int value) {
+    __m512i needle = _mm512_set1_epi32(value);
+    size_t ii = 0;
+
+    for (; ii + 64 <= count; ii += 64) {
+        unsigned long long mask = avx512Mask(&array[ii], needle)
+            | (avx512Mask(&array[ii + 16], needle) << 16)
+            | (avx512Mask(&array[ii + 32], needle) << 32)
+            | (avx512Mask(&array[ii + 48], needle) << 48);
+        if (mask != 0) {
+            return ii + (size_t) __builtin_ctzll(mask);
+        }
+    }
+    for (; ii + 16 <= count; ii += 16) {
+        unsigned long long mask = avx512Mask(&array[ii], needle);
+        if (mask != 0) {
+            return ii + (size_t) __builtin_ctzll(mask);
+        }
+    }
+
+    return ii + scalarFindFirst(&array[ii], count - ii, value);
+}
+
+__attribute__((target("avx512f,popcnt")))
+static size_t avx512Count(const int *array, size_t count, int value) {
+    __m512i needle = _mm512_set1_epi32(value);
+    size_t matches = 0;
+    size_t ii = 0;
+
+    for (; ii + 16 <= count; ii += 16) {
+        matches += (size_t) __builtin_popcountll(avx512Mask(&array[ii], needle));
+    }
+
+    return matches + scalarCount(&array[ii], count - ii, value);
+}
+
+__attribute__((target("avx512f")))
+static size_t avx512FindAll(const int *array, size_t count, int value,
+    size_t *indices, size_t maxIndices
+) {
+    __m512i needle = _mm512_set1_epi32(value);
+    size_t found = 0;
+    size_t ii = 0;
+
+    for (; ii + 16 <= count; ii += 16) {
+        found = alSimdRecordMatches(avx512Mask(&array[ii], needle),
+            ii, indices, maxIndices, found);
+    }
+    for (; ii < count; ii++) {
+        found = alSimdRecordMatches(array[ii] == value,
+            ii, indices, maxIndices, found);
+    }
+
+    return found;
+}
+
+static const ALSimdKernels avx512Kernels = {
+    avx512FindFirst, avx512Count, avx512FindAll, avx2BitmapCombine,
+    avx2Unpack, "avx512"
+};
+
+#endif // AL_SIMD_X86
+
+/// @var selectedKernels
+///
+/// @brief The kernels picked for the running CPU, or NULL until the first call.
+static _Atomic(const ALSimdKernels*) selectedKernels = NULL;
+
+/// @fn static const ALSimdKernels* alSimdKernels(void)
+///
+/// @brief Get the best set of kernels for the running CPU, selecting them on
+/// the first call.
+///
+/// @note Two threads racing through the first call will both select the same
+/// kernels, so no further synchronization is needed.
+///
+/// @return Returns a pointer to the selected kernels.  Never NULL.
+static const ALSimdKernels* alSimdKernels(void) {
+    const ALSimdKernels *kernels =
+        atomic_load_explicit(&selectedKernels, memory_order_relaxed);
+    if (kernels != NULL) {
+        return kernels;
+    }
+
+    kernels = &scalarKernels;
+#ifdef AL_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        kernels = &avx512Kernels;
+    } else if (__builtin_cpu_supports("avx2")) {
+        kernels = &avx2Kernels;
+    } else if (__builtin_cpu_supports("sse2")) {
+        kernels = &sse2Kernels;
+    }
+#endif
+
+    atomic_store_explicit(&selectedKernels, kernels, memory_order_relaxed);
+
+    return kernels;
+}
+
+/// @fn size_t alSimdFindFirst(const int *array, size_t count, int value)
+///
+/// @brief Find the first element of an array equal to a value.
+///
+/// @param array A pointer to the first element to search.
+/// @param count The number of elements to search.
+/// @param value The value to search for.
+///
+/// @return Returns the index of the first match, or count if there is none.
+size_t alSimdFindFirst(const int *array, size_t count, int value) {
+    return alSimdKernels()->findFirst(array, count, value);
+}
+
+/// @fn size_t alSimdCount(const int *array, size_t count, int value)
+///
+/// @brief Count the elements of an array equal to a value.
+///
+/// @param array A pointer to the first element to search.
+/// @param count The number of elements to search.
+/// @param value The value to count.
+///
+/// @return Returns the number of matching elements.
+size_t alSimdCount(const int *array, size_t count, int value) {
+    return alSimdKernels()->count(array, count, value);
+}
+
+/// @fn size_t alSimdFindAll(const int *array, size_t count, int value,
+///   size_t *indices, size_t maxIndices)
+///
+/// @brief Find every element of an array equal to a value.
+///
+/// @param array A pointer to the first element to search.
+/// @param count The number of elements to search.
+/// @param value The value to search for.
+/// @param indices The array to record the indices of the matches in, in
+///   ascending order.  May be NULL if maxIndices is 0.
+/// @param maxIndices The number of elements indices can hold.
+///
+/// @return Returns the total number of matches, which may be more than were
+/// recorded in indices.
+size_t alSimdFindAll(const int *array, size_t count, int value,
+    size_t *indices, size_t maxIndices
+) {
+    return alSimdKernels()->findAll(array, count, value, indices, maxIndices);
+}
+
+/// @fn size_t alSimdBitmapCombine(uint64_t *out, const uint64_t *a,
+///   const uint64_t *b, size_t numWords, ALBitmapOp op)
+///
+/// @brief Combine two bitmaps word by word and count the result's bits.
+///
+/// @param out The numWords words to store the result in.  May be a or b.
+/// @param a The first bitmap.
+/// @param b The second bitmap.
+/// @param numWords The number of 64-bit words in each bitmap.
+/// @param op How to combine them.
+///
+/// @return Returns the number of bits set in out.
+size_t alSimdBitmapCombine(uint64_t *out, const uint64_t *a,
+    const uint64_t *b, size_t numWords, ALBitmapOp op
+) {
+    return alSimdKernels()->bitmapCombine(out, a, b, numWords, op);
+}
+
+/// @fn void alSimdUnpack(const unsigned char *packed, unsigned bitWidth,
+///   size_t count, int base, int *values)
+///
+/// @brief Expand an array of bit-packed unsigned fields.
+///
+/// @param packed The fields, bitWidth bits each, packed with no gaps starting
+///   at bit 0 of packed[0] and going from the low bits of each byte to the
+///   high bits.  Must be followed by AL_SIMD_UNPACK_PADDING readable bytes.
+/// @param bitWidth The number of bits in each field, at most 32.
+/// @param count The number of fields to expand.
+/// @param base Added to every field, wrapping around like unsigned math.
+/// @param values The array to store the count results in.
+void alSimdUnpack(const unsigned char *packed, unsigned bitWidth,
+    size_t count, int base, int *values
+) {
+    alSimdKernels()->unpack(packed, bitWidth, count, base, values);
+}
+
+/// @fn const char* alSimdKernelName(void)
+///
+/// @brief Get the name of the instruction set the kernels are using.
+///
+/// @return Returns a static string such as "avx2" or "scalar".
+const char* alSimdKernelName(void) {
+    return alSimdKernels()->name;
+}
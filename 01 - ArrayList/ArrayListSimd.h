@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              ArrayListSimd.h
+///
+/// @brief             Vectorized search kernels used by the ArrayList.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARRAY_LIST_SIMD_H
+#define ARRAY_LIST_SIMD_H
+
+// Standard C includes
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def AL_SIMD_UNPACK_PADDING
+///
+/// @brief Bytes alSimdUnpack may read past the last packed bit.  Buffers it
+/// reads from must be allocated at least this much bigger than their data.
+#define AL_SIMD_UNPACK_PADDING 8
+
+/// @enum ALBitmapOp
+///
+/// @brief How alSimdBitmapCombine combines two bitmaps.
+///
+/// @var AL_BITMAP_AND Bits set in both.
+/// @var AL_BITMAP_OR Bits set in either.
+/// @var AL_BITMAP_ANDNOT Bits set in the first but not the second.
+typedef enum ALBitmapOp {
+    AL_BITMAP_AND = 0,
+    AL_BITMAP_OR,
+    AL_BITMAP_ANDNOT
+} ALBitmapOp;
+
+// The kernels below pick the widest instruction set the running CPU supports
+// (AVX-512, AVX2, SSE2) the first time they are called and fall back to plain
+// scalar loops everywhere else.
+
+// ArrayList search kernel prototypes
+size_t alSimdFindFirst(const int *array, size_t count, int value);
+size_t alSimdCount(const int *array, size_t count, int value);
+size_t alSimdFindAll(const int *array, size_t count, int value,
+    size_t *indices, size_t maxIndices);
+const char* alSimdKernelName(void);
+
+// Bitmap kernel prototypes
+size_t alSimdBitmapCombine(uint64_t *out, const uint64_t *a,
+    const uint64_t *b, size_t numWords, ALBitmapOp op);
+
+// Bit-unpacking kernel prototypes
+void alSimdUnpack(const unsigned char *packed, unsigned bitWidth,
+    size_t count, int base, int *values);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // ARRAY_LIST_SIMD_H
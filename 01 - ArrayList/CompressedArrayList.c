@@ -0,0 +1,588 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file CompressedArrayList.c
+///
+/// @brief Library implementation of the CompressedArrayList.
+///
+/// The list is cut into blocks of CA_BLOCK_SIZE elements and each block is
+/// stored whichever of three ways is smallest for it:  bit-packed offsets
+/// from its min (frame of reference), bit-packed differences between
+/// neighbours (for sorted runs), or varints (when a few outliers would make
+/// every packed field wide).  Block headers are kept apart from the data so
+/// that a lookup can skip from header to header and only decode the blocks
+/// whose [min, max] could hold what it wants.  Packed blocks decode with the
+/// SIMD kernel from ArrayListSimd.
+
+// Standard C includes
+#include <stdint.h>
+#include <string.h>
+
+#include "ArrayListSimd.h"
+#include "CompressedArrayList.h"
+
+/// @fn static uint64_t caLoad64(const unsigned char *bytes)
+///
+/// @brief Read 8 bytes as a little-endian integer.
+static uint64_t caLoad64(const unsigned char *bytes) {
+    uint64_t word = 0;
+    for (int ii = 7; ii >= 0; ii--) {
+        word = (word << 8) | bytes[ii];
+    }
+
+    return word;
+}
+
+/// @fn static void caStore64(unsigned char *bytes, uint64_t word)
+///
+/// @brief Write an integer as 8 little-endian bytes.
+static void caStore64(unsigned char *bytes, uint64_t word) {
+    for (int ii = 0; ii < 8; ii++) {
+        bytes[ii] = (unsigned char) (word >> (8 * ii));
+    }
+}
+
+/// @fn static unsigned caBitWidth(uint32_t value)
+///
+/// @brief Get the number of bits needed to store a value.
+///
+/// @return Returns 0 for 0, otherwise the position of the highest set bit
+/// plus one.
+static unsigned caBitWidth(uint32_t value) {
+    return (value == 0) ? 0 : 32 - (unsigned) __builtin_clz(value);
+}
+
+/// @fn static size_t caVarintBytes(uint32_t value)
+///
+/// @brief Get the number of bytes a value takes as a varint.
+static size_t caVarintBytes(uint32_t value) {
+    size_t bytes = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        bytes++;
+    }
+
+    return bytes;
+}
+
+/// @fn static size_t caPlanBlock(const int *values, size_t count,
+///   CABlock *block)
+///
+/// @brief Choose the encoding of one block and fill in its header, all but
+/// offset.
+///
+/// @note Differences are taken in unsigned math, so a block spanning the
+/// whole int range still works.  Ties go to CA_ENCODING_PACKED, which is the
+/// only encoding that can read one element without decoding the others.
+///
+/// @return Returns the number of bytes the block will take in data.
+static size_t caPlanBlock(const int *values, size_t count, CABlock *block) {
+    int min = values[0];
+    int max = values[0];
+    int nondecreasing = 1;
+    uint32_t maxDelta = 0;
+    for (size_t ii = 1; ii < count; ii++) {
+        min = (values[ii] < min) ? values[ii] : min;
+        max = (values[ii] > max) ? values[ii] : max;
+        if (values[ii] < values[ii - 1]) {
+            nondecreasing = 0;
+        } else {
+            uint32_t delta = (uint32_t) values[ii] - (uint32_t) values[ii - 1];
+            maxDelta = (delta > maxDelta) ? delta : maxDelta;
+        }
+    }
+
+    size_t varintBytes = 0;
+    for (size_t ii = 0; ii < count; ii++) {
+        varintBytes += caVarintBytes((uint32_t) values[ii] - (uint32_t) min);
+    }
+
+    block->min = min;
+    block->max = max;
+    block->encoding = CA_ENCODING_PACKED;
+    block->bitWidth
+        = (unsigned char) caBitWidth((uint32_t) max - (uint32_t) min);
+    size_t bytes = ((count * block->bitWidth) + 7) / 8;
+
+    if (nondecreasing) {
+        unsigned deltaWidth = caBitWidth(maxDelta);
+        size_t deltaBytes = ((count * deltaWidth) + 7) / 8;
+        if (deltaBytes < bytes) {
+            block->encoding = CA_ENCODING_DELTA;
+            block->bitWidth = (unsigned char) deltaWidth;
+            bytes = deltaBytes;
+        }
+    }
+    if (varintBytes < bytes) {
+        block->encoding = CA_ENCODING_VARINT;
+        block->bitWidth = 0;
+        bytes = varintBytes;
+    }
+
+    return bytes;
+}
+
+/// @fn static void caEncodeBlock(unsigned char *out, const int *values,
+///   size_t count, const CABlock *block)
+///
+/// @brief Write one planned block.
+///
+/// @param out Where the block goes.  Must be zeroed and, for the packed
+///   encodings, followed by 8 writable bytes.
+static void caEncodeBlock(unsigned char *out, const int *values,
+    size_t count, const CABlock *block
+) {
+    if (block->encoding == CA_ENCODING_VARINT) {
+        for (size_t ii = 0; ii < count; ii++) {
+            uint32_t field = (uint32_t) values[ii] - (uint32_t) block->min;
+            while (field >= 0x80) {
+                *out++ = (unsigned char) (field | 0x80);
+                field >>= 7;
+            }
+            *out++ = (unsigned char) field;
+        }
+        return;
+    }
+
+    unsigned bitWidth = block->bitWidth;
+    for (size_t ii = 0; ii < count; ii++) {
+        uint32_t field = (uint32_t) values[ii] - (uint32_t) block->min;
+        if (block->encoding == CA_ENCODING_DELTA) {
+            field = (ii == 0) ? 0 : (uint32_t) values[ii]
+                - (uint32_t) values[ii - 1];
+        }
+        size_t bit = ii * bitWidth;
+        unsigned char *window = &out[bit >> 3];
+        caStore64(window, caLoad64(window) | ((uint64_t) field << (bit & 7)));
+    }
+}
+
+/// @fn static size_t caBlockCount(
+///   const CompressedArrayList *compressedArrayList, size_t block)
+///
+/// @brief Get the number of elements in a block.
+static size_t caBlockCount(const CompressedArrayList *compressedArrayList,
+    size_t block
+) {
+    size_t first = block * CA_BLOCK_SIZE;
+    size_t remaining = compressedArrayList->listSize - first;
+
+    return (remaining < CA_BLOCK_SIZE) ? remaining : CA_BLOCK_SIZE;
+}
+
+/// @fn static CompressedArrayList* caBuild(const Allocator *allocator,
+///   const int *array, size_t listSize)
+///
+/// @brief Compress an array of values into a new CompressedArrayList.
+///
+/// @return Returns a pointer to the new CompressedArrayList on success, NULL
+/// on failure.
+static CompressedArrayList* caBuild(const Allocator *allocator,
+    const int *array, size_t listSize
+) {
+    CompressedArrayList *compressedArrayList = (CompressedArrayList*)
+        allocatorCalloc(allocator, 1, sizeof(CompressedArrayList));
+    if (compressedArrayList == NULL) {
+        // Out of memory
+        return NULL;
+    }
+    compressedArrayList->allocator = *allocator;
+    compressedArrayList->listSize = listSize;
+    compressedArrayList->numBlocks
+        = (listSize + CA_BLOCK_SIZE - 1) / CA_BLOCK_SIZE;
+    compressedArrayList->sorted = 1;
+
+    for (size_t ii = 1; ii < listSize; ii++) {
+        if (array[ii] < array[ii - 1]) {
+            compressedArrayList->sorted = 0;
+            break;
+        }
+    }
+
+    compressedArrayList->blocks = (CABlock*) allocatorAlloc(allocator,
+        compressedArrayList->numBlocks * sizeof(CABlock));
+    if ((compressedArrayList->blocks == NULL)
+        && (compressedArrayList->numBlocks > 0)
+    ) {
+        return compressedArrayListDestroy(compressedArrayList);
+    }
+
+    // Plan every block first so that data can be allocated at its exact size
+    size_t dataSize = 0;
+    for (size_t block = 0; block < compressedArrayList->numBlocks; block++) {
+        CABlock *header = &compressedArrayList->blocks[block];
+        header->offset = dataSize;
+        dataSize += caPlanBlock(&array[block * CA_BLOCK_SIZE],
+            caBlockCount(compressedArrayList, block), header);
+    }
+
+    compressedArrayList->data = (unsigned char*) allocatorCalloc(allocator, 1,
+        dataSize + AL_SIMD_UNPACK_PADDING);
+    if (compressedArrayList->data == NULL) {
+        return compressedArrayListDestroy(compressedArrayList);
+    }
+    compressedArrayList->dataSize = dataSize;
+
+    for (size_t block = 0; block < compressedArrayList->numBlocks; block++) {
+        const CABlock *header = &compressedArrayList->blocks[block];
+        caEncodeBlock(&compressedArrayList->data[header->offset],
+            &array[block * CA_BLOCK_SIZE],
+            caBlockCount(compressedArrayList, block), header);
+    }
+
+    return compressedArrayList;
+}
+
+/// @fn CompressedArrayList* compressedArrayListCreate(ArrayList *arrayList)
+///
+/// @brief Create a compressed, read-only copy of an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to compress.
+///
+/// @note The ArrayList is left as it is.  A frozen one is compressed in sorted
+/// order through a temporary copy and stays frozen.  Destroy the ArrayList
+/// afterwards to actually get the memory back.  The copy is sized exactly,
+/// with none of the slack an ArrayList keeps for growth, and uses the
+/// ArrayList's allocator.
+///
+/// @return Returns a pointer to the new CompressedArrayList on success, NULL
+/// on failure.
+CompressedArrayList* compressedArrayListCreate(ArrayList *arrayList) {
+    if (arrayList == NULL) {
+        return NULL;
+    } else if (arrayList->layout != AL_LAYOUT_EYTZINGER) {
+        return caBuild(&arrayList->allocator, arrayList->array,
+            arrayList->listSize);
+    }
+
+    size_t listSize = arrayList->listSize;
+    size_t scratchBytes = (listSize > 0 ? listSize : 1) * sizeof(int);
+    int *sorted = (int*) allocatorAlloc(&arrayList->allocator, scratchBytes);
+    if (sorted == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    CompressedArrayList *compressedArrayList = NULL;
+    if (arrayListCopyTo(arrayList, sorted) == 0) {
+        compressedArrayList = caBuild(&arrayList->allocator, sorted, listSize);
+    }
+    allocatorFree(&arrayList->allocator, sorted, scratchBytes);
+    sorted = NULL;
+
+    return compressedArrayList;
+}
+
+/// @fn CompressedArrayList* compressedArrayListDestroy(
+///   CompressedArrayList *compressedArrayList)
+///
+/// @brief Release all the memory held by a compressed array list.
+///
+/// @param compressedArrayList A pointer to a previously-created
+///   CompressedArrayList.
+///
+/// @return This function always succeeds and always returns NULL.
+CompressedArrayList* compressedArrayListDestroy(
+    CompressedArrayList *compressedArrayList
+) {
+    if (compressedArrayList != NULL) {
+        // The allocator is about to be freed along with the list
+        Allocator allocator = compressedArrayList->allocator;
+
+        if (compressedArrayList->data != NULL) {
+            allocatorFree(&allocator, compressedArrayList->data,
+                compressedArrayList->dataSize + AL_SIMD_UNPACK_PADDING);
+            compressedArrayList->data = NULL;
+        }
+        allocatorFree(&allocator, compressedArrayList->blocks,
+            compressedArrayList->numBlocks * sizeof(CABlock));
+        compressedArrayList->blocks = NULL;
+        allocatorFree(&allocator, compressedArrayList,
+            sizeof(CompressedArrayList));
+        compressedArrayList = NULL;
+    }
+
+    return NULL;
+}
+
+/// @fn ArrayList* compressedArrayListDecompress(
+///   CompressedArrayList *compressedArrayList)
+///
+/// @brief Expand a compressed array list back into an ordinary ArrayList.
+///
+/// @param compressedArrayList A pointer to a previously-created
+///   CompressedArrayList.
+///
+/// @note The new ArrayList uses the same allocator.  It is marked sorted if
+/// the elements are in ascending order.
+///
+/// @return Returns a pointer to the new ArrayList on success, NULL on
+/// failure.
+ArrayList* compressedArrayListDecompress(
+    CompressedArrayList *compressedArrayList
+) {
+    if (compressedArrayList == NULL) {
+        return NULL;
+    }
+
+    ArrayList *arrayList
+        = arrayListCreateWithAllocator(&compressedArrayList->allocator);
+    if ((arrayList == NULL)
+        || (arrayListReserve(arrayList, compressedArrayList->listSize) != 0)
+    ) {
+        return arrayListDestroy(arrayList);
+    }
+
+    int values[CA_BLOCK_SIZE];
+    for (size_t block = 0; block < compressedArrayList->numBlocks; block++) {
+        size_t count = compressedArrayListDecodeBlock(compressedArrayList,
+            block, values);
+        if (arrayListInsertMany(arrayList, values, count) != 0) {
+            return arrayListDestroy(arrayList);
+        }
+    }
+    if (compressedArrayList->sorted) {
+        arrayList->layout = AL_LAYOUT_SORTED;
+    }
+
+    return arrayList;
+}
+
+/// @fn int compressedArrayListGet(CompressedArrayList *compressedArrayList,
+///   size_t index, int *value)
+///
+/// @brief Read one element of a compressed array list.
+///
+/// @param compressedArrayList A pointer to a previously-created
+///   CompressedArrayList.
+/// @param index The index of the element to read.
+/// @param value Set to the element on success.
+///
+/// @note Frame-of-reference blocks give up one element directly.  The other
+/// encodings decode the element's block.
+///
+/// @return Returns 0 on success, -1 on failure.
+int compressedArrayListGet(CompressedArrayList *compressedArrayList,
+    size_t index, int *value
+) {
+    if ((compressedArrayList == NULL) || (value == NULL)
+        || (index >= compressedArrayList->listSize)
+    ) {
+        return -1;
+    }
+
+    size_t block = index / CA_BLOCK_SIZE;
+    size_t position = index % CA_BLOCK_SIZE;
+    const CABlock *header = &compressedArrayList->blocks[block];
+    if (header->encoding == CA_ENCODING_PACKED) {
+        size_t bit = position * header->bitWidth;
+        uint64_t mask = ((uint64_t) 1 << header->bitWidth) - 1;
+        uint64_t field = (caLoad64(&compressedArrayList->data[header->offset
+            + (bit >> 3)]) >> (bit & 7)) & mask;
+        *value = (int) ((uint32_t) header->min + (uint32_t) field);
+        return 0;
+    }
+
+    int values[CA_BLOCK_SIZE];
+    compressedArrayListDecodeBlock(compressedArrayList, block, values);
+    *value = values[position];
+
+    return 0;
+}
+
+/// @fn ptrdiff_t compressedArrayListSearch(
+///   CompressedArrayList *compressedArrayList, int value)
+///
+/// @brief Find the first occurrence of a value in a compressed array list.
+///
+/// @param compressedArrayList A pointer to a previously-created
+///   CompressedArrayList.
+/// @param value The value to search for.
+///
+/// @note Only blocks whose [min, max] contains value are decoded.  When the
+/// list is sorted, that is at most one block, found by binary searching the
+/// headers.
+///
+/// @return Returns the index of the first occurrence of the value, or -1 if
+/// the value was not found.
+ptrdiff_t compressedArrayListSearch(CompressedArrayList *compressedArrayList,
+    int value
+) {
+    if (compressedArrayList == NULL) {
+        return -1;
+    }
+
+    const CABlock *blocks = compressedArrayList->blocks;
+    size_t first = 0;
+    size_t last = compressedArrayList->numBlocks;
+    if (compressedArrayList->sorted) {
+        // First block whose max is at least value
+        size_t high = last;
+        while (first < high) {
+            size_t middle = first + ((high - first) / 2);
+            if (blocks[middle].max < value) {
+                first = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        last = (first < last) ? first + 1 : last;
+    }
+
+    int values[CA_BLOCK_SIZE];
+    for (size_t block = first; block < last; block++) {
+        if ((value < blocks[block].min) || (value > blocks[block].max)) {
+            continue;
+        }
+
+        size_t count = compressedArrayListDecodeBlock(compressedArrayList,
+            block, values);
+        size_t position = alSimdFindFirst(values, count, value);
+        if (position < count) {
+            return (ptrdiff_t) ((block * CA_BLOCK_SIZE) + position);
+        }
+    }
+
+    // value not found
+    return -1;
+}
+
+/// @fn size_t compressedArrayListMemoryUsage(
+///   CompressedArrayList *compressedArrayList)
+///
+/// @brief Get the number of bytes a compressed array list takes up.
+///
+/// @param compressedArrayList A pointer to a previously-created
+///   CompressedArrayList.
+///
+/// @return Returns the bytes allocated for the list, its block headers and
+/// its data, or 0 if compressedArrayList is NULL.
+size_t compressedArrayListMemoryUsage(
+    CompressedArrayList *compressedArrayList
+) {
+    if (compressedArrayList == NULL) {
+        return 0;
+    }
+
+    return sizeof(CompressedArrayList)
+        + (compressedArrayList->numBlocks * sizeof(CABlock))
+        + compressedArrayList->dataSize + AL_SIMD_UNPACK_PADDING;
+}
+
+// Block traversal functions follow
+
+/// @fn size_t compressedArrayListDecodeBlock(
+///   CompressedArrayList *compressedArrayList, size_t block, int *values)
+///
+/// @brief Decode one block of a compressed array list.
+///
+/// @param compressedArrayList A pointer to a previously-created
+///   CompressedArrayList.
+/// @param block The index of the block, counting from 0.
+/// @param values An array of at least CA_BLOCK_SIZE ints to decode into.
+///
+/// @return Returns the number of elements decoded, 0 if block is out of
+/// range.
+size_t compressedArrayListDecodeBlock(
+    CompressedArrayList *compressedArrayList, size_t block, int *values
+) {
+    if ((compressedArrayList == NULL) || (values == NULL)
+        || (block >= compressedArrayList->numBlocks)
+    ) {
+        return 0;
+    }
+
+    const CABlock *header = &compressedArrayList->blocks[block];
+    const unsigned char *data = &compressedArrayList->data[header->offset];
+    size_t count = caBlockCount(compressedArrayList, block);
+
+    switch (header->encoding) {
+        case CA_ENCODING_PACKED:
+            alSimdUnpack(data, header->bitWidth, count, header->min, values);
+            break;
+        case CA_ENCODING_DELTA: {
+            alSimdUnpack(data, header->bitWidth, count, 0, values);
+            uint32_t running = (uint32_t) header->min;
+            for (size_t ii = 0; ii < count; ii++) {
+                running += (uint32_t) values[ii];
+                values[ii] = (int) running;
+            }
+            break;
+        }
+        case CA_ENCODING_VARINT:
+        default:
+            for (size_t ii = 0; ii < count; ii++) {
+                uint32_t field = 0;
+                for (unsigned shift = 0; ; shift += 7) {
+                    unsigned char byte = *data++;
+                    field |= (uint32_t) (byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0) {
+                        break;
+                    }
+                }
+                values[ii] = (int) ((uint32_t) header->min + field);
+            }
+            break;
+    }
+
+    return count;
+}
+
+/// @fn int compressedArrayListForEach(
+///   CompressedArrayList *compressedArrayList,
+///   void (*visit)(int value, void *context), void *context)
+///
+/// @brief Call a function for every value in a compressed array list, in
+/// order.
+///
+/// @param compressedArrayList A pointer to the CompressedArrayList to
+///   traverse.
+/// @param visit The function to call with each value.
+/// @param context An arbitrary pointer passed through to visit.
+///
+/// @note Blocks are decoded one at a time into a buffer on the stack, so the
+/// list is never expanded in memory.
+///
+/// @return Returns 0 on success, -1 on failure.
+int compressedArrayListForEach(CompressedArrayList *compressedArrayList,
+    void (*visit)(int value, void *context), void *context
+) {
+    if ((compressedArrayList == NULL) || (visit == NULL)) {
+        return -1;
+    }
+
+    int values[CA_BLOCK_SIZE];
+    for (size_t block = 0; block < compressedArrayList->numBlocks; block++) {
+        size_t count = compressedArrayListDecodeBlock(compressedArrayList,
+            block, values);
+        for (size_t ii = 0; ii < count; ii++) {
+            visit(values[ii], context);
+        }
+    }
+
+    return 0;
+}
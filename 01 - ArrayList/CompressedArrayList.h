@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              CompressedArrayList.h
+///
+/// @brief             Read-only, block-compressed copy of an ArrayList.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef COMPRESSED_ARRAY_LIST_H
+#define COMPRESSED_ARRAY_LIST_H
+
+// Standard C includes
+#include <stddef.h>
+
+#include "ArrayList.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def CA_BLOCK_SIZE
+///
+/// @brief Number of elements in every block but the last.
+#define CA_BLOCK_SIZE 128
+
+/// @enum CAEncoding
+///
+/// @brief How the elements of one block are stored.
+///
+/// @var CA_ENCODING_PACKED Frame of reference:  each element minus the
+///   block's min, in bitWidth bits.
+/// @var CA_ENCODING_DELTA Only for nondecreasing blocks:  each element minus
+///   the one before it (the first minus itself), in bitWidth bits.
+/// @var CA_ENCODING_VARINT Each element minus the block's min as a
+///   little-endian base-128 varint, for blocks where a few outliers would make
+///   bitWidth too big.
+typedef enum CAEncoding {
+    CA_ENCODING_PACKED = 0,
+    CA_ENCODING_DELTA,
+    CA_ENCODING_VARINT
+} CAEncoding;
+
+/// @struct CABlock
+///
+/// @brief The skip header of one block.  Lookups check min and max to decide
+/// whether a block needs decoding at all.
+///
+/// @var offset Where the block's bytes start in data.
+/// @var min The smallest element in the block.
+/// @var max The largest element in the block.
+/// @var encoding How the block is stored.  One of CAEncoding.
+/// @var bitWidth Bits per element for the packed encodings.
+typedef struct CABlock {
+    size_t offset;
+    int min;
+    int max;
+    unsigned char encoding;
+    unsigned char bitWidth;
+} CABlock;
+
+/// @struct CompressedArrayList
+///
+/// @brief Read-only copy of an ArrayList compressed in blocks of
+/// CA_BLOCK_SIZE elements.
+///
+/// @var data The encoded blocks, back to back.
+/// @var dataSize The number of bytes in data, not counting padding.
+/// @var blocks One header per block.
+/// @var numBlocks The number of blocks.
+/// @var listSize The number of elements.
+/// @var sorted Nonzero if the elements are in ascending order, which makes
+///   searches binary search the block headers.
+/// @var allocator Where the list gets its memory.
+typedef struct CompressedArrayList {
+    unsigned char *data;
+    size_t dataSize;
+    CABlock *blocks;
+    size_t numBlocks;
+    size_t listSize;
+    int sorted;
+    Allocator allocator;
+} CompressedArrayList;
+
+// Base CompressedArrayList prototypes
+CompressedArrayList* compressedArrayListCreate(ArrayList *arrayList);
+CompressedArrayList* compressedArrayListDestroy(
+    CompressedArrayList *compressedArrayList);
+ArrayList* compressedArrayListDecompress(
+    CompressedArrayList *compressedArrayList);
+int compressedArrayListGet(CompressedArrayList *compressedArrayList,
+    size_t index, int *value);
+ptrdiff_t compressedArrayListSearch(CompressedArrayList *compressedArrayList,
+    int value);
+size_t compressedArrayListMemoryUsage(
+    CompressedArrayList *compressedArrayList);
+
+// Block traversal prototypes
+size_t compressedArrayListDecodeBlock(
+    CompressedArrayList *compressedArrayList, size_t block, int *values);
+int compressedArrayListForEach(CompressedArrayList *compressedArrayList,
+    void (*visit)(int value, void *context), void *context);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // COMPRESSED_ARRAY_LIST_H
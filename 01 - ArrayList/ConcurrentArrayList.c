@@ -0,0 +1,591 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ConcurrentArrayList.c
+///
+/// @brief Library implementation of the ConcurrentArrayList.
+///
+/// Elements live in a buffer that is never changed once another thread could
+/// be reading it, apart from appending past the published size.  Writers take
+/// a mutex.  An append that fits writes the new elements and then publishes
+/// the new size.  An append that doesn't fit, or a removal, copies the list
+/// into a new buffer and publishes that instead (read-copy-update).  A reader
+/// loads the buffer pointer and its size and then has a snapshot that stays
+/// valid without any locking.  Unlike a plain ArrayList, whose realloc can
+/// move the array under an iterating thread, the old buffer stays where it
+/// is.
+///
+/// Replaced buffers are freed with epoch-based reclamation.  Each reader
+/// announces the global epoch in its handle while it reads.  A writer tags a
+/// replaced buffer with the epoch and then advances it, and frees the buffer
+/// once every reader has announced a later epoch or left.  Readers therefore
+/// only ever write to their own handle, which keeps them from fighting over
+/// cache lines.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <limits.h>
+#include <pthread.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ArrayListSimd.h"
+#include "ConcurrentArrayList.h"
+
+/// @def CACHE_LINE_SIZE
+///
+/// @brief Alignment used to keep each reader's epoch on its own cache line.
+#define CACHE_LINE_SIZE 64
+
+/// @def MIN_CAPACITY
+///
+/// @brief Fewest elements a buffer is created with.
+#define MIN_CAPACITY 16
+
+/// @def QUIESCENT
+///
+/// @brief The epoch a handle announces when its thread isn't reading.  Real
+/// epochs start at 1.
+#define QUIESCENT 0
+
+/// @struct CALBuffer
+///
+/// @brief One version of the elements of a ConcurrentArrayList.
+///
+/// @param size The number of elements published so far.  Only grows, and
+///   stops changing once the buffer has been replaced.
+/// @param capacity The number of elements values can hold.
+/// @param retiredEpoch The global epoch when the buffer was replaced.
+/// @param nextRetired The next buffer waiting to be freed.
+/// @param values The elements.
+typedef struct CALBuffer {
+    atomic_size_t size;
+    size_t capacity;
+    unsigned long long retiredEpoch;
+    struct CALBuffer *nextRetired;
+    int values[];
+} CALBuffer;
+
+struct CALHandle {
+    alignas(CACHE_LINE_SIZE) atomic_ullong epoch;
+    atomic_int active;
+    ConcurrentArrayList *list;
+    CALHandle *nextHandle;
+};
+
+struct ConcurrentArrayList {
+    alignas(CACHE_LINE_SIZE) _Atomic(CALBuffer*) current;
+    atomic_ullong epoch;
+    _Atomic(CALHandle*) handles;
+    alignas(CACHE_LINE_SIZE) pthread_mutex_t writeLock;
+    atomic_size_t size;
+    CALBuffer *retired;
+};
+
+/// @fn static CALBuffer* calBufferCreate(size_t capacity)
+///
+/// @brief Allocate an empty buffer.
+///
+/// @return Returns a pointer to the new buffer on success, NULL on failure.
+static CALBuffer* calBufferCreate(size_t capacity) {
+    if (capacity > ((SIZE_MAX - sizeof(CALBuffer)) / sizeof(int))) {
+        // Can't be allocated
+        return NULL;
+    }
+
+    CALBuffer *buffer =
+        (CALBuffer*) malloc(sizeof(CALBuffer) + (capacity * sizeof(int)));
+    if (buffer == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    atomic_init(&buffer->size, 0);
+    buffer->capacity = capacity;
+    buffer->retiredEpoch = 0;
+    buffer->nextRetired = NULL;
+
+    return buffer;
+}
+
+/// @fn static void calReclaim(ConcurrentArrayList *concurrentArrayList)
+///
+/// @brief Free every replaced buffer that no reader can still be using.
+///
+/// @note Must be called with writeLock held.
+static void calReclaim(ConcurrentArrayList *concurrentArrayList) {
+    // A reader that announced epoch e may be holding any buffer replaced at
+    // epoch e or later
+    unsigned long long oldest = ULLONG_MAX;
+    for (CALHandle *cur = atomic_load(&concurrentArrayList->handles);
+        cur != NULL;
+        cur = cur->nextHandle
+    ) {
+        unsigned long long epoch = atomic_load(&cur->epoch);
+        if ((epoch != QUIESCENT) && (epoch < oldest)) {
+            oldest = epoch;
+        }
+    }
+
+    CALBuffer **link = &concurrentArrayList->retired;
+    while (*link != NULL) {
+        CALBuffer *buffer = *link;
+        if (buffer->retiredEpoch < oldest) {
+            *link = buffer->nextRetired;
+            free(buffer); buffer = NULL;
+        } else {
+            link = &buffer->nextRetired;
+        }
+    }
+}
+
+/// @fn static void calPublish(ConcurrentArrayList *concurrentArrayList,
+///   CALBuffer *buffer)
+///
+/// @brief Replace the current buffer with a new one and retire the old one.
+///
+/// @note Must be called with writeLock held.
+static void calPublish(ConcurrentArrayList *concurrentArrayList,
+    CALBuffer *buffer
+) {
+    CALBuffer *old = atomic_load(&concurrentArrayList->current);
+    atomic_store(&concurrentArrayList->current, buffer);
+    atomic_store(&concurrentArrayList->size, atomic_load(&buffer->size));
+
+    // Readers that see the advanced epoch are guaranteed to see the new
+    // buffer, so only readers from this epoch or earlier can hold the old one
+    old->retiredEpoch = atomic_fetch_add(&concurrentArrayList->epoch, 1);
+    old->nextRetired = concurrentArrayList->retired;
+    concurrentArrayList->retired = old;
+
+    calReclaim(concurrentArrayList);
+}
+
+/// @fn ConcurrentArrayList* concurrentArrayListCreate(void)
+///
+/// @brief Allocate and initialize an empty concurrent array list.
+///
+/// @return Returns a pointer to an allocated and initialized
+/// ConcurrentArrayList on success, NULL on failure.
+ConcurrentArrayList* concurrentArrayListCreate(void) {
+    ConcurrentArrayList *concurrentArrayList =
+        (ConcurrentArrayList*) aligned_alloc(CACHE_LINE_SIZE,
+            sizeof(ConcurrentArrayList));
+    if (concurrentArrayList == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    CALBuffer *buffer = calBufferCreate(MIN_CAPACITY);
+    if (buffer == NULL) {
+        free(concurrentArrayList); concurrentArrayList = NULL;
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&concurrentArrayList->writeLock, NULL) != 0) {
+        free(buffer); buffer = NULL;
+        free(concurrentArrayList); concurrentArrayList = NULL;
+        return NULL;
+    }
+    atomic_init(&concurrentArrayList->current, buffer);
+    atomic_init(&concurrentArrayList->epoch, QUIESCENT + 1);
+    atomic_init(&concurrentArrayList->handles, NULL);
+    atomic_init(&concurrentArrayList->size, 0);
+    concurrentArrayList->retired = NULL;
+
+    return concurrentArrayList;
+}
+
+/// @fn ConcurrentArrayList* concurrentArrayListDestroy(
+///   ConcurrentArrayList *concurrentArrayList)
+///
+/// @brief Release all the memory held by a concurrent array list, including
+/// every handle ever registered with it.
+///
+/// @param concurrentArrayList A pointer to a previously-created
+///   ConcurrentArrayList.
+///
+/// @note No other thread may be using the list or any of its handles.
+///
+/// @return This function always succeeds and always returns NULL.
+ConcurrentArrayList* concurrentArrayListDestroy(
+    ConcurrentArrayList *concurrentArrayList
+) {
+    if (concurrentArrayList == NULL) {
+        return NULL;
+    }
+
+    CALBuffer *buffer = concurrentArrayList->retired;
+    while (buffer != NULL) {
+        CALBuffer *next = buffer->nextRetired;
+        free(buffer);
+        buffer = next;
+    }
+    free(atomic_load(&concurrentArrayList->current));
+
+    CALHandle *calHandle = atomic_load(&concurrentArrayList->handles);
+    while (calHandle != NULL) {
+        CALHandle *next = calHandle->nextHandle;
+        free(calHandle);
+        calHandle = next;
+    }
+
+    pthread_mutex_destroy(&concurrentArrayList->writeLock);
+    free(concurrentArrayList); concurrentArrayList = NULL;
+
+    return NULL;
+}
+
+/// @fn int concurrentArrayListAppend(ConcurrentArrayList *concurrentArrayList,
+///   int value)
+///
+/// @brief Add a value to the end of a concurrent array list.
+///
+/// @param concurrentArrayList A pointer to a previously-created
+///   ConcurrentArrayList.
+/// @param value The value to append.
+///
+/// @return Returns 0 on success, -1 on failure.
+int concurrentArrayListAppend(ConcurrentArrayList *concurrentArrayList,
+    int value
+) {
+    return concurrentArrayListAppendMany(concurrentArrayList, &value, 1);
+}
+
+/// @fn int concurrentArrayListAppendMany(
+///   ConcurrentArrayList *concurrentArrayList, const int *values, size_t count)
+///
+/// @brief Add several values to the end of a concurrent array list at once.
+///
+/// @param concurrentArrayList A pointer to a previously-created
+///   ConcurrentArrayList.
+/// @param values The values to append.
+/// @param count The number of values to append.
+///
+/// @note Readers see either none or all of the values.  If the buffer is full,
+/// the list is copied into one at least twice as big and the old buffer is
+/// freed once no reader can be using it.
+///
+/// @return Returns 0 on success, -1 on failure.
+int concurrentArrayListAppendMany(ConcurrentArrayList *concurrentArrayList,
+    const int *values, size_t count
+) {
+    if ((concurrentArrayList == NULL) || ((values == NULL) && (count > 0))) {
+        return -1;
+    } else if (count == 0) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&concurrentArrayList->writeLock);
+    CALBuffer *buffer = atomic_load(&concurrentArrayList->current);
+    size_t size = atomic_load_explicit(&buffer->size, memory_order_relaxed);
+    if (count > SIZE_MAX - size) {
+        // Can't be allocated
+        pthread_mutex_unlock(&concurrentArrayList->writeLock);
+        return -1;
+    }
+
+    if (size + count <= buffer->capacity) {
+        // Nobody reads past size, so the new slots are still private to us
+        memcpy(&buffer->values[size], values, count * sizeof(int));
+        atomic_store_explicit(&buffer->size, size + count,
+            memory_order_release);
+        atomic_store(&concurrentArrayList->size, size + count);
+        pthread_mutex_unlock(&concurrentArrayList->writeLock);
+        return 0;
+    }
+
+    size_t capacity = buffer->capacity;
+    while (capacity < size + count) {
+        capacity = (capacity > SIZE_MAX / 2) ? size + count : capacity * 2;
+    }
+    CALBuffer *grown = calBufferCreate(capacity);
+    if (grown == NULL) {
+        pthread_mutex_unlock(&concurrentArrayList->writeLock);
+        return -1;
+    }
+    memcpy(grown->values, buffer->values, size * sizeof(int));
+    memcpy(&grown->values[size], values, count * sizeof(int));
+    atomic_init(&grown->size, size + count);
+
+    calPublish(concurrentArrayList, grown);
+    pthread_mutex_unlock(&concurrentArrayList->writeLock);
+
+    return 0;
+}
+
+/// @fn int concurrentArrayListRemoveAt(
+///   ConcurrentArrayList *concurrentArrayList, size_t index)
+///
+/// @brief Remove the element at a given index of a concurrent array list.
+///
+/// @param concurrentArrayList A pointer to a previously-created
+///   ConcurrentArrayList.
+/// @param index The index of the element to remove.
+///
+/// @note Readers may be looking at the element, so it can't be removed in
+/// place.  The rest of the list is copied into a new buffer instead, which
+/// makes this O(n).
+///
+/// @return Returns 0 on success, -1 on failure.
+int concurrentArrayListRemoveAt(ConcurrentArrayList *concurrentArrayList,
+    size_t index
+) {
+    if (concurrentArrayList == NULL) {
+        return -1;
+    }
+
+    pthread_mutex_lock(&concurrentArrayList->writeLock);
+    CALBuffer *buffer = atomic_load(&concurrentArrayList->current);
+    size_t size = atomic_load_explicit(&buffer->size, memory_order_relaxed);
+    if (index >= size) {
+        pthread_mutex_unlock(&concurrentArrayList->writeLock);
+        return -1;
+    }
+
+    CALBuffer *copy = calBufferCreate(buffer->capacity);
+    if (copy == NULL) {
+        pthread_mutex_unlock(&concurrentArrayList->writeLock);
+        return -1;
+    }
+    memcpy(copy->values, buffer->values, index * sizeof(int));
+    memcpy(&copy->values[index], &buffer->values[index + 1],
+        (size - index - 1) * sizeof(int));
+    atomic_init(&copy->size, size - 1);
+
+    calPublish(concurrentArrayList, copy);
+    pthread_mutex_unlock(&concurrentArrayList->writeLock);
+
+    return 0;
+}
+
+/// @fn size_t concurrentArrayListSize(ConcurrentArrayList *concurrentArrayList)
+///
+/// @brief Get the number of elements in a concurrent array list.
+///
+/// @param concurrentArrayList A pointer to a previously-created
+///   ConcurrentArrayList.
+///
+/// @note The answer may be out of date as soon as it is returned.  Take a
+/// snapshot to get a size that matches the elements.
+///
+/// @return Returns the number of elements, 0 if concurrentArrayList is NULL.
+size_t concurrentArrayListSize(ConcurrentArrayList *concurrentArrayList) {
+    if (concurrentArrayList == NULL) {
+        return 0;
+    }
+
+    return atomic_load(&concurrentArrayList->size);
+}
+
+// Reader functions follow
+
+/// @fn CALHandle* concurrentArrayListRegister(
+///   ConcurrentArrayList *concurrentArrayList)
+///
+/// @brief Get a handle for the calling thread to read a concurrent array list
+/// with.
+///
+/// @param concurrentArrayList A pointer to a previously-created
+///   ConcurrentArrayList.
+///
+/// @note Handles given up with concurrentArrayListUnregister are reused
+/// before new ones are allocated.
+///
+/// @return Returns a pointer to a CALHandle on success, NULL on failure.
+CALHandle* concurrentArrayListRegister(
+    ConcurrentArrayList *concurrentArrayList
+) {
+    if (concurrentArrayList == NULL) {
+        return NULL;
+    }
+
+    // Try to claim a handle that another thread has given up
+    for (CALHandle *cur = atomic_load(&concurrentArrayList->handles);
+        cur != NULL;
+        cur = cur->nextHandle
+    ) {
+        int inactive = 0;
+        if (atomic_compare_exchange_strong(&cur->active, &inactive, 1)) {
+            return cur;
+        }
+    }
+
+    CALHandle *calHandle =
+        (CALHandle*) aligned_alloc(CACHE_LINE_SIZE, sizeof(CALHandle));
+    if (calHandle == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    atomic_init(&calHandle->epoch, QUIESCENT);
+    atomic_init(&calHandle->active, 1);
+    calHandle->list = concurrentArrayList;
+
+    // Handles are only ever added to the front of the list and never removed
+    // until the list is destroyed, so writers can walk it without locking
+    CALHandle *head = atomic_load(&concurrentArrayList->handles);
+    do {
+        calHandle->nextHandle = head;
+    } while (!atomic_compare_exchange_weak(&concurrentArrayList->handles,
+        &head, calHandle));
+
+    return calHandle;
+}
+
+/// @fn CALHandle* concurrentArrayListUnregister(CALHandle *calHandle)
+///
+/// @brief Give up a thread's handle so that another thread can reuse it.
+///
+/// @param calHandle A pointer to the handle returned by
+///   concurrentArrayListRegister.
+///
+/// @note Ends the thread's snapshot if it still has one.
+///
+/// @return This function always succeeds and always returns NULL.
+CALHandle* concurrentArrayListUnregister(CALHandle *calHandle) {
+    if (calHandle == NULL) {
+        return NULL;
+    }
+
+    atomic_store(&calHandle->epoch, QUIESCENT);
+    atomic_store(&calHandle->active, 0);
+
+    return NULL;
+}
+
+/// @fn int concurrentArrayListReadBegin(CALHandle *calHandle,
+///   CALSnapshot *snapshot)
+///
+/// @brief Take a snapshot of a concurrent array list.
+///
+/// @param calHandle The calling thread's handle.
+/// @param snapshot Filled in with the elements of the list.
+///
+/// @note Never blocks.  The snapshot stays valid until
+/// concurrentArrayListReadEnd, so hold it for as short a time as possible:
+/// buffers replaced after it was taken can't be freed until then.  Snapshots
+/// don't nest.
+///
+/// @return Returns 0 on success, -1 on failure.
+int concurrentArrayListReadBegin(CALHandle *calHandle, CALSnapshot *snapshot) {
+    if ((calHandle == NULL) || (snapshot == NULL)) {
+        return -1;
+    } else if (atomic_load_explicit(&calHandle->epoch, memory_order_relaxed)
+        != QUIESCENT
+    ) {
+        // Already holding a snapshot
+        return -1;
+    }
+
+    ConcurrentArrayList *concurrentArrayList = calHandle->list;
+
+    // The announcement has to be visible before we load the buffer, which
+    // sequentially consistent atomics guarantee
+    atomic_store(&calHandle->epoch, atomic_load(&concurrentArrayList->epoch));
+    CALBuffer *buffer = atomic_load(&concurrentArrayList->current);
+    snapshot->size = atomic_load_explicit(&buffer->size, memory_order_acquire);
+    snapshot->values = buffer->values;
+
+    return 0;
+}
+
+/// @fn int concurrentArrayListReadEnd(CALHandle *calHandle)
+///
+/// @brief Give up the snapshot taken with concurrentArrayListReadBegin.
+///
+/// @param calHandle The calling thread's handle.
+///
+/// @return Returns 0 on success, -1 on failure.
+int concurrentArrayListReadEnd(CALHandle *calHandle) {
+    if (calHandle == NULL) {
+        return -1;
+    }
+
+    atomic_store_explicit(&calHandle->epoch, QUIESCENT, memory_order_release);
+
+    return 0;
+}
+
+/// @fn int concurrentArrayListGet(CALHandle *calHandle, size_t index,
+///   int *value)
+///
+/// @brief Read one element of a concurrent array list.
+///
+/// @param calHandle The calling thread's handle.
+/// @param index The index of the element to read.
+/// @param value Set to the element on success.
+///
+/// @note Takes and gives up its own snapshot, so it can't be called while the
+/// thread holds one.
+///
+/// @return Returns 0 on success, -1 on failure.
+int concurrentArrayListGet(CALHandle *calHandle, size_t index, int *value) {
+    CALSnapshot snapshot;
+    if ((value == NULL)
+        || (concurrentArrayListReadBegin(calHandle, &snapshot) != 0)
+    ) {
+        return -1;
+    }
+
+    int status = -1;
+    if (index < snapshot.size) {
+        *value = snapshot.values[index];
+        status = 0;
+    }
+    concurrentArrayListReadEnd(calHandle);
+
+    return status;
+}
+
+/// @fn ptrdiff_t concurrentArrayListSearch(CALHandle *calHandle, int value)
+///
+/// @brief Find the first occurrence of a value in a concurrent array list.
+///
+/// @param calHandle The calling thread's handle.
+/// @param value The value to search for.
+///
+/// @note Takes and gives up its own snapshot, so it can't be called while the
+/// thread holds one.
+///
+/// @return Returns the index of the first occurrence of the value, or -1 if
+/// the value was not found.
+ptrdiff_t concurrentArrayListSearch(CALHandle *calHandle, int value) {
+    CALSnapshot snapshot;
+    if (concurrentArrayListReadBegin(calHandle, &snapshot) != 0) {
+        return -1;
+    }
+
+    size_t index = alSimdFindFirst(snapshot.values, snapshot.size, value);
+    concurrentArrayListReadEnd(calHandle);
+
+    return (index < snapshot.size) ? (ptrdiff_t) index : -1;
+}
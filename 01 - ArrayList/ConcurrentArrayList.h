@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              ConcurrentArrayList.h
+///
+/// @brief             ArrayList that many threads can read without locks.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef CONCURRENT_ARRAY_LIST_H
+#define CONCURRENT_ARRAY_LIST_H
+
+// Standard C includes
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct ConcurrentArrayList
+///
+/// @brief Array-based list that one writer at a time appends to while any
+/// number of threads read it without locking.  The layout is private to
+/// ConcurrentArrayList.c because it is made of C11 atomics.
+typedef struct ConcurrentArrayList ConcurrentArrayList;
+
+/// @struct CALHandle
+///
+/// @brief A thread's registration with a ConcurrentArrayList.  It records
+/// which epoch the thread is reading in so that arrays the thread may still
+/// see aren't freed under it.  Each thread that reads a list needs its own
+/// handle.
+typedef struct CALHandle CALHandle;
+
+/// @struct CALSnapshot
+///
+/// @brief A consistent view of a ConcurrentArrayList at one point in time.
+///
+/// @var values The elements of the list.  They never change while the
+///   snapshot is held, even if other threads append, grow or remove.
+/// @var size The number of elements in values.
+typedef struct CALSnapshot {
+    const int *values;
+    size_t size;
+} CALSnapshot;
+
+// Base ConcurrentArrayList prototypes
+ConcurrentArrayList* concurrentArrayListCreate(void);
+ConcurrentArrayList* concurrentArrayListDestroy(
+    ConcurrentArrayList *concurrentArrayList);
+int concurrentArrayListAppend(ConcurrentArrayList *concurrentArrayList,
+    int value);
+int concurrentArrayListAppendMany(ConcurrentArrayList *concurrentArrayList,
+    const int *values, size_t count);
+int concurrentArrayListRemoveAt(ConcurrentArrayList *concurrentArrayList,
+    size_t index);
+size_t concurrentArrayListSize(ConcurrentArrayList *concurrentArrayList);
+
+// Reader prototypes
+CALHandle* concurrentArrayListRegister(
+    ConcurrentArrayList *concurrentArrayList);
+CALHandle* concurrentArrayListUnregister(CALHandle *calHandle);
+int concurrentArrayListReadBegin(CALHandle *calHandle, CALSnapshot *snapshot);
+int concurrentArrayListReadEnd(CALHandle *calHandle);
+int concurrentArrayListGet(CALHandle *calHandle, size_t index, int *value);
+ptrdiff_t concurrentArrayListSearch(CALHandle *calHandle, int value);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // CONCURRENT_ARRAY_LIST_H
@@ -0,0 +1,398 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ConcurrentArrayListBenchmark.c
+///
+/// @brief Measure how ConcurrentArrayList read throughput scales with the
+/// number of reader threads while a writer keeps appending, next to an
+/// ArrayList guarded by a reader-writer lock.
+///
+/// Usage:  ConcurrentArrayListBenchmark [maxReaders] [milliseconds]
+///
+/// For every reader count n from 1 up to maxReaders (doubling each time), n
+/// readers look up random elements for the given time while one writer
+/// appends a value every WRITER_PAUSE_NS nanoseconds.  Every element equals
+/// its index, so readers also check that they never see a torn or stale
+/// element.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ArrayList.h"
+#include "ConcurrentArrayList.h"
+
+/// @def DEFAULT_MILLISECONDS
+///
+/// @brief How long each round runs when not given on the command line.
+#define DEFAULT_MILLISECONDS 1000
+
+/// @def PRELOADED_ELEMENTS
+///
+/// @brief Elements in the list before a round starts.
+#define PRELOADED_ELEMENTS 1000000
+
+/// @def WRITER_PAUSE_NS
+///
+/// @brief Nanoseconds the writer sleeps between appends.
+#define WRITER_PAUSE_NS 10000
+
+/// @def READS_PER_CHECK
+///
+/// @brief Reads a reader does between checks of whether the round is over.
+#define READS_PER_CHECK 1024
+
+/// @struct BenchList
+///
+/// @brief The list under test.  Exactly one of concurrentArrayList and
+/// arrayList is used.
+typedef struct BenchList {
+    ConcurrentArrayList *concurrentArrayList;
+    ArrayList *arrayList;
+    pthread_rwlock_t lock;
+    atomic_int stop;
+    atomic_int failed;
+    atomic_llong reads;
+    atomic_llong errors;
+    long long appends;
+} BenchList;
+
+/// @struct BenchReader
+///
+/// @brief What each reader thread is given.
+typedef struct BenchReader {
+    BenchList *benchList;
+    uint64_t seed;
+} BenchReader;
+
+static double nowSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + ((double) now.tv_nsec * 1e-9);
+}
+
+static uint64_t nextRandom(uint64_t *state) {
+    // xorshift64
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+static void pauseWriter(void) {
+    struct timespec pause = {0, WRITER_PAUSE_NS};
+    nanosleep(&pause, NULL);
+}
+
+static void* lockFreeWriter(void *arg) {
+    BenchList *benchList = (BenchList*) arg;
+    int next = (int) concurrentArrayListSize(benchList->concurrentArrayList);
+
+    while (atomic_load(&benchList->stop) == 0) {
+        if (concurrentArrayListAppend(benchList->concurrentArrayList, next)
+            == 0
+        ) {
+            next++;
+            benchList->appends++;
+        }
+        pauseWriter();
+    }
+
+    return NULL;
+}
+
+static void* lockFreeReader(void *arg) {
+    BenchReader *benchReader = (BenchReader*) arg;
+    BenchList *benchList = benchReader->benchList;
+    CALHandle *calHandle =
+        concurrentArrayListRegister(benchList->concurrentArrayList);
+    if (calHandle == NULL) {
+        atomic_store(&benchList->failed, 1);
+        return NULL;
+    }
+    uint64_t state = benchReader->seed;
+    long long reads = 0;
+    long long errors = 0;
+
+    while ((atomic_load_explicit(&benchList->stop, memory_order_relaxed) == 0)
+        && (atomic_load_explicit(&benchList->failed, memory_order_relaxed)
+            == 0)
+    ) {
+        for (int ii = 0; ii < READS_PER_CHECK; ii++) {
+            CALSnapshot snapshot;
+            if ((concurrentArrayListReadBegin(calHandle, &snapshot) != 0)
+                || (snapshot.size == 0)
+            ) {
+                atomic_store(&benchList->failed, 1);
+                concurrentArrayListReadEnd(calHandle);
+                break;
+            }
+            size_t index = (size_t) (nextRandom(&state) % snapshot.size);
+            errors += (snapshot.values[index] != (int) index);
+            concurrentArrayListReadEnd(calHandle);
+        }
+        reads += READS_PER_CHECK;
+    }
+
+    atomic_fetch_add(&benchList->reads, reads);
+    atomic_fetch_add(&benchList->errors, errors);
+    calHandle = concurrentArrayListUnregister(calHandle);
+    return NULL;
+}
+
+static void* lockedWriter(void *arg) {
+    BenchList *benchList = (BenchList*) arg;
+    int next = (int) benchList->arrayList->listSize;
+
+    while (atomic_load(&benchList->stop) == 0) {
+        pthread_rwlock_wrlock(&benchList->lock);
+        int status = arrayListInsert(benchList->arrayList, next);
+        pthread_rwlock_unlock(&benchList->lock);
+        if (status == 0) {
+            next++;
+            benchList->appends++;
+        }
+        pauseWriter();
+    }
+
+    return NULL;
+}
+
+static void* lockedReader(void *arg) {
+    BenchReader *benchReader = (BenchReader*) arg;
+    BenchList *benchList = benchReader->benchList;
+    uint64_t state = benchReader->seed;
+    long long reads = 0;
+    long long errors = 0;
+
+    while (atomic_load_explicit(&benchList->stop, memory_order_relaxed) == 0) {
+        for (int ii = 0; ii < READS_PER_CHECK; ii++) {
+            pthread_rwlock_rdlock(&benchList->lock);
+            ArrayList *arrayList = benchList->arrayList;
+            size_t index = (size_t) (nextRandom(&state) % arrayList->listSize);
+            errors += (arrayList->array[index] != (int) index);
+            pthread_rwlock_unlock(&benchList->lock);
+        }
+        reads += READS_PER_CHECK;
+    }
+
+    atomic_fetch_add(&benchList->reads, reads);
+    atomic_fetch_add(&benchList->errors, errors);
+    return NULL;
+}
+
+/// @fn static void stopThreads(BenchList *benchList, pthread_t *threads,
+///   int numThreads)
+///
+/// @brief End a round and wait for the threads that were started.
+static void stopThreads(BenchList *benchList, pthread_t *threads,
+    int numThreads
+) {
+    atomic_store(&benchList->stop, 1);
+    for (int ii = 0; ii < numThreads; ii++) {
+        pthread_join(threads[ii], NULL);
+    }
+}
+
+/// @fn static int runRound(BenchList *benchList, const char *name,
+///   int numReaders, int milliseconds, int lockFree, double *baseline)
+///
+/// @brief Run the threads of one round on a loaded list and print its read
+/// throughput.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int runRound(BenchList *benchList, const char *name, int numReaders,
+    int milliseconds, int lockFree, double *baseline
+) {
+    // The writer goes first, so threads[0 .. started - 1] are always the ones
+    // to join
+    pthread_t *threads =
+        (pthread_t*) malloc(((size_t) numReaders + 1) * sizeof(pthread_t));
+    BenchReader *benchReaders =
+        (BenchReader*) malloc((size_t) numReaders * sizeof(BenchReader));
+    if ((threads == NULL) || (benchReaders == NULL)) {
+        printf("Error:  Could not allocate memory for threads!\n");
+        free(benchReaders); benchReaders = NULL;
+        free(threads); threads = NULL;
+        return -1;
+    }
+
+    double start = nowSeconds();
+    int started = 0;
+    if (pthread_create(&threads[0], NULL,
+        lockFree ? lockFreeWriter : lockedWriter, benchList) == 0
+    ) {
+        started++;
+        for (int ii = 0; ii < numReaders; ii++) {
+            benchReaders[ii].benchList = benchList;
+            benchReaders[ii].seed
+                = 0x9E3779B97F4A7C15ull * (uint64_t) (ii + 1);
+            if (pthread_create(&threads[ii + 1], NULL,
+                lockFree ? lockFreeReader : lockedReader, &benchReaders[ii])
+                != 0
+            ) {
+                break;
+            }
+            started++;
+        }
+    }
+    if (started != numReaders + 1) {
+        stopThreads(benchList, threads, started);
+        printf("Error:  Could not start the %s threads!\n", name);
+        free(benchReaders); benchReaders = NULL;
+        free(threads); threads = NULL;
+        return -1;
+    }
+
+    struct timespec duration = {
+        milliseconds / 1000, (long) (milliseconds % 1000) * 1000000L};
+    nanosleep(&duration, NULL);
+    stopThreads(benchList, threads, started);
+    double elapsed = nowSeconds() - start;
+    free(benchReaders); benchReaders = NULL;
+    free(threads); threads = NULL;
+
+    if (atomic_load(&benchList->failed) != 0) {
+        printf("Error:  A %s reader could not read the list!\n", name);
+        return -1;
+    }
+
+    double readsPerSecond = (double) atomic_load(&benchList->reads) / elapsed;
+    if (numReaders == 1) {
+        *baseline = readsPerSecond;
+    }
+    long long errors = atomic_load(&benchList->errors);
+    printf("%-10s %4d readers %10.2f Mreads/s %8.2f per reader %6.2fx "
+        "%8lld appends%s\n",
+        name, numReaders, readsPerSecond / 1e6,
+        readsPerSecond / numReaders / 1e6,
+        (*baseline > 0) ? readsPerSecond / *baseline : 0.0,
+        benchList->appends, (errors == 0) ? "" : "  (MISMATCH!)");
+
+    return (errors == 0) ? 0 : -1;
+}
+
+/// @fn static int runBenchmark(const char *name, int numReaders,
+///   int milliseconds, int lockFree, double *baseline)
+///
+/// @brief Load a list and run one round on it.
+///
+/// @param baseline The single-reader throughput of the same list, which this
+///   round's scaling is reported against.  Set by the single-reader round.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int runBenchmark(const char *name, int numReaders, int milliseconds,
+    int lockFree, double *baseline
+) {
+    BenchList benchList;
+    memset(&benchList, 0, sizeof(benchList));
+    atomic_init(&benchList.stop, 0);
+    atomic_init(&benchList.failed, 0);
+    atomic_init(&benchList.reads, 0);
+    atomic_init(&benchList.errors, 0);
+    if (pthread_rwlock_init(&benchList.lock, NULL) != 0) {
+        printf("Error:  Could not create the %s lock!\n", name);
+        return -1;
+    }
+
+    int status = -1;
+    int *preload = (int*) malloc(PRELOADED_ELEMENTS * sizeof(int));
+    if (preload == NULL) {
+        printf("Error:  Could not allocate memory for the list!\n");
+    } else {
+        for (int ii = 0; ii < PRELOADED_ELEMENTS; ii++) {
+            preload[ii] = ii;
+        }
+
+        if (lockFree) {
+            benchList.concurrentArrayList = concurrentArrayListCreate();
+            status = concurrentArrayListAppendMany(
+                benchList.concurrentArrayList, preload, PRELOADED_ELEMENTS);
+        } else {
+            benchList.arrayList = arrayListCreate();
+            status = arrayListInsertMany(benchList.arrayList,
+                preload, PRELOADED_ELEMENTS);
+        }
+        free(preload); preload = NULL;
+
+        if (status != 0) {
+            printf("Error:  Could not create the %s list!\n", name);
+        } else {
+            status = runRound(&benchList, name, numReaders, milliseconds,
+                lockFree, baseline);
+        }
+    }
+
+    benchList.concurrentArrayList =
+        concurrentArrayListDestroy(benchList.concurrentArrayList);
+    benchList.arrayList = arrayListDestroy(benchList.arrayList);
+    pthread_rwlock_destroy(&benchList.lock);
+
+    return status;
+}
+
+int main(int argc, char **argv) {
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxReaders = (argc > 1) ? atoi(argv[1]) : (int) numCpus;
+    int milliseconds = (argc > 2) ? atoi(argv[2]) : DEFAULT_MILLISECONDS;
+    if (maxReaders < 1) {
+        maxReaders = 1;
+    }
+    if (milliseconds < 1) {
+        milliseconds = 1;
+    }
+
+    int status = 0;
+    double lockFreeBaseline = 0.0;
+    double rwlockBaseline = 0.0;
+    for (int numReaders = 1; ; numReaders *= 2) {
+        if (numReaders > maxReaders) {
+            numReaders = maxReaders;
+        }
+
+        status |= runBenchmark("lock-free", numReaders, milliseconds, 1,
+            &lockFreeBaseline);
+        status |= runBenchmark("rwlock", numReaders, milliseconds, 0,
+            &rwlockBaseline);
+
+        if (numReaders == maxReaders) {
+            break;
+        }
+    }
+
+    return (status == 0) ? 0 : 1;
+}
@@ -0,0 +1,489 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file GenericArrayList.c
+///
+/// @brief Library implementation of the GenericArrayList.
+
+// Standard C includes
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GenericArrayList.h"
+
+/// @fn static int genericArrayListResize(GenericArrayList *genericArrayList,
+///   size_t newArraySize)
+///
+/// @brief Change the size of the array of a GenericArrayList.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to resize.
+/// @param newArraySize The number of elements the array should be able to hold.
+///
+/// @note On failure the GenericArrayList is left exactly as it was.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int genericArrayListResize(GenericArrayList *genericArrayList,
+    size_t newArraySize
+) {
+    void *check = alArrayResize(&genericArrayList->allocator,
+        genericArrayList->array, genericArrayList->elementSize,
+        genericArrayList->arraySize, newArraySize);
+    if (check == NULL) {
+        // Out of memory.
+        return -1;
+    }
+
+    genericArrayList->array = (unsigned char*) check;
+    genericArrayList->arraySize = newArraySize;
+
+    return 0;
+}
+
+/// @fn static int genericArrayListGrow(GenericArrayList *genericArrayList,
+///   size_t minArraySize)
+///
+/// @brief Grow the array of a GenericArrayList, following its growth policy,
+/// so that it can hold at least minArraySize elements.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to grow.
+/// @param minArraySize The number of elements the array must be able to hold.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int genericArrayListGrow(GenericArrayList *genericArrayList,
+    size_t minArraySize
+) {
+    if (minArraySize <= genericArrayList->arraySize) {
+        // Already big enough
+        return 0;
+    }
+
+    size_t newArraySize = alGrowthPolicyNextSize(
+        &genericArrayList->growthPolicy, genericArrayList->arraySize,
+        minArraySize, SIZE_MAX / genericArrayList->elementSize);
+    if (newArraySize == 0) {
+        // Too big
+        return -1;
+    }
+
+    return genericArrayListResize(genericArrayList, newArraySize);
+}
+
+/// @fn static void genericArrayListShrink(GenericArrayList *genericArrayList)
+///
+/// @brief Give back part of the array of a GenericArrayList if removals have
+/// left too little of it in use, following its growth policy.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to shrink.
+static void genericArrayListShrink(GenericArrayList *genericArrayList) {
+    size_t newArraySize = alGrowthPolicyShrinkSize(
+        &genericArrayList->growthPolicy, genericArrayList->arraySize,
+        genericArrayList->listSize, genericArrayList->reservedSize);
+    if (newArraySize != 0) {
+        // Keeping the bigger array is fine if this fails
+        genericArrayListResize(genericArrayList, newArraySize);
+    }
+}
+
+/// @fn GenericArrayList* genericArrayListCreate(size_t elementSize)
+///
+/// @brief Allocate and initialize a GenericArrayList.
+///
+/// @param elementSize The number of bytes in each element.
+///
+/// @return Returns a pointer to a allocated and initialized GenericArrayList
+/// on success, NULL on failure.
+GenericArrayList* genericArrayListCreate(size_t elementSize) {
+    return genericArrayListCreateWithAllocator(elementSize, NULL);
+}
+
+/// @fn GenericArrayList* genericArrayListCreateWithAllocator(
+///   size_t elementSize, const Allocator *allocator)
+///
+/// @brief Allocate and initialize a GenericArrayList that gets all of its
+/// memory from a given allocator.
+///
+/// @param elementSize The number of bytes in each element.
+/// @param allocator The allocator to use, or NULL for malloc and free.  It is
+///   copied, so only its context has to outlive the GenericArrayList.
+///
+/// @return Returns a pointer to a allocated and initialized GenericArrayList
+/// on success, NULL on failure.
+GenericArrayList* genericArrayListCreateWithAllocator(size_t elementSize,
+    const Allocator *allocator
+) {
+    if ((elementSize == 0) || (elementSize > (SIZE_MAX / AL_MIN_ARRAY_SIZE))) {
+        return NULL;
+    }
+
+    Allocator listAllocator
+        = (allocator != NULL) ? *allocator : allocatorLibc();
+
+    GenericArrayList *genericArrayList = (GenericArrayList*) allocatorAlloc(
+        &listAllocator, sizeof(GenericArrayList));
+    if (genericArrayList == NULL) {
+        return NULL;
+    }
+
+    genericArrayList->array = (unsigned char*) allocatorAlloc(&listAllocator,
+        AL_MIN_ARRAY_SIZE * elementSize);
+    if (genericArrayList->array == NULL) {
+        allocatorFree(&listAllocator, genericArrayList,
+            sizeof(GenericArrayList));
+        genericArrayList = NULL;
+        return NULL;
+    }
+
+    genericArrayList->elementSize = elementSize;
+    genericArrayList->arraySize = AL_MIN_ARRAY_SIZE;
+    genericArrayList->listSize = 0;
+    genericArrayList->reservedSize = 0;
+    alGrowthPolicyInit(&genericArrayList->growthPolicy);
+    genericArrayList->allocator = listAllocator;
+
+    return genericArrayList;
+}
+
+/// @fn GenericArrayList* genericArrayListDestroy(
+///   GenericArrayList *genericArrayList)
+///
+/// @brief Release all the memory held by a GenericArrayList.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to destroy.
+///
+/// @return This function always succeeds and always returns NULL.
+GenericArrayList* genericArrayListDestroy(GenericArrayList *genericArrayList) {
+    if (genericArrayList != NULL) {
+        allocatorFree(&genericArrayList->allocator, genericArrayList->array,
+            genericArrayList->arraySize * genericArrayList->elementSize);
+        genericArrayList->array = NULL;
+
+        // The allocator is about to be freed along with the list
+        Allocator allocator = genericArrayList->allocator;
+        allocatorFree(&allocator, genericArrayList, sizeof(GenericArrayList));
+        genericArrayList = NULL;
+    }
+
+    return NULL;
+}
+
+/// @fn int genericArrayListInsert(GenericArrayList *genericArrayList,
+///   const void *value)
+///
+/// @brief Insert a new element at the end of a GenericArrayList.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to append to.
+/// @param value A pointer to the elementSize bytes to copy in.
+///
+/// @note The array is grown before the value is written, so if growing fails
+/// the GenericArrayList is unchanged.
+///
+/// @return Returns 0 on success, -1 on failure.
+int genericArrayListInsert(GenericArrayList *genericArrayList,
+    const void *value
+) {
+    if ((genericArrayList == NULL) || (value == NULL)) {
+        return -1;
+    }
+
+    if (genericArrayList->listSize == genericArrayList->arraySize) {
+        if (genericArrayListGrow(genericArrayList,
+            genericArrayList->listSize + 1) != 0
+        ) {
+            // Out of memory.
+            return -1;
+        }
+    }
+
+    memcpy(genericArrayList->array
+        + (genericArrayList->listSize * genericArrayList->elementSize),
+        value, genericArrayList->elementSize);
+    genericArrayList->listSize++;
+
+    return 0;
+}
+
+/// @fn int genericArrayListInsertMany(GenericArrayList *genericArrayList,
+///   const void *values, size_t count)
+///
+/// @brief Insert a span of elements at the end of a GenericArrayList.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to append to.
+/// @param values A pointer to the first of count elements to append.
+/// @param count The number of elements to append.
+///
+/// @note The array is grown at most once and the elements are copied with a
+/// single memcpy.  On failure the GenericArrayList is unchanged.
+///
+/// @return Returns 0 on success, -1 on failure.
+int genericArrayListInsertMany(GenericArrayList *genericArrayList,
+    const void *values, size_t count
+) {
+    if ((genericArrayList == NULL) || ((values == NULL) && (count > 0))) {
+        return -1;
+    } else if (count == 0) {
+        // Nothing to do
+        return 0;
+    }
+
+    size_t listSize = genericArrayList->listSize;
+    if (count > SIZE_MAX - listSize) {
+        // listSize can't represent this
+        return -1;
+    }
+
+    if (genericArrayListGrow(genericArrayList, listSize + count) != 0) {
+        return -1;
+    }
+
+    memcpy(genericArrayList->array + (listSize * genericArrayList->elementSize),
+        values, count * genericArrayList->elementSize);
+    genericArrayList->listSize += count;
+
+    return 0;
+}
+
+/// @fn int genericArrayListReserve(GenericArrayList *genericArrayList,
+///   size_t capacity)
+///
+/// @brief Make sure the array of a GenericArrayList can hold at least capacity
+/// elements without growing again.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to reserve space
+///   in.
+/// @param capacity The number of elements the array must be able to hold.
+///
+/// @note The array is grown to exactly capacity elements, regardless of the
+/// growth policy.  It is never shrunk here, and removals won't shrink it below
+/// capacity either until the next call to genericArrayListReserve.
+///
+/// @return Returns 0 on success, -1 on failure.
+int genericArrayListReserve(GenericArrayList *genericArrayList,
+    size_t capacity
+) {
+    if (genericArrayList == NULL) {
+        return -1;
+    } else if (capacity <= genericArrayList->arraySize) {
+        // Already big enough
+        genericArrayList->reservedSize = capacity;
+        return 0;
+    }
+
+    if (genericArrayListResize(genericArrayList, capacity) != 0) {
+        return -1;
+    }
+    genericArrayList->reservedSize = capacity;
+
+    return 0;
+}
+
+/// @fn int genericArrayListSetGrowthPolicy(GenericArrayList *genericArrayList,
+///   const ALGrowthPolicy *growthPolicy)
+///
+/// @brief Set the policy used to grow the array of a GenericArrayList.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to set the policy
+///   of.
+/// @param growthPolicy A pointer to the policy to copy into the list.
+///
+/// @return Returns 0 on success, -1 if the policy is not valid.
+int genericArrayListSetGrowthPolicy(GenericArrayList *genericArrayList,
+    const ALGrowthPolicy *growthPolicy
+) {
+    if ((genericArrayList == NULL)
+        || (alGrowthPolicyValidate(growthPolicy) != 0)
+    ) {
+        return -1;
+    }
+
+    genericArrayList->growthPolicy = *growthPolicy;
+
+    return 0;
+}
+
+/// @fn void* genericArrayListAt(GenericArrayList *genericArrayList,
+///   size_t index)
+///
+/// @brief Get a pointer to the element at a given index.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to access.
+/// @param index The index of the element.
+///
+/// @note The pointer is only valid until the list is next modified, since
+/// growing the array may move it.
+///
+/// @return Returns a pointer to the element on success, NULL if index is out
+/// of range.
+void* genericArrayListAt(GenericArrayList *genericArrayList, size_t index) {
+    if ((genericArrayList == NULL) || (index >= genericArrayList->listSize)) {
+        return NULL;
+    }
+
+    return genericArrayList->array + (index * genericArrayList->elementSize);
+}
+
+/// @fn ptrdiff_t genericArrayListSearch(GenericArrayList *genericArrayList,
+///   const void *value, int (*compare)(const void*, const void*))
+///
+/// @brief Search a GenericArrayList for a given element.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to search.
+/// @param value A pointer to the element to search for.
+/// @param compare Function that returns 0 when two elements are equal, or
+///   NULL to compare the elements byte for byte.
+///
+/// @note Byte comparison is only safe for types without padding bytes.
+///
+/// @return Returns the index of the first matching element if found, -1 if
+/// not.
+ptrdiff_t genericArrayListSearch(GenericArrayList *genericArrayList,
+    const void *value, int (*compare)(const void*, const void*)
+) {
+    if ((genericArrayList == NULL) || (value == NULL)) {
+        // Cannot search
+        return -1;
+    }
+
+    size_t elementSize = genericArrayList->elementSize;
+    const unsigned char *element = genericArrayList->array;
+    for (size_t ii = 0; ii < genericArrayList->listSize; ii++) {
+        int difference = (compare != NULL)
+            ? compare(element, value) : memcmp(element, value, elementSize);
+        if (difference == 0) {
+            return (ptrdiff_t) ii;
+        }
+        element += elementSize;
+    }
+
+    return -1;
+}
+
+/// @fn int genericArrayListRemoveAt(GenericArrayList *genericArrayList,
+///   size_t index)
+///
+/// @brief Remove the element at a given index from a GenericArrayList,
+/// keeping the remaining elements in order.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to remove an
+///   element from.
+/// @param index The index of the element to remove.
+///
+/// @note The elements after index are shifted down with a single memmove.
+///
+/// @return Returns 0 on success, -1 if index is out of range.
+int genericArrayListRemoveAt(GenericArrayList *genericArrayList,
+    size_t index
+) {
+    if ((genericArrayList == NULL) || (index >= genericArrayList->listSize)) {
+        return -1;
+    }
+
+    size_t elementSize = genericArrayList->elementSize;
+    unsigned char *element = genericArrayList->array + (index * elementSize);
+    memmove(element, element + elementSize,
+        (genericArrayList->listSize - index - 1) * elementSize);
+    genericArrayList->listSize--;
+    genericArrayListShrink(genericArrayList);
+
+    return 0;
+}
+
+/// @fn int genericArrayListSwapRemoveAt(GenericArrayList *genericArrayList,
+///   size_t index)
+///
+/// @brief Remove the element at a given index from a GenericArrayList in O(1)
+/// by moving the last element into its place.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to remove an
+///   element from.
+/// @param index The index of the element to remove.
+///
+/// @note The order of the remaining elements is not preserved.
+///
+/// @return Returns 0 on success, -1 if index is out of range.
+int genericArrayListSwapRemoveAt(GenericArrayList *genericArrayList,
+    size_t index
+) {
+    if ((genericArrayList == NULL) || (index >= genericArrayList->listSize)) {
+        return -1;
+    }
+
+    size_t elementSize = genericArrayList->elementSize;
+    size_t lastIndex = genericArrayList->listSize - 1;
+    if (index != lastIndex) {
+        memcpy(genericArrayList->array + (index * elementSize),
+            genericArrayList->array + (lastIndex * elementSize), elementSize);
+    }
+    genericArrayList->listSize--;
+    genericArrayListShrink(genericArrayList);
+
+    return 0;
+}
+
+/// @fn int genericArrayListSort(GenericArrayList *genericArrayList,
+///   int (*compare)(const void*, const void*))
+///
+/// @brief Sort the elements of a GenericArrayList.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to sort.
+/// @param compare qsort-style function that orders two elements.
+///
+/// @return Returns 0 on success, -1 on failure.
+int genericArrayListSort(GenericArrayList *genericArrayList,
+    int (*compare)(const void*, const void*)
+) {
+    if ((genericArrayList == NULL) || (compare == NULL)) {
+        return -1;
+    }
+
+    qsort(genericArrayList->array, genericArrayList->listSize,
+        genericArrayList->elementSize, compare);
+
+    return 0;
+}
+
+/// @fn void* genericArrayListData(GenericArrayList *genericArrayList,
+///   size_t *count)
+///
+/// @brief Get direct access to the elements of a GenericArrayList.
+///
+/// @param genericArrayList A pointer to the GenericArrayList to access.
+/// @param count Set to the number of elements in the returned span.
+///
+/// @note The span is only valid until the list is next modified, since growing
+/// the array may move it.
+///
+/// @return Returns a pointer to the first element on success, NULL on failure.
+void* genericArrayListData(GenericArrayList *genericArrayList, size_t *count) {
+    if ((genericArrayList == NULL) || (count == NULL)) {
+        return NULL;
+    }
+
+    *count = genericArrayList->listSize;
+
+    return genericArrayList->array;
+}
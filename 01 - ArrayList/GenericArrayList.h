@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              GenericArrayList.h
+///
+/// @brief             Array-based list of elements of any size in C.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef GENERIC_ARRAY_LIST_H
+#define GENERIC_ARRAY_LIST_H
+
+// Standard C includes
+#include <stddef.h>
+
+#include "ArrayList.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct GenericArrayList
+///
+/// @brief Array-based list whose elements are any fixed number of bytes.  The
+/// elements are stored back to back in one array, so a list of structs or
+/// 64-bit keys needs no pointer per element.
+///
+/// @var array Pointer to the dynamic memory for the array that holds the
+///   elements of the list.
+/// @var elementSize The number of bytes in each element.
+/// @var arraySize The number of elements that the array can hold.
+/// @var listSize The number of elements currently in the array.
+/// @var reservedSize The capacity last asked for with genericArrayListReserve.
+///   Removals never shrink the array below it.
+/// @var growthPolicy How the array is grown when it runs out of room.
+/// @var allocator Where the GenericArrayList and its array get their memory.
+typedef struct GenericArrayList {
+    unsigned char *array;
+    size_t elementSize;
+    size_t arraySize;
+    size_t listSize;
+    size_t reservedSize;
+    ALGrowthPolicy growthPolicy;
+    Allocator allocator;
+} GenericArrayList;
+
+// Base GenericArrayList prototypes
+GenericArrayList* genericArrayListCreate(size_t elementSize);
+GenericArrayList* genericArrayListCreateWithAllocator(size_t elementSize,
+    const Allocator *allocator);
+GenericArrayList* genericArrayListDestroy(GenericArrayList *genericArrayList);
+int genericArrayListInsert(GenericArrayList *genericArrayList,
+    const void *value);
+int genericArrayListInsertMany(GenericArrayList *genericArrayList,
+    const void *values, size_t count);
+int genericArrayListReserve(GenericArrayList *genericArrayList,
+    size_t capacity);
+int genericArrayListSetGrowthPolicy(GenericArrayList *genericArrayList,
+    const ALGrowthPolicy *growthPolicy);
+void* genericArrayListAt(GenericArrayList *genericArrayList, size_t index);
+ptrdiff_t genericArrayListSearch(GenericArrayList *genericArrayList,
+    const void *value, int (*compare)(const void*, const void*));
+int genericArrayListRemoveAt(GenericArrayList *genericArrayList,
+    size_t index);
+int genericArrayListSwapRemoveAt(GenericArrayList *genericArrayList,
+    size_t index);
+int genericArrayListSort(GenericArrayList *genericArrayList,
+    int (*compare)(const void*, const void*));
+void* genericArrayListData(GenericArrayList *genericArrayList, size_t *count);
+
+/// @def GENERIC_ARRAY_LIST_DEFINE
+///
+/// @brief Define typed wrappers around a GenericArrayList of one element type.
+///
+/// @param name The prefix of the wrapper functions, e.g. int64List.
+/// @param type The element type, e.g. int64_t.
+///
+/// @note This defines nameCreate, nameInsert, nameAt and nameData.  nameInsert
+/// stores the element with a plain assignment when the array has room, so
+/// appending a typed element costs no more than with the int ArrayList.
+#define GENERIC_ARRAY_LIST_DEFINE(name, type) \
+    static inline GenericArrayList* name##Create(void) { \
+        return genericArrayListCreate(sizeof(type)); \
+    } \
+    static inline int name##Insert(GenericArrayList *genericArrayList, \
+        type value \
+    ) { \
+        if ((genericArrayList != NULL) \
+            && (genericArrayList->listSize < genericArrayList->arraySize) \
+        ) { \
+            ((type*) genericArrayList->array)[genericArrayList->listSize] \
+                = value; \
+            genericArrayList->listSize++; \
+            return 0; \
+        } \
+        return genericArrayListInsert(genericArrayList, &value); \
+    } \
+    static inline type* name##At(GenericArrayList *genericArrayList, \
+        size_t index \
+    ) { \
+        return (type*) genericArrayListAt(genericArrayList, index); \
+    } \
+    static inline type* name##Data(GenericArrayList *genericArrayList, \
+        size_t *count \
+    ) { \
+        return (type*) genericArrayListData(genericArrayList, count); \
+    }
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // GENERIC_ARRAY_LIST_H
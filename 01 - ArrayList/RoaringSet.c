@@ -0,0 +1,1360 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file RoaringSet.c
+///
+/// @brief Library implementation of the RoaringSet.
+///
+/// Ints are flipped in their sign bit so that unsigned order is int order,
+/// then split into a 16-bit key that picks the container and 16 low bits that
+/// the container stores.  A chunk with at most RS_ARRAY_MAX members is
+/// usually smallest as a sorted array, a denser one as a bitmap, and one made
+/// of long stretches of consecutive values as a list of runs.  Containers are
+/// always rebuilt in their smallest form after set algebra and bulk builds.
+/// Single adds and removes keep whatever form is cheapest to update instead.
+
+// Standard C includes
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ArrayListSimd.h"
+#include "RoaringSet.h"
+
+/// @def RS_ARRAY_MAX
+///
+/// @brief Most members an array container holds.  At this point the array
+/// takes as many bytes as a bitmap.
+#define RS_ARRAY_MAX 4096
+
+/// @def RS_BITMAP_WORDS
+///
+/// @brief Number of 64-bit words in a bitmap container.
+#define RS_BITMAP_WORDS 1024
+
+/// @def RS_BITMAP_BYTES
+///
+/// @brief Number of bytes in a bitmap container.
+#define RS_BITMAP_BYTES (RS_BITMAP_WORDS * sizeof(uint64_t))
+
+/// @def RS_MIN_CONTAINERS
+///
+/// @brief Fewest containers a set makes room for at once.
+#define RS_MIN_CONTAINERS 4
+
+/// @enum RSType
+///
+/// @brief The forms a container can take.
+///
+/// @var RS_TYPE_ARRAY data is count sorted uint16_t values.
+/// @var RS_TYPE_BITMAP data is RS_BITMAP_WORDS uint64_t words with one bit
+///   per possible value.
+/// @var RS_TYPE_RUN data is count pairs of uint16_t:  the first value of a run
+///   and its length minus one, sorted by first value.
+typedef enum RSType {
+    RS_TYPE_ARRAY = 0,
+    RS_TYPE_BITMAP,
+    RS_TYPE_RUN
+} RSType;
+
+/// @struct RSContainer
+///
+/// @brief The members of one 65536-value chunk of a RoaringSet.
+///
+/// @param data The values, words or runs.  See RSType.
+/// @param bytes The number of bytes allocated for data.
+/// @param cardinality The number of members.
+/// @param count The number of values or runs in data.
+/// @param type One of RSType.
+typedef struct RSContainer {
+    void *data;
+    size_t bytes;
+    uint32_t cardinality;
+    uint32_t count;
+    unsigned char type;
+} RSContainer;
+
+/// @struct RSScratch
+///
+/// @brief Working space for combining two containers.
+///
+/// @param left The first container as a bitmap.
+/// @param right The second container as a bitmap.
+/// @param values Sorted values of the result when it is built as an array.
+typedef struct RSScratch {
+    uint64_t left[RS_BITMAP_WORDS];
+    uint64_t right[RS_BITMAP_WORDS];
+    uint16_t values[2 * RS_ARRAY_MAX];
+} RSScratch;
+
+/// @fn static uint32_t rsKey(int value)
+///
+/// @brief Map an int to an unsigned key with the same order.
+static uint32_t rsKey(int value) {
+    return (uint32_t) value ^ 0x80000000u;
+}
+
+/// @fn static int rsValue(uint32_t key)
+///
+/// @brief Map a key made by rsKey back to its int.
+static int rsValue(uint32_t key) {
+    return (int) (key ^ 0x80000000u);
+}
+
+// RSContainer functions follow
+
+/// @fn static void rsContainerFree(const Allocator *allocator,
+///   RSContainer *container)
+///
+/// @brief Free a container's data and mark it empty.
+static void rsContainerFree(const Allocator *allocator,
+    RSContainer *container
+) {
+    allocatorFree(allocator, container->data, container->bytes);
+    container->data = NULL;
+    container->bytes = 0;
+    container->cardinality = 0;
+    container->count = 0;
+}
+
+/// @fn static int rsContainerReserve(const Allocator *allocator,
+///   RSContainer *container, size_t bytes)
+///
+/// @brief Make sure a container's data has room for at least bytes bytes.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int rsContainerReserve(const Allocator *allocator,
+    RSContainer *container, size_t bytes
+) {
+    if (bytes <= container->bytes) {
+        return 0;
+    }
+
+    size_t newBytes = (container->bytes > 0) ? container->bytes * 2 : 8;
+    while (newBytes < bytes) {
+        newBytes *= 2;
+    }
+    void *data = allocatorRealloc(allocator, container->data,
+        container->bytes, newBytes);
+    if (data == NULL) {
+        // Out of memory
+        return -1;
+    }
+    container->data = data;
+    container->bytes = newBytes;
+
+    return 0;
+}
+
+/// @fn static int rsContainerAllocate(const Allocator *allocator,
+///   RSContainer *container, RSType type, size_t bytes)
+///
+/// @brief Give an empty container freshly zeroed data of an exact size.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int rsContainerAllocate(const Allocator *allocator,
+    RSContainer *container, RSType type, size_t bytes
+) {
+    container->data = allocatorCalloc(allocator, 1, bytes);
+    if (container->data == NULL) {
+        // Out of memory
+        return -1;
+    }
+    container->bytes = bytes;
+    container->type = (unsigned char) type;
+    container->cardinality = 0;
+    container->count = 0;
+
+    return 0;
+}
+
+/// @fn static size_t rsArrayLowerBound(const uint16_t *values, size_t count,
+///   uint16_t low)
+///
+/// @brief Find where a value is or would go in a sorted array.
+static size_t rsArrayLowerBound(const uint16_t *values, size_t count,
+    uint16_t low
+) {
+    size_t first = 0;
+    while (count > 0) {
+        size_t half = count / 2;
+        if (values[first + half] < low) {
+            first += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+
+    return first;
+}
+
+/// @fn static int rsContainerContains(const RSContainer *container,
+///   uint16_t low)
+///
+/// @brief Check whether a container holds a value.
+///
+/// @return Returns 1 if it does, 0 if not.
+static int rsContainerContains(const RSContainer *container, uint16_t low) {
+    if (container->type == RS_TYPE_BITMAP) {
+        const uint64_t *words = (const uint64_t*) container->data;
+        return (int) ((words[low >> 6] >> (low & 63)) & 1);
+    } else if (container->type == RS_TYPE_ARRAY) {
+        const uint16_t *values = (const uint16_t*) container->data;
+        size_t index = rsArrayLowerBound(values, container->count, low);
+        return (index < container->count) && (values[index] == low);
+    }
+
+    // Last run that starts at or before low
+    const uint16_t *runs = (const uint16_t*) container->data;
+    size_t first = 0;
+    size_t count = container->count;
+    while (count > 0) {
+        size_t half = count / 2;
+        if (runs[2 * (first + half)] <= low) {
+            first += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+
+    return (first > 0)
+        && ((uint32_t) low - runs[2 * (first - 1)] <= runs[(2 * first) - 1]);
+}
+
+/// @fn static void rsContainerToBitmap(const RSContainer *container,
+///   uint64_t *words)
+///
+/// @brief Write a container's members out as a bitmap.
+static void rsContainerToBitmap(const RSContainer *container,
+    uint64_t *words
+) {
+    if (container->type == RS_TYPE_BITMAP) {
+        memcpy(words, container->data, RS_BITMAP_BYTES);
+        return;
+    }
+
+    memset(words, 0, RS_BITMAP_BYTES);
+    const uint16_t *values = (const uint16_t*) container->data;
+    if (container->type == RS_TYPE_ARRAY) {
+        for (uint32_t ii = 0; ii < container->count; ii++) {
+            words[values[ii] >> 6] |= (uint64_t) 1 << (values[ii] & 63);
+        }
+        return;
+    }
+
+    for (uint32_t ii = 0; ii < container->count; ii++) {
+        uint32_t start = values[2 * ii];
+        uint32_t end = start + values[(2 * ii) + 1];
+        for (uint32_t low = start; low <= end; low++) {
+            words[low >> 6] |= (uint64_t) 1 << (low & 63);
+        }
+    }
+}
+
+/// @fn static int rsContainerFromSorted(const Allocator *allocator,
+///   const uint16_t *values, uint32_t count, RSContainer *container)
+///
+/// @brief Build a container in its smallest form from sorted, distinct
+/// values.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int rsContainerFromSorted(const Allocator *allocator,
+    const uint16_t *values, uint32_t count, RSContainer *container
+) {
+    uint32_t numRuns = 0;
+    for (uint32_t ii = 0; ii < count; ii++) {
+        numRuns += (ii == 0) || (values[ii] != values[ii - 1] + 1);
+    }
+
+    size_t runBytes = (size_t) numRuns * 2 * sizeof(uint16_t);
+    size_t arrayBytes = (count <= RS_ARRAY_MAX)
+        ? (size_t) count * sizeof(uint16_t) : SIZE_MAX;
+
+    if ((arrayBytes <= runBytes) && (arrayBytes <= RS_BITMAP_BYTES)) {
+        if (rsContainerAllocate(allocator, container, RS_TYPE_ARRAY,
+            arrayBytes) != 0
+        ) {
+            return -1;
+        }
+        memcpy(container->data, values, arrayBytes);
+        container->count = count;
+    } else if (runBytes < RS_BITMAP_BYTES) {
+        if (rsContainerAllocate(allocator, container, RS_TYPE_RUN,
+            runBytes) != 0
+        ) {
+            return -1;
+        }
+        uint16_t *runs = (uint16_t*) container->data;
+        for (uint32_t ii = 0; ii < count; ii++) {
+            if ((ii == 0) || (values[ii] != values[ii - 1] + 1)) {
+                runs[2 * container->count] = values[ii];
+                container->count++;
+            } else {
+                runs[(2 * container->count) - 1]++;
+            }
+        }
+    } else {
+        if (rsContainerAllocate(allocator, container, RS_TYPE_BITMAP,
+            RS_BITMAP_BYTES) != 0
+        ) {
+            return -1;
+        }
+        uint64_t *words = (uint64_t*) container->data;
+        for (uint32_t ii = 0; ii < count; ii++) {
+            words[values[ii] >> 6] |= (uint64_t) 1 << (values[ii] & 63);
+        }
+        container->count = RS_BITMAP_WORDS;
+    }
+    container->cardinality = count;
+
+    return 0;
+}
+
+/// @fn static int rsContainerFromBitmap(const Allocator *allocator,
+///   const uint64_t *words, uint32_t cardinality, RSContainer *container)
+///
+/// @brief Build a container in its smallest form from a bitmap.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int rsContainerFromBitmap(const Allocator *allocator,
+    const uint64_t *words, uint32_t cardinality, RSContainer *container
+) {
+    // A run starts at every set bit whose lower neighbour is clear
+    size_t numRuns = 0;
+    uint64_t carry = 0;
+    for (size_t ii = 0; ii < RS_BITMAP_WORDS; ii++) {
+        numRuns += (size_t) __builtin_popcountll(words[ii]
+            & ~((words[ii] << 1) | carry));
+        carry = words[ii] >> 63;
+    }
+
+    size_t runBytes = numRuns * 2 * sizeof(uint16_t);
+    size_t arrayBytes = (cardinality <= RS_ARRAY_MAX)
+        ? (size_t) cardinality * sizeof(uint16_t) : SIZE_MAX;
+
+    if ((arrayBytes > runBytes) || (arrayBytes > RS_BITMAP_BYTES)) {
+        if (runBytes >= RS_BITMAP_BYTES) {
+            if (rsContainerAllocate(allocator, container, RS_TYPE_BITMAP,
+                RS_BITMAP_BYTES) != 0
+            ) {
+                return -1;
+            }
+            memcpy(container->data, words, RS_BITMAP_BYTES);
+            container->count = RS_BITMAP_WORDS;
+            container->cardinality = cardinality;
+            return 0;
+        }
+    }
+
+    // Array or run:  list the values and let rsContainerFromSorted pick
+    uint16_t *values = (uint16_t*) allocatorAlloc(allocator,
+        (size_t) cardinality * sizeof(uint16_t));
+    if (values == NULL) {
+        // Out of memory
+        return -1;
+    }
+    uint32_t count = 0;
+    for (size_t ii = 0; ii < RS_BITMAP_WORDS; ii++) {
+        for (uint64_t word = words[ii]; word != 0; word &= word - 1) {
+            values[count++] = (uint16_t) ((ii * 64)
+                + (size_t) __builtin_ctzll(word));
+        }
+    }
+    int status = rsContainerFromSorted(allocator, values, count, container);
+    allocatorFree(allocator, values, (size_t) cardinality * sizeof(uint16_t));
+    values = NULL;
+
+    return status;
+}
+
+/// @fn static int rsContainerCopy(const Allocator *allocator,
+///   const RSContainer *source, RSContainer *container)
+///
+/// @brief Make an exactly sized copy of a container.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int rsContainerCopy(const Allocator *allocator,
+    const RSContainer *source, RSContainer *container
+) {
+    size_t bytes = (source->type == RS_TYPE_BITMAP) ? RS_BITMAP_BYTES
+        : (size_t) source->count * sizeof(uint16_t)
+            * ((source->type == RS_TYPE_RUN) ? 2 : 1);
+    if (rsContainerAllocate(allocator, container, (RSType) source->type,
+        bytes) != 0
+    ) {
+        return -1;
+    }
+    memcpy(container->data, source->data, bytes);
+    container->cardinality = source->cardinality;
+    container->count = source->count;
+
+    return 0;
+}
+
+/// @fn static int rsContainerConvert(const Allocator *allocator,
+///   RSContainer *container, RSType type)
+///
+/// @brief Change a container to the array or bitmap form.
+///
+/// @note An array can only hold RS_ARRAY_MAX members, so callers only ask
+/// for one when the container is that small.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int rsContainerConvert(const Allocator *allocator,
+    RSContainer *container, RSType type
+) {
+    uint64_t words[RS_BITMAP_WORDS];
+    rsContainerToBitmap(container, words);
+
+    RSContainer converted;
+    if (type == RS_TYPE_BITMAP) {
+        if (rsContainerAllocate(allocator, &converted, RS_TYPE_BITMAP,
+            RS_BITMAP_BYTES) != 0
+        ) {
+            return -1;
+        }
+        memcpy(converted.data, words, RS_BITMAP_BYTES);
+        converted.count = RS_BITMAP_WORDS;
+    } else {
+        if (rsContainerAllocate(allocator, &converted, RS_TYPE_ARRAY,
+            (size_t) container->cardinality * sizeof(uint16_t)) != 0
+        ) {
+            return -1;
+        }
+        uint16_t *values = (uint16_t*) converted.data;
+        for (size_t ii = 0; ii < RS_BITMAP_WORDS; ii++) {
+            for (uint64_t word = words[ii]; word != 0; word &= word - 1) {
+                values[converted.count++] = (uint16_t) ((ii * 64)
+                    + (size_t) __builtin_ctzll(word));
+            }
+        }
+    }
+    converted.cardinality = container->cardinality;
+
+    rsContainerFree(allocator, container);
+    *container = converted;
+
+    return 0;
+}
+
+/// @fn static int rsContainerAdd(const Allocator *allocator,
+///   RSContainer *container, uint16_t low)
+///
+/// @brief Add a value to a container.
+///
+/// @note Run containers are turned into arrays or bitmaps first, since
+/// inserting into a run list can split or merge runs.  An array that is full
+/// becomes a bitmap.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int rsContainerAdd(const Allocator *allocator, RSContainer *container,
+    uint16_t low
+) {
+    if (rsContainerContains(container, low)) {
+        return 0;
+    }
+
+    if ((container->type == RS_TYPE_RUN)
+        || ((container->type == RS_TYPE_ARRAY)
+            && (container->cardinality >= RS_ARRAY_MAX))
+    ) {
+        RSType type = (container->cardinality < RS_ARRAY_MAX)
+            ? RS_TYPE_ARRAY : RS_TYPE_BITMAP;
+        if (rsContainerConvert(allocator, container, type) != 0) {
+            return -1;
+        }
+    }
+
+    if (container->type == RS_TYPE_BITMAP) {
+        uint64_t *words = (uint64_t*) container->data;
+        words[low >> 6] |= (uint64_t) 1 << (low & 63);
+    } else {
+        if (rsContainerReserve(allocator, container,
+            ((size_t) container->count + 1) * sizeof(uint16_t)) != 0
+        ) {
+            return -1;
+        }
+        uint16_t *values = (uint16_t*) container->data;
+        size_t index = rsArrayLowerBound(values, container->count, low);
+        memmove(&values[index + 1], &values[index],
+            (container->count - index) * sizeof(uint16_t));
+        values[index] = low;
+        container->count++;
+    }
+    container->cardinality++;
+
+    return 0;
+}
+
+/// @fn static int rsContainerRemove(const Allocator *allocator,
+///   RSContainer *container, uint16_t low)
+///
+/// @brief Remove a value from a container.
+///
+/// @note A bitmap only turns back into an array once it is down to half of
+/// RS_ARRAY_MAX, so adding and removing around the limit doesn't convert
+/// back and forth every time.
+///
+/// @return Returns 0 on success, -1 if the value wasn't there or on failure.
+static int rsContainerRemove(const Allocator *allocator,
+    RSContainer *container, uint16_t low
+) {
+    if (!rsContainerContains(container, low)) {
+        return -1;
+    }
+
+    if ((container->type == RS_TYPE_RUN)
+        && (rsContainerConvert(allocator, container,
+            (container->cardinality <= RS_ARRAY_MAX)
+                ? RS_TYPE_ARRAY : RS_TYPE_BITMAP) != 0)
+    ) {
+        return -1;
+    }
+
+    if (container->type == RS_TYPE_BITMAP) {
+        uint64_t *words = (uint64_t*) container->data;
+        words[low >> 6] &= ~((uint64_t) 1 << (low & 63));
+        container->cardinality--;
+        if (container->cardinality <= RS_ARRAY_MAX / 2) {
+            // Staying a bitmap is fine if this fails
+            rsContainerConvert(allocator, container, RS_TYPE_ARRAY);
+        }
+        return 0;
+    }
+
+    uint16_t *values = (uint16_t*) container->data;
+    size_t index = rsArrayLowerBound(values, container->count, low);
+    memmove(&values[index], &values[index + 1],
+        (container->count - index - 1) * sizeof(uint16_t));
+    container->count--;
+    container->cardinality--;
+
+    return 0;
+}
+
+/// @fn static int rsContainerCombine(const Allocator *allocator,
+///   const RSContainer *a, const RSContainer *b, ALBitmapOp op,
+///   RSScratch *scratch, RSContainer *result)
+///
+/// @brief Compute the union, intersection or difference of two containers.
+///
+/// @note Two arrays are merged.  An intersection with an array, or the
+/// difference of an array and anything, only has to test the array's values
+/// against the other container.  Everything else is done as bitmaps with the
+/// SIMD kernel.  The result is left empty, with no data, if it has no
+/// members.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int rsContainerCombine(const Allocator *allocator,
+    const RSContainer *a, const RSContainer *b, ALBitmapOp op,
+    RSScratch *scratch, RSContainer *result
+) {
+    memset(result, 0, sizeof(RSContainer));
+    uint16_t *values = scratch->values;
+    uint32_t count = 0;
+
+    if ((op == AL_BITMAP_AND) && (b->type == RS_TYPE_ARRAY)
+        && (a->type != RS_TYPE_ARRAY)
+    ) {
+        // Intersection is symmetric, so filter whichever side is the array
+        const RSContainer *swap = a;
+        a = b;
+        b = swap;
+    }
+
+    if ((a->type == RS_TYPE_ARRAY) && (b->type == RS_TYPE_ARRAY)
+        && (op == AL_BITMAP_OR)
+    ) {
+        const uint16_t *left = (const uint16_t*) a->data;
+        const uint16_t *right = (const uint16_t*) b->data;
+        uint32_t ii = 0;
+        uint32_t jj = 0;
+        while ((ii < a->count) || (jj < b->count)) {
+            if ((jj == b->count)
+                || ((ii < a->count) && (left[ii] < right[jj]))
+            ) {
+                values[count++] = left[ii++];
+            } else if ((ii == a->count) || (right[jj] < left[ii])) {
+                values[count++] = right[jj++];
+            } else {
+                values[count++] = left[ii++];
+                jj++;
+            }
+        }
+    } else if ((a->type == RS_TYPE_ARRAY) && (op != AL_BITMAP_OR)) {
+        const uint16_t *left = (const uint16_t*) a->data;
+        int keep = (op == AL_BITMAP_AND);
+        for (uint32_t ii = 0; ii < a->count; ii++) {
+            if (rsContainerContains(b, left[ii]) == keep) {
+                values[count++] = left[ii];
+            }
+        }
+    } else {
+        rsContainerToBitmap(a, scratch->left);
+        rsContainerToBitmap(b, scratch->right);
+        uint32_t cardinality = (uint32_t) alSimdBitmapCombine(scratch->left,
+            scratch->left, scratch->right, RS_BITMAP_WORDS, op);
+        if (cardinality == 0) {
+            return 0;
+        }
+        return rsContainerFromBitmap(allocator, scratch->left, cardinality,
+            result);
+    }
+
+    if (count == 0) {
+        return 0;
+    }
+
+    return rsContainerFromSorted(allocator, values, count, result);
+}
+
+// RoaringSet helper functions follow
+
+/// @fn static size_t rsFindKey(const RoaringSet *roaringSet, uint16_t key,
+///   int *found)
+///
+/// @brief Find where a key's container is or would go.
+///
+/// @return Returns the index of the container.  found is set to 1 if there is
+/// a container for the key, 0 if not.
+static size_t rsFindKey(const RoaringSet *roaringSet, uint16_t key,
+    int *found
+) {
+    size_t index = rsArrayLowerBound(roaringSet->keys,
+        roaringSet->numContainers, key);
+    *found = (index < roaringSet->numContainers)
+        && (roaringSet->keys[index] == key);
+
+    return index;
+}
+
+/// @fn static int rsInsertContainer(RoaringSet *roaringSet, size_t index,
+///   uint16_t key, const RSContainer *container)
+///
+/// @brief Add a container to a set at a given position.  The set takes over
+/// the container's data.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int rsInsertContainer(RoaringSet *roaringSet, size_t index,
+    uint16_t key, const RSContainer *container
+) {
+    if (roaringSet->numContainers == roaringSet->capacity) {
+        size_t oldCapacity = roaringSet->capacity;
+        size_t newCapacity = (oldCapacity > 0)
+            ? oldCapacity * 2 : RS_MIN_CONTAINERS;
+
+        uint16_t *keys = (uint16_t*) allocatorAlloc(&roaringSet->allocator,
+            newCapacity * sizeof(uint16_t));
+        if (keys == NULL) {
+            // Out of memory
+            return -1;
+        }
+
+        RSContainer *containers = (RSContainer*) allocatorRealloc(
+            &roaringSet->allocator, roaringSet->containers,
+            oldCapacity * sizeof(RSContainer),
+            newCapacity * sizeof(RSContainer));
+        if (containers == NULL) {
+            // Out of memory
+            allocatorFree(&roaringSet->allocator, keys,
+                newCapacity * sizeof(uint16_t));
+            keys = NULL;
+            return -1;
+        }
+
+        if (roaringSet->keys != NULL) {
+            memcpy(keys, roaringSet->keys,
+                roaringSet->numContainers * sizeof(uint16_t));
+        }
+        allocatorFree(&roaringSet->allocator, roaringSet->keys,
+            oldCapacity * sizeof(uint16_t));
+        roaringSet->keys = keys;
+        roaringSet->containers = containers;
+        roaringSet->capacity = newCapacity;
+    }
+
+    size_t after = roaringSet->numContainers - index;
+    memmove(&roaringSet->keys[index + 1], &roaringSet->keys[index],
+        after * sizeof(uint16_t));
+    memmove(&roaringSet->containers[index + 1],
+        &roaringSet->containers[index], after * sizeof(RSContainer));
+    roaringSet->keys[index] = key;
+    roaringSet->containers[index] = *container;
+    roaringSet->numContainers++;
+
+    return 0;
+}
+
+/// @fn static void rsRemoveContainer(RoaringSet *roaringSet, size_t index)
+///
+/// @brief Free a set's container and close the gap it leaves.
+static void rsRemoveContainer(RoaringSet *roaringSet, size_t index) {
+    rsContainerFree(&roaringSet->allocator, &roaringSet->containers[index]);
+
+    size_t after = roaringSet->numContainers - index - 1;
+    memmove(&roaringSet->keys[index], &roaringSet->keys[index + 1],
+        after * sizeof(uint16_t));
+    memmove(&roaringSet->containers[index],
+        &roaringSet->containers[index + 1], after * sizeof(RSContainer));
+    roaringSet->numContainers--;
+}
+
+/// @fn static void rsRadixSort(uint32_t *keys, uint32_t *scratch,
+///   size_t count)
+///
+/// @brief Sort keys with four passes of a byte-wise radix sort.
+static void rsRadixSort(uint32_t *keys, uint32_t *scratch, size_t count) {
+    for (unsigned shift = 0; shift < 32; shift += 8) {
+        size_t offsets[256] = {0};
+        for (size_t ii = 0; ii < count; ii++) {
+            offsets[(keys[ii] >> shift) & 0xFF]++;
+        }
+
+        size_t position = 0;
+        for (size_t ii = 0; ii < 256; ii++) {
+            size_t bucket = offsets[ii];
+            offsets[ii] = position;
+            position += bucket;
+        }
+        for (size_t ii = 0; ii < count; ii++) {
+            scratch[offsets[(keys[ii] >> shift) & 0xFF]++] = keys[ii];
+        }
+
+        uint32_t *swap = keys;
+        keys = scratch;
+        scratch = swap;
+    }
+    // After an even number of passes the sorted keys are back in keys
+}
+
+/// @fn static RoaringSet* rsCombine(RoaringSet *a, RoaringSet *b,
+///   ALBitmapOp op)
+///
+/// @brief Build the union, intersection or difference of two sets.
+///
+/// @return Returns a pointer to the new RoaringSet on success, NULL on
+/// failure.
+static RoaringSet* rsCombine(RoaringSet *a, RoaringSet *b, ALBitmapOp op) {
+    if ((a == NULL) || (b == NULL)) {
+        return NULL;
+    }
+
+    RoaringSet *result = roaringSetCreateWithAllocator(&a->allocator);
+    RSScratch *scratch = (RSScratch*) allocatorAlloc(&a->allocator,
+        sizeof(RSScratch));
+    if ((result == NULL) || (scratch == NULL)) {
+        allocatorFree(&a->allocator, scratch, sizeof(RSScratch));
+        scratch = NULL;
+        return roaringSetDestroy(result);
+    }
+
+    const Allocator *allocator = &result->allocator;
+    size_t ii = 0;
+    size_t jj = 0;
+    int status = 0;
+    while ((status == 0)
+        && ((ii < a->numContainers) || (jj < b->numContainers))
+    ) {
+        RSContainer container;
+        memset(&container, 0, sizeof(container));
+        uint16_t key;
+        if ((jj == b->numContainers)
+            || ((ii < a->numContainers) && (a->keys[ii] < b->keys[jj]))
+        ) {
+            key = a->keys[ii];
+            if (op != AL_BITMAP_AND) {
+                status = rsContainerCopy(allocator, &a->containers[ii],
+                    &container);
+            }
+            ii++;
+        } else if ((ii == a->numContainers) || (b->keys[jj] < a->keys[ii])) {
+            key = b->keys[jj];
+            if (op == AL_BITMAP_OR) {
+                status = rsContainerCopy(allocator, &b->containers[jj],
+                    &container);
+            }
+            jj++;
+        } else {
+            key = a->keys[ii];
+            status = rsContainerCombine(allocator, &a->containers[ii],
+                &b->containers[jj], op, scratch, &container);
+            ii++;
+            jj++;
+        }
+
+        if ((status == 0) && (container.cardinality > 0)) {
+            status = rsInsertContainer(result, result->numContainers, key,
+                &container);
+            if (status != 0) {
+                rsContainerFree(allocator, &container);
+            }
+        }
+    }
+
+    allocatorFree(&a->allocator, scratch, sizeof(RSScratch));
+    scratch = NULL;
+    if (status != 0) {
+        return roaringSetDestroy(result);
+    }
+
+    return result;
+}
+
+/// @fn static RSIter* rsIterLoad(RSIter *rsIter)
+///
+/// @brief Point an iterator at the first member of its current container, or
+/// of the next one with members.
+///
+/// @return Returns rsIter if there is a member to retrieve, NULL if not.
+static RSIter* rsIterLoad(RSIter *rsIter) {
+    RoaringSet *roaringSet = rsIter->roaringSet;
+    for (; rsIter->container < roaringSet->numContainers;
+        rsIter->container++
+    ) {
+        const RSContainer *container
+            = &roaringSet->containers[rsIter->container];
+        uint32_t high = (uint32_t) roaringSet->keys[rsIter->container] << 16;
+        rsIter->position = 0;
+        rsIter->offset = 0;
+        if (container->cardinality == 0) {
+            continue;
+        }
+
+        if (container->type == RS_TYPE_BITMAP) {
+            const uint64_t *words = (const uint64_t*) container->data;
+            while (words[rsIter->position] == 0) {
+                rsIter->position++;
+            }
+            uint64_t word = words[rsIter->position];
+            rsIter->value = rsValue(high | (rsIter->position * 64)
+                | (uint32_t) __builtin_ctzll(word));
+            rsIter->word = word & (word - 1);
+        } else {
+            const uint16_t *values = (const uint16_t*) container->data;
+            rsIter->value = rsValue(high | values[0]);
+        }
+
+        return rsIter;
+    }
+
+    return NULL;
+}
+
+/// @fn RoaringSet* roaringSetCreate(void)
+///
+/// @brief Create an empty roaring set.
+///
+/// @return Returns a pointer to the new RoaringSet on success, NULL on
+/// failure.
+RoaringSet* roaringSetCreate(void) {
+    return roaringSetCreateWithAllocator(NULL);
+}
+
+/// @fn RoaringSet* roaringSetCreateWithAllocator(const Allocator *allocator)
+///
+/// @brief Create an empty roaring set that gets all of its memory from a
+/// given allocator.
+///
+/// @param allocator The allocator to use, or NULL for malloc and free.  It is
+///   copied, so only its context has to outlive the set.
+///
+/// @return Returns a pointer to the new RoaringSet on success, NULL on
+/// failure.
+RoaringSet* roaringSetCreateWithAllocator(const Allocator *allocator) {
+    Allocator setAllocator
+        = (allocator != NULL) ? *allocator : allocatorLibc();
+
+    RoaringSet *roaringSet = (RoaringSet*) allocatorCalloc(&setAllocator, 1,
+        sizeof(RoaringSet));
+    if (roaringSet == NULL) {
+        // Out of memory
+        return NULL;
+    }
+    roaringSet->allocator = setAllocator;
+    // All other values are initialized to 0 by calloc
+
+    return roaringSet;
+}
+
+/// @fn RoaringSet* roaringSetCreateFromArrayList(ArrayList *arrayList)
+///
+/// @brief Build a roaring set of the values of an ArrayList.
+///
+/// @param arrayList A pointer to the ArrayList to take the values from.
+///
+/// @note Values are radix sorted unless the ArrayList is already sorted, and
+/// then each chunk is built straight into its smallest container.  This is
+/// much faster than adding the values one at a time.  The set uses the
+/// ArrayList's allocator.
+///
+/// @return Returns a pointer to the new RoaringSet on success, NULL on
+/// failure.
+RoaringSet* roaringSetCreateFromArrayList(ArrayList *arrayList) {
+    if (arrayList == NULL) {
+        return NULL;
+    }
+
+    const Allocator *allocator = &arrayList->allocator;
+    RoaringSet *roaringSet = roaringSetCreateWithAllocator(allocator);
+    size_t count = arrayList->listSize;
+    if ((roaringSet == NULL) || (count == 0)) {
+        return roaringSet;
+    }
+
+    int sorted = (arrayList->layout == AL_LAYOUT_SORTED);
+    size_t keyBytes = count * sizeof(uint32_t);
+    size_t lowBytes = ((size_t) UINT16_MAX + 1) * sizeof(uint16_t);
+    uint32_t *keys = (uint32_t*) allocatorAlloc(allocator, keyBytes);
+    uint32_t *scratch = sorted ? NULL
+        : (uint32_t*) allocatorAlloc(allocator, keyBytes);
+    uint16_t *lows = (uint16_t*) allocatorAlloc(allocator, lowBytes);
+
+    int status = -1;
+    if ((keys != NULL) && (sorted || (scratch != NULL)) && (lows != NULL)) {
+        for (size_t ii = 0; ii < count; ii++) {
+            keys[ii] = rsKey(arrayList->array[ii]);
+        }
+        if (!sorted) {
+            rsRadixSort(keys, scratch, count);
+        }
+
+        status = 0;
+        size_t ii = 0;
+        while ((status == 0) && (ii < count)) {
+            uint16_t key = (uint16_t) (keys[ii] >> 16);
+            uint32_t numLows = 0;
+            for (; (ii < count) && ((keys[ii] >> 16) == key); ii++) {
+                uint16_t low = (uint16_t) keys[ii];
+                if ((numLows == 0) || (lows[numLows - 1] != low)) {
+                    lows[numLows++] = low;
+                }
+            }
+
+            RSContainer container;
+            status = rsContainerFromSorted(&roaringSet->allocator, lows,
+                numLows, &container);
+            if (status == 0) {
+                status = rsInsertContainer(roaringSet,
+                    roaringSet->numContainers, key, &container);
+                if (status != 0) {
+                    rsContainerFree(&roaringSet->allocator, &container);
+                }
+            }
+        }
+    }
+
+    allocatorFree(allocator, lows, lowBytes);
+    lows = NULL;
+    allocatorFree(allocator, scratch, keyBytes);
+    scratch = NULL;
+    allocatorFree(allocator, keys, keyBytes);
+    keys = NULL;
+    if (status != 0) {
+        return roaringSetDestroy(roaringSet);
+    }
+
+    return roaringSet;
+}
+
+/// @fn RoaringSet* roaringSetDestroy(RoaringSet *roaringSet)
+///
+/// @brief Release all the memory held by a roaring set.
+///
+/// @param roaringSet A pointer to a previously-created RoaringSet.
+///
+/// @return This function always succeeds and always returns NULL.
+RoaringSet* roaringSetDestroy(RoaringSet *roaringSet) {
+    if (roaringSet != NULL) {
+        // The allocator is about to be freed along with the set
+        Allocator allocator = roaringSet->allocator;
+
+        for (size_t ii = 0; ii < roaringSet->numContainers; ii++) {
+            rsContainerFree(&allocator, &roaringSet->containers[ii]);
+        }
+        allocatorFree(&allocator, roaringSet->containers,
+            roaringSet->capacity * sizeof(RSContainer));
+        roaringSet->containers = NULL;
+        allocatorFree(&allocator, roaringSet->keys,
+            roaringSet->capacity * sizeof(uint16_t));
+        roaringSet->keys = NULL;
+        allocatorFree(&allocator, roaringSet, sizeof(RoaringSet));
+        roaringSet = NULL;
+    }
+
+    return NULL;
+}
+
+/// @fn int roaringSetAdd(RoaringSet *roaringSet, int value)
+///
+/// @brief Add a value to a roaring set.
+///
+/// @param roaringSet A pointer to a previously-created RoaringSet.
+/// @param value The value to add.
+///
+/// @return Returns 0 on success, including when the value was already there,
+/// -1 on failure.
+int roaringSetAdd(RoaringSet *roaringSet, int value) {
+    if (roaringSet == NULL) {
+        return -1;
+    }
+
+    uint32_t key = rsKey(value);
+    int found = 0;
+    size_t index = rsFindKey(roaringSet, (uint16_t) (key >> 16), &found);
+    if (found) {
+        return rsContainerAdd(&roaringSet->allocator,
+            &roaringSet->containers[index], (uint16_t) key);
+    }
+
+    uint16_t low = (uint16_t) key;
+    RSContainer container;
+    if (rsContainerFromSorted(&roaringSet->allocator, &low, 1,
+        &container) != 0
+    ) {
+        return -1;
+    }
+    if (rsInsertContainer(roaringSet, index, (uint16_t) (key >> 16),
+        &container) != 0
+    ) {
+        rsContainerFree(&roaringSet->allocator, &container);
+        return -1;
+    }
+
+    return 0;
+}
+
+/// @fn int roaringSetRemove(RoaringSet *roaringSet, int value)
+///
+/// @brief Remove a value from a roaring set.
+///
+/// @param roaringSet A pointer to a previously-created RoaringSet.
+/// @param value The value to remove.
+///
+/// @return Returns 0 on success, -1 if the value was not in the set or on
+/// failure.
+int roaringSetRemove(RoaringSet *roaringSet, int value) {
+    if (roaringSet == NULL) {
+        return -1;
+    }
+
+    uint32_t key = rsKey(value);
+    int found = 0;
+    size_t index = rsFindKey(roaringSet, (uint16_t) (key >> 16), &found);
+    if (!found || (rsContainerRemove(&roaringSet->allocator,
+        &roaringSet->containers[index], (uint16_t) key) != 0)
+    ) {
+        return -1;
+    }
+
+    if (roaringSet->containers[index].cardinality == 0) {
+        rsRemoveContainer(roaringSet, index);
+    }
+
+    return 0;
+}
+
+/// @fn int roaringSetContains(RoaringSet *roaringSet, int value)
+///
+/// @brief Check whether a value is in a roaring set.
+///
+/// @param roaringSet A pointer to a previously-created RoaringSet.
+/// @param value The value to look for.
+///
+/// @note Finding the container is a binary search over at most 65536 keys.
+/// Within it, a bitmap is one bit test and arrays and runs are binary
+/// searched.
+///
+/// @return Returns 1 if the value is in the set, 0 if not or on failure.
+int roaringSetContains(RoaringSet *roaringSet, int value) {
+    if (roaringSet == NULL) {
+        return 0;
+    }
+
+    uint32_t key = rsKey(value);
+    int found = 0;
+    size_t index = rsFindKey(roaringSet, (uint16_t) (key >> 16), &found);
+
+    return found
+        && rsContainerContains(&roaringSet->containers[index], (uint16_t) key);
+}
+
+/// @fn size_t roaringSetCardinality(RoaringSet *roaringSet)
+///
+/// @brief Get the number of values in a roaring set.
+///
+/// @param roaringSet A pointer to a previously-created RoaringSet.
+///
+/// @return Returns the number of values, 0 if roaringSet is NULL.
+size_t roaringSetCardinality(RoaringSet *roaringSet) {
+    if (roaringSet == NULL) {
+        return 0;
+    }
+
+    size_t cardinality = 0;
+    for (size_t ii = 0; ii < roaringSet->numContainers; ii++) {
+        cardinality += roaringSet->containers[ii].cardinality;
+    }
+
+    return cardinality;
+}
+
+/// @fn size_t roaringSetMemoryUsage(RoaringSet *roaringSet)
+///
+/// @brief Get the number of bytes a roaring set takes up.
+///
+/// @param roaringSet A pointer to a previously-created RoaringSet.
+///
+/// @return Returns the bytes allocated for the set and its containers, 0 if
+/// roaringSet is NULL.
+size_t roaringSetMemoryUsage(RoaringSet *roaringSet) {
+    if (roaringSet == NULL) {
+        return 0;
+    }
+
+    size_t bytes = sizeof(RoaringSet)
+        + (roaringSet->capacity * (sizeof(uint16_t) + sizeof(RSContainer)));
+    for (size_t ii = 0; ii < roaringSet->numContainers; ii++) {
+        bytes += roaringSet->containers[ii].bytes;
+    }
+
+    return bytes;
+}
+
+// Set algebra functions follow
+
+/// @fn RoaringSet* roaringSetUnion(RoaringSet *a, RoaringSet *b)
+///
+/// @brief Build a new set of the values in either of two sets.
+///
+/// @param a A pointer to the first RoaringSet.
+/// @param b A pointer to the second RoaringSet.
+///
+/// @note The new set uses a's allocator.
+///
+/// @return Returns a pointer to the new RoaringSet on success, NULL on
+/// failure.
+RoaringSet* roaringSetUnion(RoaringSet *a, RoaringSet *b) {
+    return rsCombine(a, b, AL_BITMAP_OR);
+}
+
+/// @fn RoaringSet* roaringSetIntersection(RoaringSet *a, RoaringSet *b)
+///
+/// @brief Build a new set of the values in both of two sets.
+///
+/// @param a A pointer to the first RoaringSet.
+/// @param b A pointer to the second RoaringSet.
+///
+/// @note The new set uses a's allocator.
+///
+/// @return Returns a pointer to the new RoaringSet on success, NULL on
+/// failure.
+RoaringSet* roaringSetIntersection(RoaringSet *a, RoaringSet *b) {
+    return rsCombine(a, b, AL_BITMAP_AND);
+}
+
+/// @fn RoaringSet* roaringSetDifference(RoaringSet *a, RoaringSet *b)
+///
+/// @brief Build a new set of the values in one set but not another.
+///
+/// @param a A pointer to the RoaringSet to take values from.
+/// @param b A pointer to the RoaringSet of values to leave out.
+///
+/// @note The new set uses a's allocator.
+///
+/// @return Returns a pointer to the new RoaringSet on success, NULL on
+/// failure.
+RoaringSet* roaringSetDifference(RoaringSet *a, RoaringSet *b) {
+    return rsCombine(a, b, AL_BITMAP_ANDNOT);
+}
+
+// Traversal functions follow
+
+/// @fn int roaringSetForEach(RoaringSet *roaringSet,
+///   void (*visit)(int value, void *context), void *context)
+///
+/// @brief Call a function for every value in a roaring set, in ascending
+/// order.
+///
+/// @param roaringSet A pointer to the RoaringSet to traverse.
+/// @param visit The function to call with each value.
+/// @param context An arbitrary pointer passed through to visit.
+///
+/// @return Returns 0 on success, -1 on failure.
+int roaringSetForEach(RoaringSet *roaringSet,
+    void (*visit)(int value, void *context), void *context
+) {
+    if ((roaringSet == NULL) || (visit == NULL)) {
+        return -1;
+    }
+
+    RSIter iterStorage;
+    for (RSIter *rsIter = rsIterInit(&iterStorage, roaringSet);
+        rsIter != NULL;
+        rsIter = rsIterStep(rsIter)
+    ) {
+        visit(rsIterValue(rsIter), context);
+    }
+
+    return 0;
+}
+
+/// @fn ArrayList* roaringSetToArrayList(RoaringSet *roaringSet)
+///
+/// @brief Copy the values of a roaring set into a new, sorted ArrayList.
+///
+/// @param roaringSet A pointer to the RoaringSet to copy.
+///
+/// @note The ArrayList uses the set's allocator.
+///
+/// @return Returns a pointer to the new ArrayList on success, NULL on
+/// failure.
+ArrayList* roaringSetToArrayList(RoaringSet *roaringSet) {
+    if (roaringSet == NULL) {
+        return NULL;
+    }
+
+    ArrayList *arrayList = arrayListCreateWithAllocator(&roaringSet->allocator);
+    if ((arrayList == NULL) || (arrayListReserve(arrayList,
+        roaringSetCardinality(roaringSet)) != 0)
+    ) {
+        return arrayListDestroy(arrayList);
+    }
+
+    RSIter iterStorage;
+    for (RSIter *rsIter = rsIterInit(&iterStorage, roaringSet);
+        rsIter != NULL;
+        rsIter = rsIterStep(rsIter)
+    ) {
+        if (arrayListInsert(arrayList, rsIterValue(rsIter)) != 0) {
+            return arrayListDestroy(arrayList);
+        }
+    }
+    arrayList->layout = AL_LAYOUT_SORTED;
+
+    return arrayList;
+}
+
+// RoaringSet iterator functions follow
+
+/// @fn RSIter* rsIterInit(RSIter *rsIter, RoaringSet *roaringSet)
+///
+/// @brief Initialize caller-provided storage as an iterator for a RoaringSet.
+///
+/// @param rsIter A pointer to the RSIter to initialize.  It can live on the
+///   stack or be embedded in another structure.
+/// @param roaringSet A pointer to the RoaringSet to iterate over.
+///
+/// @note The iterator is advanced with rsIterStep, the same way as an ALIter
+/// initialized with alIterInit.  Changing the set invalidates it.
+///
+/// @return Returns rsIter if the RoaringSet has a value to retrieve, NULL if
+/// it is empty or on failure.
+RSIter* rsIterInit(RSIter *rsIter, RoaringSet *roaringSet) {
+    if ((rsIter == NULL) || (roaringSet == NULL)) {
+        return NULL;
+    }
+
+    rsIter->roaringSet = roaringSet;
+    rsIter->container = 0;
+    rsIter->word = 0;
+
+    return rsIterLoad(rsIter);
+}
+
+/// @fn RSIter* rsIterStep(RSIter *rsIter)
+///
+/// @brief Prepare an iterator initialized by rsIterInit for retrieving the
+/// next value.
+///
+/// @param rsIter A pointer to the RSIter to prepare.
+///
+/// @return Returns rsIter if there is another value to retrieve, NULL if not.
+RSIter* rsIterStep(RSIter *rsIter) {
+    if (rsIter == NULL) {
+        return NULL;
+    }
+
+    RoaringSet *roaringSet = rsIter->roaringSet;
+    const RSContainer *container = &roaringSet->containers[rsIter->container];
+    uint32_t high = (uint32_t) roaringSet->keys[rsIter->container] << 16;
+
+    if (container->type == RS_TYPE_BITMAP) {
+        const uint64_t *words = (const uint64_t*) container->data;
+        while ((rsIter->word == 0)
+            && (++rsIter->position < RS_BITMAP_WORDS)
+        ) {
+            rsIter->word = words[rsIter->position];
+        }
+        if (rsIter->word != 0) {
+            rsIter->value = rsValue(high | (rsIter->position * 64)
+                | (uint32_t) __builtin_ctzll(rsIter->word));
+            rsIter->word &= rsIter->word - 1;
+            return rsIter;
+        }
+    } else if (container->type == RS_TYPE_ARRAY) {
+        const uint16_t *values = (const uint16_t*) container->data;
+        if (++rsIter->position < container->count) {
+            rsIter->value = rsValue(high | values[rsIter->position]);
+            return rsIter;
+        }
+    } else {
+        const uint16_t *runs = (const uint16_t*) container->data;
+        if (rsIter->offset < runs[(2 * rsIter->position) + 1]) {
+            rsIter->offset++;
+            rsIter->value = rsValue(high
+                | (runs[2 * rsIter->position] + rsIter->offset));
+            return rsIter;
+        }
+        rsIter->offset = 0;
+        if (++rsIter->position < container->count) {
+            rsIter->value = rsValue(high | runs[2 * rsIter->position]);
+            return rsIter;
+        }
+    }
+
+    rsIter->container++;
+    rsIter->word = 0;
+
+    return rsIterLoad(rsIter);
+}
+
+/// @fn int rsIterValue(RSIter *rsIter)
+///
+/// @brief Retrieve the current value of the RoaringSet iterator.
+///
+/// @param rsIter A pointer to the RSIter to retrieve the value from.
+///
+/// @note It is assumed that the rsIter parameter is non-NULL.  This function
+/// does not check for that.  It is the responsibility of the caller to make
+/// sure that the parameter is not NULL before calling this function.
+///
+/// @return Returns the current value of the RoaringSet iterator.
+int rsIterValue(RSIter *rsIter) {
+    return rsIter->value;
+}
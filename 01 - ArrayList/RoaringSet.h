@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              RoaringSet.h
+///
+/// @brief             Roaring bitmap implementation of a set of ints in C.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ROARING_SET_H
+#define ROARING_SET_H
+
+// Standard C includes
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ArrayList.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct RoaringSet
+///
+/// @brief A set of ints split by their high 16 bits into chunks of 65536
+/// possible values.  Each chunk that has any members is stored in whichever
+/// container is smallest for it:  a sorted array of the low 16 bits, a 65536
+/// bit bitmap, or a list of runs of consecutive values.
+///
+/// @var keys The high 16 bits of each chunk, in ascending order.
+/// @var containers The container of each chunk.  Private to RoaringSet.c.
+/// @var numContainers The number of chunks with members.
+/// @var capacity The number of chunks keys and containers have room for.
+/// @var allocator Where the set and its containers get their memory.
+typedef struct RoaringSet {
+    uint16_t *keys;
+    struct RSContainer *containers;
+    size_t numContainers;
+    size_t capacity;
+    Allocator allocator;
+} RoaringSet;
+
+/// @struct RSIter
+///
+/// @brief Implementation of an iterator for a RoaringSet.  Members come out in
+/// ascending order.
+///
+/// @var roaringSet A pointer to the RoaringSet currently being iterated over.
+/// @var container The index of the container the current member is in.
+/// @var position Where the current member is in its container:  an array
+///   index, a bitmap word or a run.
+/// @var offset How far into its run the current member is.
+/// @var word The bits of the current bitmap word not yet returned.
+/// @var value The current member.
+typedef struct RSIter {
+    RoaringSet *roaringSet;
+    size_t container;
+    uint32_t position;
+    uint32_t offset;
+    uint64_t word;
+    int value;
+} RSIter;
+
+// Base RoaringSet prototypes
+RoaringSet* roaringSetCreate(void);
+RoaringSet* roaringSetCreateWithAllocator(const Allocator *allocator);
+RoaringSet* roaringSetCreateFromArrayList(ArrayList *arrayList);
+RoaringSet* roaringSetDestroy(RoaringSet *roaringSet);
+int roaringSetAdd(RoaringSet *roaringSet, int value);
+int roaringSetRemove(RoaringSet *roaringSet, int value);
+int roaringSetContains(RoaringSet *roaringSet, int value);
+size_t roaringSetCardinality(RoaringSet *roaringSet);
+size_t roaringSetMemoryUsage(RoaringSet *roaringSet);
+
+// Set algebra prototypes
+RoaringSet* roaringSetUnion(RoaringSet *a, RoaringSet *b);
+RoaringSet* roaringSetIntersection(RoaringSet *a, RoaringSet *b);
+RoaringSet* roaringSetDifference(RoaringSet *a, RoaringSet *b);
+
+// Traversal prototypes
+int roaringSetForEach(RoaringSet *roaringSet,
+    void (*visit)(int value, void *context), void *context);
+ArrayList* roaringSetToArrayList(RoaringSet *roaringSet);
+
+// RoaringSet iterator prototypes
+RSIter* rsIterInit(RSIter *rsIter, RoaringSet *roaringSet);
+RSIter* rsIterStep(RSIter *rsIter);
+int rsIterValue(RSIter *rsIter);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // ROARING_SET_H
@@ -0,0 +1,471 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ConcurrentQueue.c
+///
+/// @brief Library implementation of the ConcurrentQueue.
+///
+/// This is the Michael-Scott queue:  a singly-linked list with a dummy node at
+/// the head, where pushes swing the tail and pops swing the head with
+/// compare-and-swap.  Popped nodes can't be freed right away because other
+/// threads may still be reading them, so each thread publishes the nodes it is
+/// about to read in hazard pointers and only frees retired nodes that no
+/// hazard pointer refers to.
+
+// Standard C includes
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ConcurrentQueue.h"
+
+/// @def CACHE_LINE_SIZE
+///
+/// @brief Alignment used to keep the head and tail on separate cache lines.
+#define CACHE_LINE_SIZE 64
+
+/// @def HAZARDS_PER_HANDLE
+///
+/// @brief Number of nodes a thread ever needs to protect at once.
+#define HAZARDS_PER_HANDLE 2
+
+/// @def MIN_RETIRED_BEFORE_SCAN
+///
+/// @brief Fewest retired nodes a handle collects before trying to free them.
+#define MIN_RETIRED_BEFORE_SCAN 64
+
+/// @struct CQNode
+///
+/// @brief Individual node of a ConcurrentQueue.
+///
+/// @param next Pointer to the next node in the queue.
+/// @param value The value that is at this node, stored inline.
+typedef struct CQNode {
+    _Atomic(struct CQNode*) next;
+    unsigned char value[];
+} CQNode;
+
+struct CQHandle {
+    ConcurrentQueue *queue;
+    _Atomic(CQNode*) hazards[HAZARDS_PER_HANDLE];
+    atomic_int active;
+    CQHandle *nextHandle;
+    CQNode **retired;
+    size_t numRetired;
+    size_t retiredCapacity;
+};
+
+struct ConcurrentQueue {
+    alignas(CACHE_LINE_SIZE) _Atomic(CQNode*) head;
+    alignas(CACHE_LINE_SIZE) _Atomic(CQNode*) tail;
+    alignas(CACHE_LINE_SIZE) _Atomic(CQHandle*) handles;
+    atomic_int numHandles;
+    int valueSize;
+};
+
+/// @fn static CQNode* cqNodeCreate(ConcurrentQueue *concurrentQueue,
+///   const void *value)
+///
+/// @brief Allocate a node and copy a value into it.
+///
+/// @return Returns a pointer to the new node on success, NULL on failure.
+static CQNode* cqNodeCreate(ConcurrentQueue *concurrentQueue,
+    const void *value
+) {
+    size_t valueSize = (size_t) concurrentQueue->valueSize;
+    CQNode *node = (CQNode*) malloc(sizeof(CQNode) + valueSize);
+    if (node == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    atomic_init(&node->next, NULL);
+    if (value != NULL) {
+        memcpy(node->value, value, valueSize);
+    }
+
+    return node;
+}
+
+/// @fn static CQNode* cqProtect(CQHandle *cqHandle, int slot,
+///   _Atomic(CQNode*) *source)
+///
+/// @brief Read a node pointer and publish it in a hazard pointer so that it
+/// can't be freed while we use it.
+///
+/// @note The pointer is re-read after being published.  If it still matches,
+/// no thread could have retired the node before it became hazardous.
+///
+/// @return Returns the protected node pointer.
+static CQNode* cqProtect(CQHandle *cqHandle, int slot,
+    _Atomic(CQNode*) *source
+) {
+    CQNode *node = atomic_load(source);
+    for (;;) {
+        atomic_store(&cqHandle->hazards[slot], node);
+        CQNode *check = atomic_load(source);
+        if (check == node) {
+            return node;
+        }
+        node = check;
+    }
+}
+
+/// @fn static void cqClearHazards(CQHandle *cqHandle)
+///
+/// @brief Drop all the hazard pointers a handle is holding.
+static void cqClearHazards(CQHandle *cqHandle) {
+    for (int ii = 0; ii < HAZARDS_PER_HANDLE; ii++) {
+        atomic_store_explicit(&cqHandle->hazards[ii], NULL,
+            memory_order_release);
+    }
+}
+
+/// @fn static int cqIsHazardous(ConcurrentQueue *concurrentQueue,
+///   CQNode *node)
+///
+/// @brief Check whether any thread has a node published in a hazard pointer.
+///
+/// @return Returns 1 if the node is protected, 0 if it can be freed.
+static int cqIsHazardous(ConcurrentQueue *concurrentQueue, CQNode *node) {
+    for (CQHandle *cur = atomic_load(&concurrentQueue->handles);
+        cur != NULL;
+        cur = cur->nextHandle
+    ) {
+        for (int ii = 0; ii < HAZARDS_PER_HANDLE; ii++) {
+            if (atomic_load(&cur->hazards[ii]) == node) {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/// @fn static void cqScan(CQHandle *cqHandle)
+///
+/// @brief Free every node a handle has retired that no hazard pointer protects.
+static void cqScan(CQHandle *cqHandle) {
+    size_t kept = 0;
+    for (size_t ii = 0; ii < cqHandle->numRetired; ii++) {
+        CQNode *node = cqHandle->retired[ii];
+        if (cqIsHazardous(cqHandle->queue, node)) {
+            cqHandle->retired[kept++] = node;
+        } else {
+            free(node);
+        }
+    }
+    cqHandle->numRetired = kept;
+}
+
+/// @fn static void cqRetire(CQHandle *cqHandle, CQNode *node)
+///
+/// @brief Hand a node that has been unlinked from the queue to the reclaimer.
+///
+/// @note Scans are batched so that each one frees a number of nodes
+/// proportional to the number of hazard pointers it has to check.  If the
+/// retired list can't grow, we scan immediately instead.
+static void cqRetire(CQHandle *cqHandle, CQNode *node) {
+    if (cqHandle->numRetired == cqHandle->retiredCapacity) {
+        size_t newCapacity = cqHandle->retiredCapacity * 2;
+        void *check = realloc(cqHandle->retired, newCapacity * sizeof(CQNode*));
+        if (check == NULL) {
+            cqScan(cqHandle);
+            if (cqHandle->numRetired == cqHandle->retiredCapacity) {
+                // Every retired node is still in use.  Leaking one node is
+                // better than freeing it out from under another thread.
+                return;
+            }
+        } else {
+            cqHandle->retired = (CQNode**) check;
+            cqHandle->retiredCapacity = newCapacity;
+        }
+    }
+    cqHandle->retired[cqHandle->numRetired++] = node;
+
+    size_t threshold = (size_t) (2 * HAZARDS_PER_HANDLE)
+        * (size_t) atomic_load(&cqHandle->queue->numHandles);
+    if (threshold < MIN_RETIRED_BEFORE_SCAN) {
+        threshold = MIN_RETIRED_BEFORE_SCAN;
+    }
+    if (cqHandle->numRetired >= threshold) {
+        cqScan(cqHandle);
+    }
+}
+
+/// @fn ConcurrentQueue* concurrentQueueCreate(int valueSize)
+///
+/// @brief Allocate and initialize an empty concurrent queue.
+///
+/// @param valueSize The number of bytes every value in the queue takes up.
+///
+/// @return Returns a pointer to an allocated and initialized ConcurrentQueue on
+/// success, NULL on failure.
+ConcurrentQueue* concurrentQueueCreate(int valueSize) {
+    if (valueSize < 0) {
+        return NULL;
+    }
+
+    ConcurrentQueue *concurrentQueue =
+        (ConcurrentQueue*) aligned_alloc(CACHE_LINE_SIZE,
+            sizeof(ConcurrentQueue));
+    if (concurrentQueue == NULL) {
+        // Out of memory
+        return NULL;
+    }
+    concurrentQueue->valueSize = valueSize;
+
+    // The queue always starts with a dummy node so head and tail are never
+    // NULL
+    CQNode *dummy = cqNodeCreate(concurrentQueue, NULL);
+    if (dummy == NULL) {
+        free(concurrentQueue); concurrentQueue = NULL;
+        return NULL;
+    }
+
+    atomic_init(&concurrentQueue->head, dummy);
+    atomic_init(&concurrentQueue->tail, dummy);
+    atomic_init(&concurrentQueue->handles, NULL);
+    atomic_init(&concurrentQueue->numHandles, 0);
+
+    return concurrentQueue;
+}
+
+/// @fn ConcurrentQueue* concurrentQueueDestroy(
+///   ConcurrentQueue *concurrentQueue)
+///
+/// @brief Release all the memory held by a concurrent queue, including every
+/// handle ever registered with it.
+///
+/// @param concurrentQueue A pointer to a previously-created ConcurrentQueue.
+///
+/// @note No other thread may be using the queue or any of its handles.
+///
+/// @return This function always succeeds and always returns NULL.
+ConcurrentQueue* concurrentQueueDestroy(ConcurrentQueue *concurrentQueue) {
+    if (concurrentQueue == NULL) {
+        return NULL;
+    }
+
+    CQNode *node = atomic_load(&concurrentQueue->head);
+    while (node != NULL) {
+        CQNode *next = atomic_load(&node->next);
+        free(node);
+        node = next;
+    }
+
+    CQHandle *cqHandle = atomic_load(&concurrentQueue->handles);
+    while (cqHandle != NULL) {
+        CQHandle *next = cqHandle->nextHandle;
+        for (size_t ii = 0; ii < cqHandle->numRetired; ii++) {
+            free(cqHandle->retired[ii]);
+        }
+        free(cqHandle->retired);
+        free(cqHandle);
+        cqHandle = next;
+    }
+
+    free(concurrentQueue); concurrentQueue = NULL;
+
+    return NULL;
+}
+
+/// @fn CQHandle* concurrentQueueRegister(ConcurrentQueue *concurrentQueue)
+///
+/// @brief Get a handle for the calling thread to use a concurrent queue with.
+///
+/// @param concurrentQueue A pointer to a previously-created ConcurrentQueue.
+///
+/// @note Handles given up with concurrentQueueUnregister are reused before new
+/// ones are allocated.
+///
+/// @return Returns a pointer to a CQHandle on success, NULL on failure.
+CQHandle* concurrentQueueRegister(ConcurrentQueue *concurrentQueue) {
+    if (concurrentQueue == NULL) {
+        return NULL;
+    }
+
+    // Try to claim a handle that another thread has given up
+    for (CQHandle *cur = atomic_load(&concurrentQueue->handles);
+        cur != NULL;
+        cur = cur->nextHandle
+    ) {
+        int inactive = 0;
+        if (atomic_compare_exchange_strong(&cur->active, &inactive, 1)) {
+            return cur;
+        }
+    }
+
+    CQHandle *cqHandle = (CQHandle*) calloc(1, sizeof(CQHandle));
+    if (cqHandle == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    cqHandle->retiredCapacity = MIN_RETIRED_BEFORE_SCAN;
+    cqHandle->retired =
+        (CQNode**) malloc(cqHandle->retiredCapacity * sizeof(CQNode*));
+    if (cqHandle->retired == NULL) {
+        free(cqHandle); cqHandle = NULL;
+        return NULL;
+    }
+    cqHandle->queue = concurrentQueue;
+    for (int ii = 0; ii < HAZARDS_PER_HANDLE; ii++) {
+        atomic_init(&cqHandle->hazards[ii], NULL);
+    }
+    atomic_init(&cqHandle->active, 1);
+
+    // Handles are only ever added to the front of the list and never removed
+    // until the queue is destroyed, so readers can walk it without locking
+    CQHandle *head = atomic_load(&concurrentQueue->handles);
+    do {
+        cqHandle->nextHandle = head;
+    } while (!atomic_compare_exchange_weak(&concurrentQueue->handles,
+        &head, cqHandle));
+    atomic_fetch_add(&concurrentQueue->numHandles, 1);
+
+    return cqHandle;
+}
+
+/// @fn CQHandle* concurrentQueueUnregister(CQHandle *cqHandle)
+///
+/// @brief Give up a thread's handle so that another thread can reuse it.
+///
+/// @param cqHandle A pointer to the handle returned by concurrentQueueRegister.
+///
+/// @note Any retired nodes that are still protected stay with the handle and
+/// are freed by whichever thread uses it next, or by concurrentQueueDestroy.
+///
+/// @return This function always succeeds and always returns NULL.
+CQHandle* concurrentQueueUnregister(CQHandle *cqHandle) {
+    if (cqHandle == NULL) {
+        return NULL;
+    }
+
+    cqClearHazards(cqHandle);
+    cqScan(cqHandle);
+    atomic_store(&cqHandle->active, 0);
+
+    return NULL;
+}
+
+/// @fn int concurrentQueuePushBack(CQHandle *cqHandle, const void *value)
+///
+/// @brief Insert a new value at the back of a concurrent queue.
+///
+/// @param cqHandle The calling thread's handle for the queue.
+/// @param value A pointer to the value to copy to the back of the queue.
+///
+/// @return Returns 0 on success, -1 on failure.
+int concurrentQueuePushBack(CQHandle *cqHandle, const void *value) {
+    if ((cqHandle == NULL) || (value == NULL)) {
+        return -1;
+    }
+
+    ConcurrentQueue *concurrentQueue = cqHandle->queue;
+    CQNode *node = cqNodeCreate(concurrentQueue, value);
+    if (node == NULL) {
+        return -1;
+    }
+
+    for (;;) {
+        CQNode *tail = cqProtect(cqHandle, 0, &concurrentQueue->tail);
+        CQNode *next = atomic_load(&tail->next);
+        if (tail != atomic_load(&concurrentQueue->tail)) {
+            continue;
+        }
+
+        if (next != NULL) {
+            // Another push linked its node but hasn't swung the tail yet.
+            // Help it along and try again.
+            atomic_compare_exchange_strong(&concurrentQueue->tail, &tail, next);
+            continue;
+        }
+
+        CQNode *expected = NULL;
+        if (atomic_compare_exchange_strong(&tail->next, &expected, node)) {
+            // Linked in.  If this fails someone already helped us.
+            atomic_compare_exchange_strong(&concurrentQueue->tail, &tail, node);
+            break;
+        }
+    }
+    cqClearHazards(cqHandle);
+
+    return 0;
+}
+
+/// @fn int concurrentQueuePopFront(CQHandle *cqHandle, void *value)
+///
+/// @brief Copy out the value from the front of a concurrent queue if there is
+/// one and remove it.
+///
+/// @param cqHandle The calling thread's handle for the queue.
+/// @param value A pointer to a buffer at least as big as the queue's value size
+///   to copy the value into, or NULL to discard the value.
+///
+/// @return Returns 0 on success, -1 if the queue was empty.
+int concurrentQueuePopFront(CQHandle *cqHandle, void *value) {
+    if (cqHandle == NULL) {
+        return -1;
+    }
+
+    ConcurrentQueue *concurrentQueue = cqHandle->queue;
+    for (;;) {
+        CQNode *head = cqProtect(cqHandle, 0, &concurrentQueue->head);
+        CQNode *tail = atomic_load(&concurrentQueue->tail);
+        CQNode *next = atomic_load(&head->next);
+        atomic_store(&cqHandle->hazards[1], next);
+        if (head != atomic_load(&concurrentQueue->head)) {
+            // head was popped while we were looking, so next may be stale
+            continue;
+        }
+
+        if (next == NULL) {
+            // Only the dummy node is left
+            cqClearHazards(cqHandle);
+            return -1;
+        }
+
+        if (head == tail) {
+            // The tail is lagging behind a push in progress.  Help it along.
+            atomic_compare_exchange_strong(&concurrentQueue->tail, &tail, next);
+            continue;
+        }
+
+        if (atomic_compare_exchange_strong(&concurrentQueue->head, &head, next)) {
+            // next is the new dummy node.  Our hazard pointer keeps it alive
+            // until we're done copying its value out.
+            if (value != NULL) {
+                memcpy(value, next->value, (size_t) concurrentQueue->valueSize);
+            }
+            cqClearHazards(cqHandle);
+            cqRetire(cqHandle, head);
+            return 0;
+        }
+    }
+}
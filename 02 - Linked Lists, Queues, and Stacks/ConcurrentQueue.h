@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              ConcurrentQueue.h
+///
+/// @brief             Lock-free multi-producer, multi-consumer queue in C.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct ConcurrentQueue
+///
+/// @brief Lock-free FIFO queue that any number of threads can push to and pop
+/// from at once.  The layout is private to ConcurrentQueue.c because it is
+/// made of C11 atomics.
+typedef struct ConcurrentQueue ConcurrentQueue;
+
+/// @struct CQHandle
+///
+/// @brief A thread's registration with a ConcurrentQueue.  It holds the
+/// thread's hazard pointers and the nodes it has retired but not yet freed.
+/// Each thread that uses a queue needs its own handle.
+typedef struct CQHandle CQHandle;
+
+// Base ConcurrentQueue prototypes
+ConcurrentQueue* concurrentQueueCreate(int valueSize);
+ConcurrentQueue* concurrentQueueDestroy(ConcurrentQueue *concurrentQueue);
+CQHandle* concurrentQueueRegister(ConcurrentQueue *concurrentQueue);
+CQHandle* concurrentQueueUnregister(CQHandle *cqHandle);
+int concurrentQueuePushBack(CQHandle *cqHandle, const void *value);
+int concurrentQueuePopFront(CQHandle *cqHandle, void *value);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // CONCURRENT_QUEUE_H
@@ -0,0 +1,305 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ConcurrentQueueBenchmark.c
+///
+/// @brief Measure how ConcurrentQueue throughput scales with the number of
+/// producer and consumer threads, next to a LinkedList guarded by a mutex.
+///
+/// Usage:  ConcurrentQueueBenchmark [maxThreads] [pushesPerProducer]
+///
+/// For every thread count n from 1 up to maxThreads (doubling each time), n
+/// producers push pushesPerProducer values each while n consumers pop until
+/// every value has been seen.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ConcurrentQueue.h"
+#include "LinkedList.h"
+
+/// @def DEFAULT_PUSHES_PER_PRODUCER
+///
+/// @brief Values each producer pushes when not given on the command line.
+#define DEFAULT_PUSHES_PER_PRODUCER 1000000
+
+/// @struct BenchQueue
+///
+/// @brief The queue under test.  Exactly one of concurrentQueue and linkedList
+/// is used.
+typedef struct BenchQueue {
+    ConcurrentQueue *concurrentQueue;
+    LinkedList *linkedList;
+    pthread_mutex_t lock;
+    long long pushesPerProducer;
+    long long totalPushes;
+    atomic_int failed;
+    atomic_llong popped;
+    atomic_llong poppedSum;
+} BenchQueue;
+
+static int compareLongLong(const void *a, const void *b) {
+    long long left = *((const long long*) a);
+    long long right = *((const long long*) b);
+    return (left > right) - (left < right);
+}
+
+static double nowSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + ((double) now.tv_nsec * 1e-9);
+}
+
+static void* lockFreeProducer(void *arg) {
+    BenchQueue *benchQueue = (BenchQueue*) arg;
+    CQHandle *cqHandle = concurrentQueueRegister(benchQueue->concurrentQueue);
+    if (cqHandle == NULL) {
+        atomic_store(&benchQueue->failed, 1);
+        return NULL;
+    }
+
+    for (long long ii = 1; ii <= benchQueue->pushesPerProducer; ii++) {
+        while (concurrentQueuePushBack(cqHandle, &ii) != 0) {
+            if (atomic_load(&benchQueue->failed) != 0) {
+                // No consumer may be left to make room
+                cqHandle = concurrentQueueUnregister(cqHandle);
+                return NULL;
+            }
+            // Out of memory.  Wait for the consumers to catch up.
+            sched_yield();
+        }
+    }
+
+    cqHandle = concurrentQueueUnregister(cqHandle);
+    return NULL;
+}
+
+static void* lockFreeConsumer(void *arg) {
+    BenchQueue *benchQueue = (BenchQueue*) arg;
+    CQHandle *cqHandle = concurrentQueueRegister(benchQueue->concurrentQueue);
+    if (cqHandle == NULL) {
+        atomic_store(&benchQueue->failed, 1);
+        return NULL;
+    }
+    long long sum = 0;
+    long long value = 0;
+
+    // A failed thread means not everything will be pushed, so stop waiting
+    while ((atomic_load(&benchQueue->popped) < benchQueue->totalPushes)
+        && (atomic_load(&benchQueue->failed) == 0)
+    ) {
+        if (concurrentQueuePopFront(cqHandle, &value) == 0) {
+            atomic_fetch_add(&benchQueue->popped, 1);
+            sum += value;
+        }
+    }
+
+    atomic_fetch_add(&benchQueue->poppedSum, sum);
+    cqHandle = concurrentQueueUnregister(cqHandle);
+    return NULL;
+}
+
+static void* lockedProducer(void *arg) {
+    BenchQueue *benchQueue = (BenchQueue*) arg;
+
+    for (long long ii = 1; ii <= benchQueue->pushesPerProducer; ii++) {
+        pthread_mutex_lock(&benchQueue->lock);
+        int status = linkedListInsertBack(benchQueue->linkedList, &ii,
+            sizeof(ii));
+        pthread_mutex_unlock(&benchQueue->lock);
+        if (status != 0) {
+            if (atomic_load(&benchQueue->failed) != 0) {
+                // No consumer may be left to make room
+                return NULL;
+            }
+            // Out of memory.  Wait for the consumers to catch up.
+            ii--;
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+static void* lockedConsumer(void *arg) {
+    BenchQueue *benchQueue = (BenchQueue*) arg;
+    long long sum = 0;
+    long long value = 0;
+
+    while ((atomic_load(&benchQueue->popped) < benchQueue->totalPushes)
+        && (atomic_load(&benchQueue->failed) == 0)
+    ) {
+        pthread_mutex_lock(&benchQueue->lock);
+        int status = linkedListPopFront(benchQueue->linkedList,
+            &value, sizeof(value));
+        pthread_mutex_unlock(&benchQueue->lock);
+        if (status == 0) {
+            atomic_fetch_add(&benchQueue->popped, 1);
+            sum += value;
+        }
+    }
+
+    atomic_fetch_add(&benchQueue->poppedSum, sum);
+    return NULL;
+}
+
+/// @fn static int runRound(BenchQueue *benchQueue, const char *name,
+///   int numThreads, int lockFree)
+///
+/// @brief Run the threads of one producer/consumer round on a created queue
+/// and print its throughput.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int runRound(BenchQueue *benchQueue, const char *name, int numThreads,
+    int lockFree
+) {
+    pthread_t *threads =
+        (pthread_t*) malloc(2 * (size_t) numThreads * sizeof(pthread_t));
+    if (threads == NULL) {
+        printf("Error:  Could not allocate memory for threads!\n");
+        return -1;
+    }
+
+    double start = nowSeconds();
+    int started = 0;
+    for (int ii = 0; ii < 2 * numThreads; ii++) {
+        void* (*run)(void*) = ((ii % 2) == 0)
+            ? (lockFree ? lockFreeProducer : lockedProducer)
+            : (lockFree ? lockFreeConsumer : lockedConsumer);
+        if (pthread_create(&threads[ii], NULL, run, benchQueue) != 0) {
+            // Lets the consumers that did start give up
+            atomic_store(&benchQueue->failed, 1);
+            break;
+        }
+        started++;
+    }
+    for (int ii = 0; ii < started; ii++) {
+        pthread_join(threads[ii], NULL);
+    }
+    double elapsed = nowSeconds() - start;
+    free(threads); threads = NULL;
+
+    if (started != 2 * numThreads) {
+        printf("Error:  Could not start the %s threads!\n", name);
+        return -1;
+    } else if (atomic_load(&benchQueue->failed) != 0) {
+        printf("Error:  A %s thread could not use the queue!\n", name);
+        return -1;
+    }
+
+    // Every producer pushes 1..n, so we know exactly what the consumers
+    // should have added up to
+    long long pushesPerProducer = benchQueue->pushesPerProducer;
+    long long expectedSum =
+        ((pushesPerProducer * (pushesPerProducer + 1)) / 2) * numThreads;
+    long long poppedSum = atomic_load(&benchQueue->poppedSum);
+    printf("%-10s %4d producers %4d consumers %10.2f Mops/s%s\n",
+        name, numThreads, numThreads,
+        (double) (2 * benchQueue->totalPushes) / elapsed / 1e6,
+        (poppedSum == expectedSum) ? "" : "  (MISMATCH!)");
+
+    return (poppedSum == expectedSum) ? 0 : -1;
+}
+
+/// @fn static int runBenchmark(const char *name, int numThreads,
+///   long long pushesPerProducer, int lockFree)
+///
+/// @brief Create a queue and run one producer/consumer round on it.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int runBenchmark(const char *name, int numThreads,
+    long long pushesPerProducer, int lockFree
+) {
+    BenchQueue benchQueue;
+    memset(&benchQueue, 0, sizeof(benchQueue));
+    benchQueue.pushesPerProducer = pushesPerProducer;
+    benchQueue.totalPushes = pushesPerProducer * numThreads;
+    atomic_init(&benchQueue.failed, 0);
+    atomic_init(&benchQueue.popped, 0);
+    atomic_init(&benchQueue.poppedSum, 0);
+    if (pthread_mutex_init(&benchQueue.lock, NULL) != 0) {
+        printf("Error:  Could not create the %s lock!\n", name);
+        return -1;
+    }
+
+    if (lockFree) {
+        benchQueue.concurrentQueue = concurrentQueueCreate(sizeof(long long));
+    } else {
+        benchQueue.linkedList = linkedListCreate(compareLongLong);
+    }
+
+    int status = -1;
+    if ((benchQueue.concurrentQueue == NULL)
+        && (benchQueue.linkedList == NULL)
+    ) {
+        printf("Error:  Could not create the %s queue!\n", name);
+    } else {
+        status = runRound(&benchQueue, name, numThreads, lockFree);
+    }
+
+    benchQueue.concurrentQueue =
+        concurrentQueueDestroy(benchQueue.concurrentQueue);
+    benchQueue.linkedList = linkedListDestroy(benchQueue.linkedList);
+    pthread_mutex_destroy(&benchQueue.lock);
+
+    return status;
+}
+
+int main(int argc, char **argv) {
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = (argc > 1) ? atoi(argv[1]) : (int) numCpus;
+    long long pushesPerProducer =
+        (argc > 2) ? atoll(argv[2]) : DEFAULT_PUSHES_PER_PRODUCER;
+    if (maxThreads < 1) {
+        maxThreads = 1;
+    }
+
+    int status = 0;
+    for (int numThreads = 1; ; numThreads *= 2) {
+        if (numThreads > maxThreads) {
+            numThreads = maxThreads;
+        }
+
+        status |= runBenchmark("lock-free", numThreads, pushesPerProducer, 1);
+        status |= runBenchmark("mutex", numThreads, pushesPerProducer, 0);
+
+        if (numThreads == maxThreads) {
+            break;
+        }
+    }
+
+    return (status == 0) ? 0 : 1;
+}
@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file DequeBenchmark.c
+///
+/// @brief Measure queue and stack throughput of RingDeque next to LinkedList
+/// and UnrolledList.
+///
+/// Usage:  DequeBenchmark [depth] [operations]
+///
+/// Each structure is filled with depth ints and then, operations times, has
+/// one value pushed at the back and one popped from the front (queue) or the
+/// back (stack).  RingDeque is also run with BATCH_SIZE values per push and
+/// pop, which is where it reaches memory bandwidth.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "LinkedList.h"
+#include "RingDeque.h"
+#include "UnrolledList.h"
+
+/// @def DEFAULT_DEPTH
+///
+/// @brief Values kept in each structure when not given on the command line.
+#define DEFAULT_DEPTH 1000000
+
+/// @def DEFAULT_OPERATIONS
+///
+/// @brief Push/pop pairs when not given on the command line.
+#define DEFAULT_OPERATIONS 20000000
+
+/// @def BATCH_SIZE
+///
+/// @brief Values per batched push or pop.
+#define BATCH_SIZE 256
+
+// Keeps the compiler from discarding the popped values
+static volatile long long benchSink;
+
+static int compareInts(const void *a, const void *b) {
+    int left = *((const int*) a);
+    int right = *((const int*) b);
+    return (left > right) - (left < right);
+}
+
+static double nowSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + ((double) now.tv_nsec * 1e-9);
+}
+
+/// @fn static int parseCount(const char *text, long long *count)
+///
+/// @brief Parse a nonnegative count from the command line.
+///
+/// @return Returns 0 on success, -1 if text is not a count that fits in a
+/// long long.
+static int parseCount(const char *text, long long *count) {
+    char *end = NULL;
+    errno = 0;
+    long long value = strtoll(text, &end, 10);
+    if ((errno != 0) || (end == text) || (*end != '\0') || (value < 0)) {
+        return -1;
+    }
+    *count = value;
+
+    return 0;
+}
+
+/// @fn static int benchValue(long long ii)
+///
+/// @brief Get the int pushed for operation ii.  Wraps instead of overflowing
+/// when there are more than INT_MAX operations.
+static int benchValue(long long ii) {
+    return (int) (ii & INT_MAX);
+}
+
+static void printResult(const char *name, const char *mode,
+    long long operations, double elapsed
+) {
+    // Every operation moves one int in and one int out
+    printf("%-22s %-6s %10.2f Mops/s %8.2f GB/s\n", name, mode,
+        (double) operations / elapsed / 1e6,
+        (double) operations * 2.0 * sizeof(int) / elapsed / 1e9);
+}
+
+static int benchLinkedList(long long depth, long long operations, int stack) {
+    LinkedList *linkedList = linkedListCreate(compareInts);
+    if (linkedList == NULL) {
+        printf("Error:  Could not create the LinkedList!\n");
+        return -1;
+    }
+
+    long long failures = 0;
+    for (long long ii = 0; ii < depth; ii++) {
+        int value = benchValue(ii);
+        failures += (linkedListInsertBack(linkedList, &value, sizeof(value))
+            != 0);
+    }
+
+    long long sum = 0;
+    double start = nowSeconds();
+    for (long long ii = 0; ii < operations; ii++) {
+        int value = benchValue(ii);
+        failures += (linkedListInsertBack(linkedList, &value, sizeof(value))
+            != 0);
+        if (stack) {
+            linkedListPopBack(linkedList, &value, sizeof(value));
+        } else {
+            linkedListPopFront(linkedList, &value, sizeof(value));
+        }
+        sum += value;
+    }
+    double elapsed = nowSeconds() - start;
+
+    benchSink += sum;
+    linkedList = linkedListDestroy(linkedList);
+    if (failures != 0) {
+        printf("Error:  Could not fill the LinkedList!\n");
+        return -1;
+    }
+    printResult("LinkedList", stack ? "stack" : "queue", operations, elapsed);
+
+    return 0;
+}
+
+static int benchUnrolledList(long long depth, long long operations,
+    int stack
+) {
+    UnrolledList *unrolledList = unrolledListCreate(compareInts, sizeof(int));
+    if (unrolledList == NULL) {
+        printf("Error:  Could not create the UnrolledList!\n");
+        return -1;
+    }
+
+    long long failures = 0;
+    for (long long ii = 0; ii < depth; ii++) {
+        int value = benchValue(ii);
+        failures += (unrolledListInsertBack(unrolledList, &value) != 0);
+    }
+
+    long long sum = 0;
+    double start = nowSeconds();
+    for (long long ii = 0; ii < operations; ii++) {
+        int value = benchValue(ii);
+        failures += (unrolledListInsertBack(unrolledList, &value) != 0);
+        if (stack) {
+            unrolledListPopBack(unrolledList, &value);
+        } else {
+            unrolledListPopFront(unrolledList, &value);
+        }
+        sum += value;
+    }
+    double elapsed = nowSeconds() - start;
+
+    benchSink += sum;
+    unrolledList = unrolledListDestroy(unrolledList);
+    if (failures != 0) {
+        printf("Error:  Could not fill the UnrolledList!\n");
+        return -1;
+    }
+    printResult("UnrolledList", stack ? "stack" : "queue", operations,
+        elapsed);
+
+    return 0;
+}
+
+static int benchRingDeque(long long depth, long long operations, int stack) {
+    RingDeque *ringDeque = ringDequeCreate(sizeof(int));
+    if (ringDeque == NULL) {
+        printf("Error:  Could not create the RingDeque!\n");
+        return -1;
+    }
+
+    long long failures = 0;
+    for (long long ii = 0; ii < depth; ii++) {
+        int value = benchValue(ii);
+        failures += (ringDequePushBack(ringDeque, &value) != 0);
+    }
+
+    long long sum = 0;
+    double start = nowSeconds();
+    for (long long ii = 0; ii < operations; ii++) {
+        int value = benchValue(ii);
+        failures += (ringDequePushBack(ringDeque, &value) != 0);
+        if (stack) {
+            ringDequePopBack(ringDeque, &value);
+        } else {
+            ringDequePopFront(ringDeque, &value);
+        }
+        sum += value;
+    }
+    double elapsed = nowSeconds() - start;
+
+    benchSink += sum;
+    ringDeque = ringDequeDestroy(ringDeque);
+    if (failures != 0) {
+        printf("Error:  Could not fill the RingDeque!\n");
+        return -1;
+    }
+    printResult("RingDeque", stack ? "stack" : "queue", operations, elapsed);
+
+    return 0;
+}
+
+static int benchRingDequeBatched(long long depth, long long operations,
+    int stack
+) {
+    RingDeque *ringDeque = ringDequeCreate(sizeof(int));
+    if (ringDeque == NULL) {
+        printf("Error:  Could not create the RingDeque!\n");
+        return -1;
+    }
+
+    long long failures = 0;
+    for (long long ii = 0; ii < depth; ii++) {
+        int value = benchValue(ii);
+        failures += (ringDequePushBack(ringDeque, &value) != 0);
+    }
+
+    int batch[BATCH_SIZE];
+    for (int ii = 0; ii < BATCH_SIZE; ii++) {
+        batch[ii] = ii;
+    }
+
+    long long sum = 0;
+    long long done = 0;
+    double start = nowSeconds();
+    for (; done <= operations - BATCH_SIZE; done += BATCH_SIZE) {
+        failures += (ringDequePushBackMany(ringDeque, batch, BATCH_SIZE) != 0);
+        if (stack) {
+            ringDequePopBackMany(ringDeque, batch, BATCH_SIZE);
+        } else {
+            ringDequePopFrontMany(ringDeque, batch, BATCH_SIZE);
+        }
+        sum += batch[0];
+    }
+    double elapsed = nowSeconds() - start;
+
+    benchSink += sum;
+    ringDeque = ringDequeDestroy(ringDeque);
+    if (failures != 0) {
+        printf("Error:  Could not fill the RingDeque!\n");
+        return -1;
+    }
+    printResult("RingDeque (batched)", stack ? "stack" : "queue", done,
+        elapsed);
+
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    long long depth = DEFAULT_DEPTH;
+    long long operations = DEFAULT_OPERATIONS;
+    if (((argc > 1) && (parseCount(argv[1], &depth) != 0))
+        || ((argc > 2) && (parseCount(argv[2], &operations) != 0))
+    ) {
+        fprintf(stderr, "Usage:  %s [depth] [operations]\n"
+            "Both must be whole numbers from 0 to %lld.\n", argv[0],
+            LLONG_MAX);
+        return 1;
+    }
+    if (operations < BATCH_SIZE) {
+        operations = BATCH_SIZE;
+    }
+
+    int status = 0;
+    for (int stack = 0; stack <= 1; stack++) {
+        status |= benchLinkedList(depth, operations, stack);
+        status |= benchUnrolledList(depth, operations, stack);
+        status |= benchRingDeque(depth, operations, stack);
+        status |= benchRingDequeBatched(depth, operations, stack);
+    }
+
+    return (status == 0) ? 0 : 1;
+}
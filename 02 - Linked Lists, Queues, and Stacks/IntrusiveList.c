@@ -0,0 +1,315 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file IntrusiveList.c
+///
+/// @brief Library implementation of the IntrusiveList.
+///
+/// Unlike LinkedList, an IntrusiveList never allocates or copies anything.
+/// The caller embeds a ListLink in each of their own objects and the list just
+/// threads those links together.
+
+// Standard C includes
+#include <stddef.h>
+
+#include "IntrusiveList.h"
+
+/// @fn int intrusiveListInit(IntrusiveList *intrusiveList,
+///   int (*compare)(const void*, const void*), size_t linkOffset)
+///
+/// @brief Initialize caller-provided storage as an empty intrusive list.
+///
+/// @param intrusiveList A pointer to the IntrusiveList to initialize.
+/// @param compare Function that compares two objects in the list, following
+///   the same convention as LinkedList.  May be NULL if the list is never
+///   searched.
+/// @param linkOffset Offset of the ListLink within each object, normally
+///   offsetof(type, member).
+///
+/// @return Returns 0 on success, -1 on failure.
+int intrusiveListInit(IntrusiveList *intrusiveList,
+    int (*compare)(const void*, const void*), size_t linkOffset
+) {
+    if (intrusiveList == NULL) {
+        return -1;
+    }
+
+    intrusiveList->compare = compare;
+    intrusiveList->linkOffset = linkOffset;
+    intrusiveList->head = NULL;
+    intrusiveList->tail = NULL;
+    intrusiveList->size = 0;
+
+    return 0;
+}
+
+/// @fn void* intrusiveListEntry(IntrusiveList *intrusiveList, ListLink *link)
+///
+/// @brief Get a pointer to the object a ListLink of the list is embedded in.
+///
+/// @param intrusiveList A pointer to the IntrusiveList the link belongs to.
+/// @param link A pointer to the ListLink.
+///
+/// @note When the type of the object is known at compile time,
+/// LIST_CONTAINER_OF does the same thing.
+///
+/// @return Returns a pointer to the containing object, NULL if link is NULL.
+void* intrusiveListEntry(IntrusiveList *intrusiveList, ListLink *link) {
+    if ((intrusiveList == NULL) || (link == NULL)) {
+        return NULL;
+    }
+
+    return (char*) link - intrusiveList->linkOffset;
+}
+
+/// @fn int intrusiveListInsertFront(IntrusiveList *intrusiveList,
+///   ListLink *link)
+///
+/// @brief Insert an object at the front of an intrusive list.
+///
+/// @param intrusiveList A pointer to a previously-initialized IntrusiveList.
+/// @param link A pointer to the ListLink of the object to insert.  The object
+///   must not already be in a list through this link.
+///
+/// @return Returns 0 on success, -1 on failure.
+int intrusiveListInsertFront(IntrusiveList *intrusiveList, ListLink *link) {
+    if ((intrusiveList == NULL) || (link == NULL)) {
+        return -1;
+    }
+
+    link->prev = NULL;
+    link->next = intrusiveList->head;
+    if (intrusiveList->head != NULL) {
+        intrusiveList->head->prev = link;
+    } else {
+        // List was empty
+        intrusiveList->tail = link;
+    }
+    intrusiveList->head = link;
+    intrusiveList->size++;
+
+    return 0;
+}
+
+/// @fn int intrusiveListInsertBack(IntrusiveList *intrusiveList,
+///   ListLink *link)
+///
+/// @brief Insert an object at the back of an intrusive list.
+///
+/// @param intrusiveList A pointer to a previously-initialized IntrusiveList.
+/// @param link A pointer to the ListLink of the object to insert.  The object
+///   must not already be in a list through this link.
+///
+/// @return Returns 0 on success, -1 on failure.
+int intrusiveListInsertBack(IntrusiveList *intrusiveList, ListLink *link) {
+    if ((intrusiveList == NULL) || (link == NULL)) {
+        return -1;
+    }
+
+    link->next = NULL;
+    link->prev = intrusiveList->tail;
+    if (intrusiveList->tail != NULL) {
+        intrusiveList->tail->next = link;
+    } else {
+        // List was empty
+        intrusiveList->head = link;
+    }
+    intrusiveList->tail = link;
+    intrusiveList->size++;
+
+    return 0;
+}
+
+/// @fn int intrusiveListInsertAfter(IntrusiveList *intrusiveList,
+///   ListLink *position, ListLink *link)
+///
+/// @brief Insert an object directly after another one already in the list.
+///
+/// @param intrusiveList A pointer to a previously-initialized IntrusiveList.
+/// @param position A pointer to a ListLink already in the list.
+/// @param link A pointer to the ListLink of the object to insert.
+///
+/// @return Returns 0 on success, -1 on failure.
+int intrusiveListInsertAfter(IntrusiveList *intrusiveList, ListLink *position,
+    ListLink *link
+) {
+    if ((intrusiveList == NULL) || (position == NULL) || (link == NULL)) {
+        return -1;
+    }
+
+    link->prev = position;
+    link->next = position->next;
+    if (position->next != NULL) {
+        position->next->prev = link;
+    } else {
+        intrusiveList->tail = link;
+    }
+    position->next = link;
+    intrusiveList->size++;
+
+    return 0;
+}
+
+/// @fn int intrusiveListRemove(IntrusiveList *intrusiveList, ListLink *link)
+///
+/// @brief Unlink an object from an intrusive list in O(1).
+///
+/// @param intrusiveList A pointer to a previously-initialized IntrusiveList.
+/// @param link A pointer to a ListLink that is in the list.
+///
+/// @note The object itself is untouched and still belongs to the caller.
+///
+/// @return Returns 0 on success, -1 on failure.
+int intrusiveListRemove(IntrusiveList *intrusiveList, ListLink *link) {
+    if ((intrusiveList == NULL) || (link == NULL)) {
+        return -1;
+    }
+
+    // Splice out the link from its neighbors
+    if (link->prev != NULL) {
+        link->prev->next = link->next;
+    } else {
+        intrusiveList->head = link->next;
+    }
+    if (link->next != NULL) {
+        link->next->prev = link->prev;
+    } else {
+        intrusiveList->tail = link->prev;
+    }
+
+    link->next = NULL;
+    link->prev = NULL;
+    intrusiveList->size--;
+
+    return 0;
+}
+
+/// @fn ListLink* intrusiveListSearch(IntrusiveList *intrusiveList,
+///   const void *value)
+///
+/// @brief Search an intrusive list for a specific object.
+///
+/// @param intrusiveList A pointer to a previously-initialized IntrusiveList.
+/// @param value A pointer to the object to search for.  It is passed to the
+///   list's compare function as the second argument.
+///
+/// @note Use intrusiveListEntry or LIST_CONTAINER_OF on the result to get at
+/// the containing object.
+///
+/// @return Returns a pointer to the ListLink of the first matching object on
+/// success, NULL on failure.
+ListLink* intrusiveListSearch(IntrusiveList *intrusiveList, const void *value) {
+    if ((intrusiveList == NULL) || (intrusiveList->compare == NULL)) {
+        // Nothing we can do
+        return NULL;
+    }
+
+    // Get the comparison function and link offset from the list
+    int (*compare)(const void*, const void*) = intrusiveList->compare;
+    size_t linkOffset = intrusiveList->linkOffset;
+
+    for (ListLink *cur = intrusiveList->head; cur != NULL; cur = cur->next) {
+        if (compare((char*) cur - linkOffset, value) == 0) {
+            return cur;
+        }
+    }
+
+    return NULL;
+}
+
+/// @fn ListLink* intrusiveListPopFront(IntrusiveList *intrusiveList)
+///
+/// @brief Unlink the object at the front of an intrusive list.
+///
+/// @param intrusiveList A pointer to a previously-initialized IntrusiveList.
+///
+/// @return Returns the ListLink of the object that was at the front of the
+/// list on success, NULL if the list is empty.
+ListLink* intrusiveListPopFront(IntrusiveList *intrusiveList) {
+    if ((intrusiveList == NULL) || (intrusiveList->head == NULL)) {
+        return NULL;
+    }
+
+    ListLink *front = intrusiveList->head;
+    intrusiveListRemove(intrusiveList, front);
+
+    return front;
+}
+
+/// @fn ListLink* intrusiveListPopBack(IntrusiveList *intrusiveList)
+///
+/// @brief Unlink the object at the back of an intrusive list.
+///
+/// @param intrusiveList A pointer to a previously-initialized IntrusiveList.
+///
+/// @return Returns the ListLink of the object that was at the back of the list
+/// on success, NULL if the list is empty.
+ListLink* intrusiveListPopBack(IntrusiveList *intrusiveList) {
+    if ((intrusiveList == NULL) || (intrusiveList->tail == NULL)) {
+        return NULL;
+    }
+
+    ListLink *back = intrusiveList->tail;
+    intrusiveListRemove(intrusiveList, back);
+
+    return back;
+}
+
+/// @fn int intrusiveListSplice(IntrusiveList *destination,
+///   IntrusiveList *source)
+///
+/// @brief Move every object of one intrusive list onto the back of another in
+/// O(1).
+///
+/// @param destination A pointer to the IntrusiveList to append to.
+/// @param source A pointer to the IntrusiveList to take the objects from.  It
+///   is left empty.
+///
+/// @return Returns 0 on success, -1 on failure.
+int intrusiveListSplice(IntrusiveList *destination, IntrusiveList *source) {
+    if ((destination == NULL) || (source == NULL) || (destination == source)) {
+        return -1;
+    } else if (source->head == NULL) {
+        // Nothing to move
+        return 0;
+    }
+
+    if (destination->tail != NULL) {
+        destination->tail->next = source->head;
+        source->head->prev = destination->tail;
+    } else {
+        destination->head = source->head;
+    }
+    destination->tail = source->tail;
+    destination->size += source->size;
+
+    source->head = NULL;
+    source->tail = NULL;
+    source->size = 0;
+
+    return 0;
+}
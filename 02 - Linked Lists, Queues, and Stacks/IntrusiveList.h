@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              IntrusiveList.h
+///
+/// @brief             Intrusive linked list implementation in C.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+// Standard C includes
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def LIST_CONTAINER_OF
+///
+/// @brief Get a pointer to the object that a ListLink is embedded in.
+///
+/// @param link A pointer to the ListLink.
+/// @param type The type of the containing object.
+/// @param member The name of the ListLink member within type.
+#define LIST_CONTAINER_OF(link, type, member) \
+    ((type*) ((char*) (link) - offsetof(type, member)))
+
+/// @struct ListLink
+///
+/// @brief Link embedded by the caller in each object stored in an
+/// IntrusiveList.
+///
+/// @param next Pointer to the next ListLink in the list.
+/// @param prev Pointer to the previous ListLink in the list.
+typedef struct ListLink {
+    struct ListLink *next;
+    struct ListLink *prev;
+} ListLink;
+
+/// @struct IntrusiveList
+///
+/// @brief Base container for a linked list of caller-owned objects.
+///
+/// @param compare Function pointer to the function that will compare two
+///   objects in the list.
+/// @param linkOffset Offset in bytes of the ListLink within each object.
+/// @param head Pointer to the first ListLink in the list.
+/// @param tail Pointer to the last ListLink in the list.
+/// @param size Number of objects in the list.
+typedef struct IntrusiveList {
+    int (*compare)(const void*, const void*);
+    size_t linkOffset;
+    ListLink *head;
+    ListLink *tail;
+    int size;
+} IntrusiveList;
+
+// Base IntrusiveList prototypes
+int intrusiveListInit(IntrusiveList *intrusiveList,
+    int (*compare)(const void*, const void*), size_t linkOffset);
+void* intrusiveListEntry(IntrusiveList *intrusiveList, ListLink *link);
+int intrusiveListInsertFront(IntrusiveList *intrusiveList, ListLink *link);
+int intrusiveListInsertBack(IntrusiveList *intrusiveList, ListLink *link);
+int intrusiveListInsertAfter(IntrusiveList *intrusiveList, ListLink *position,
+    ListLink *link);
+int intrusiveListRemove(IntrusiveList *intrusiveList, ListLink *link);
+ListLink* intrusiveListSearch(IntrusiveList *intrusiveList, const void *value);
+ListLink* intrusiveListPopFront(IntrusiveList *intrusiveList);
+ListLink* intrusiveListPopBack(IntrusiveList *intrusiveList);
+int intrusiveListSplice(IntrusiveList *destination, IntrusiveList *source);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // INTRUSIVE_LIST_H
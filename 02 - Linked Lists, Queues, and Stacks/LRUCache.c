@@ -0,0 +1,354 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file LRUCache.c
+///
+/// @brief Library implementation of the LRUCache.
+///
+/// A lookup goes through the LinkedList hash index and a hit relinks its node
+/// at the front of the list, so neither get nor put searches the list or
+/// allocates in the steady state.  Eviction always takes the back of the list.
+
+// Standard C includes
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "LRUCache.h"
+
+/// @def LRU_VALUE_ALIGNMENT
+///
+/// @brief Alignment of the values handed out by lruCacheGet.  Node values are
+/// always at least this aligned, so padding the key to it is enough.
+#define LRU_VALUE_ALIGNMENT 8
+
+/// @fn LRUCache* lruCacheCreate(int keySize, size_t maxEntries,
+///   size_t maxBytes, int (*compare)(const void*, const void*),
+///   size_t (*hash)(const void*))
+///
+/// @brief Create an empty LRU cache.
+///
+/// @param keySize Number of bytes in every key.
+/// @param maxEntries Most entries the cache may hold, or 0 for no limit.
+/// @param maxBytes Most bytes of keys, values and padding between them the
+///   cache may hold, or 0 for no limit.
+/// @param compare Function that compares two keys.
+/// @param hash Function that hashes a key.  Keys that compare equal must hash
+///   the same.
+///
+/// @note compare and hash are also handed whole entries, which begin with
+/// their key, so they must only look at the first keySize bytes they are
+/// given.
+///
+/// @return Returns a pointer to the new LRUCache on success, NULL on failure.
+LRUCache* lruCacheCreate(int keySize, size_t maxEntries, size_t maxBytes,
+    int (*compare)(const void*, const void*), size_t (*hash)(const void*)
+) {
+    return lruCacheCreateWithAllocator(keySize, maxEntries, maxBytes,
+        compare, hash, NULL);
+}
+
+/// @fn LRUCache* lruCacheCreateWithAllocator(int keySize, size_t maxEntries,
+///   size_t maxBytes, int (*compare)(const void*, const void*),
+///   size_t (*hash)(const void*), const Allocator *allocator)
+///
+/// @brief Create an empty LRU cache that gets all of its memory from a given
+/// allocator.
+///
+/// @param keySize Number of bytes in every key.
+/// @param maxEntries Most entries the cache may hold, or 0 for no limit.
+/// @param maxBytes Most bytes of keys, values and padding between them the
+///   cache may hold, or 0 for no limit.
+/// @param compare Function that compares two keys.
+/// @param hash Function that hashes a key.  Keys that compare equal must hash
+///   the same.
+/// @param allocator The allocator to use, or NULL for malloc and free.  It is
+///   copied, so only its context has to outlive the cache.
+///
+/// @note See lruCacheCreate for what compare and hash are given.
+///
+/// @return Returns a pointer to the new LRUCache on success, NULL on failure.
+LRUCache* lruCacheCreateWithAllocator(int keySize, size_t maxEntries,
+    size_t maxBytes, int (*compare)(const void*, const void*),
+    size_t (*hash)(const void*), const Allocator *allocator
+) {
+    if ((keySize <= 0) || (keySize > INT_MAX - LRU_VALUE_ALIGNMENT)
+        || (compare == NULL) || (hash == NULL)
+    ) {
+        // We can't create a cache like this
+        return NULL;
+    }
+
+    Allocator cacheAllocator
+        = (allocator != NULL) ? *allocator : allocatorLibc();
+
+    LRUCache *lruCache = (LRUCache*) allocatorCalloc(&cacheAllocator, 1,
+        sizeof(LRUCache));
+    if (lruCache == NULL) {
+        // Out of memory
+        return NULL;
+    }
+    lruCache->allocator = cacheAllocator;
+
+    lruCache->list = linkedListCreateWithAllocator(compare,
+        &lruCache->allocator);
+    if ((lruCache->list == NULL)
+        || (linkedListEnableIndex(lruCache->list, hash) != 0)
+    ) {
+        return lruCacheDestroy(lruCache);
+    }
+
+    lruCache->keySize = keySize;
+    lruCache->valueOffset = (keySize + LRU_VALUE_ALIGNMENT - 1)
+        & ~(LRU_VALUE_ALIGNMENT - 1);
+    lruCache->maxEntries = maxEntries;
+    lruCache->maxBytes = maxBytes;
+    // All other values are initialized to 0 by calloc
+
+    return lruCache;
+}
+
+/// @fn LRUCache* lruCacheDestroy(LRUCache *lruCache)
+///
+/// @brief Release all the memory held by an LRU cache and its entries.
+///
+/// @param lruCache A pointer to a previously-initialized LRUCache.
+///
+/// @note The evict callback is not called for the entries that are destroyed.
+///
+/// @return This function always succeeds and always returns NULL.
+LRUCache* lruCacheDestroy(LRUCache *lruCache) {
+    if (lruCache != NULL) {
+        lruCache->list = linkedListDestroy(lruCache->list);
+        allocatorFree(&lruCache->allocator, lruCache->scratch,
+            (size_t) lruCache->scratchSize);
+        lruCache->scratch = NULL;
+
+        // The allocator is about to be freed along with the cache
+        Allocator allocator = lruCache->allocator;
+        allocatorFree(&allocator, lruCache, sizeof(LRUCache));
+        lruCache = NULL;
+    }
+
+    return NULL;
+}
+
+/// @fn int lruCacheSetEvictCallback(LRUCache *lruCache,
+///   void (*evict)(const void *key, const void *value, int valueSize,
+///     void *context),
+///   void *context)
+///
+/// @brief Set the function to call with each entry the cache evicts.
+///
+/// @param lruCache A pointer to a previously-initialized LRUCache.
+/// @param evict The function to call, or NULL for none.  The key and value it
+///   is given are only valid for the duration of the call, and it must not
+///   call back into the cache.
+/// @param context Passed through to evict.
+///
+/// @return Returns 0 on success, -1 on failure.
+int lruCacheSetEvictCallback(LRUCache *lruCache,
+    void (*evict)(const void *key, const void *value, int valueSize,
+        void *context),
+    void *context
+) {
+    if (lruCache == NULL) {
+        return -1;
+    }
+
+    lruCache->evict = evict;
+    lruCache->evictContext = context;
+
+    return 0;
+}
+
+/// @fn static void lruCacheEvict(LRUCache *lruCache)
+///
+/// @brief Evict the least recently used entry of a non-empty LRU cache.
+static void lruCacheEvict(LRUCache *lruCache) {
+    ListNode *node = lruCache->list->tail;
+    if (lruCache->evict != NULL) {
+        lruCache->evict(node->value, node->value + lruCache->valueOffset,
+            node->size - lruCache->valueOffset, lruCache->evictContext);
+    }
+
+    lruCache->bytes -= (size_t) node->size;
+    lruCache->evictions++;
+    linkedListRemoveNode(lruCache->list, node);
+}
+
+/// @fn void* lruCacheGet(LRUCache *lruCache, const void *key,
+///   int *valueSize)
+///
+/// @brief Look up a key and mark its entry as the most recently used.
+///
+/// @param lruCache A pointer to a previously-initialized LRUCache.
+/// @param key A pointer to the key to look up.
+/// @param valueSize Where to store the number of bytes in the value, or NULL.
+///
+/// @note The returned pointer refers to the cache's own copy of the value and
+/// is only valid until the next put or remove.
+///
+/// @return Returns a pointer to the value on a hit, NULL on a miss.
+void* lruCacheGet(LRUCache *lruCache, const void *key, int *valueSize) {
+    if ((lruCache == NULL) || (key == NULL)) {
+        // Nothing we can do
+        return NULL;
+    }
+
+    ListNode *node = linkedListSearch(lruCache->list, key);
+    if (node == NULL) {
+        lruCache->misses++;
+        return NULL;
+    }
+
+    lruCache->hits++;
+    linkedListMoveToFront(lruCache->list, node);
+    if (valueSize != NULL) {
+        *valueSize = node->size - lruCache->valueOffset;
+    }
+
+    return node->value + lruCache->valueOffset;
+}
+
+/// @fn int lruCachePut(LRUCache *lruCache, const void *key,
+///   const void *value, int valueSize)
+///
+/// @brief Add or replace the entry for a key and mark it as the most recently
+/// used, evicting the least recently used entries as needed to make room.
+///
+/// @param lruCache A pointer to a previously-initialized LRUCache.
+/// @param key A pointer to the key to store.
+/// @param value A pointer to the value to copy into the cache.
+/// @param valueSize The number of bytes the value takes up.
+///
+/// @note Replacing a value with one of the same size is done in place.  A
+/// different size gets a new entry, and the old one is only dropped once the
+/// new one is in.
+///
+/// @return Returns 0 on success, -1 on failure.  A failed put leaves the cache
+/// as it was, without evicting anything.
+int lruCachePut(LRUCache *lruCache, const void *key, const void *value,
+    int valueSize
+) {
+    if ((lruCache == NULL) || (key == NULL) || (valueSize < 0)
+        || ((value == NULL) && (valueSize > 0))
+        || (valueSize > INT_MAX - lruCache->valueOffset)
+    ) {
+        // Nothing we can do
+        return -1;
+    }
+
+    int entrySize = lruCache->valueOffset + valueSize;
+    if ((lruCache->maxBytes != 0) && ((size_t) entrySize > lruCache->maxBytes)) {
+        // Would never fit
+        return -1;
+    }
+
+    ListNode *node = linkedListSearch(lruCache->list, key);
+    if (node != NULL) {
+        if (node->size == entrySize) {
+            if (valueSize > 0) {
+                memcpy(node->value + lruCache->valueOffset, value,
+                    (size_t) valueSize);
+            }
+            linkedListMoveToFront(lruCache->list, node);
+            return 0;
+        }
+    }
+
+    if (entrySize > lruCache->scratchSize) {
+        unsigned char *scratch
+            = (unsigned char*) allocatorRealloc(&lruCache->allocator,
+                lruCache->scratch, (size_t) lruCache->scratchSize,
+                (size_t) entrySize);
+        if (scratch == NULL) {
+            // Out of memory
+            return -1;
+        }
+        lruCache->scratch = scratch;
+        lruCache->scratchSize = entrySize;
+    }
+    memcpy(lruCache->scratch, key, (size_t) lruCache->keySize);
+    memset(lruCache->scratch + lruCache->keySize, 0,
+        (size_t) (lruCache->valueOffset - lruCache->keySize));
+    if (valueSize > 0) {
+        memcpy(lruCache->scratch + lruCache->valueOffset, value,
+            (size_t) valueSize);
+    }
+
+    // Insert before making room, so that nothing is evicted for a put that
+    // fails.  The new entry is at the front and fits on its own, so evicting
+    // from the back never reaches it.
+    if (linkedListInsertFront(lruCache->list, lruCache->scratch, entrySize)
+        != 0
+    ) {
+        return -1;
+    }
+    lruCache->bytes += (size_t) entrySize;
+
+    if (node != NULL) {
+        // Different size.  Drop the old entry now that the new one is in.
+        lruCache->bytes -= (size_t) node->size;
+        linkedListRemoveNode(lruCache->list, node);
+    }
+
+    // Make room
+    while ((lruCache->list->size > 1)
+        && (((lruCache->maxEntries != 0)
+                && ((size_t) lruCache->list->size > lruCache->maxEntries))
+            || ((lruCache->maxBytes != 0)
+                && (lruCache->bytes > lruCache->maxBytes)))
+    ) {
+        lruCacheEvict(lruCache);
+    }
+
+    return 0;
+}
+
+/// @fn int lruCacheRemove(LRUCache *lruCache, const void *key)
+///
+/// @brief Remove the entry for a key without calling the evict callback.
+///
+/// @param lruCache A pointer to a previously-initialized LRUCache.
+/// @param key A pointer to the key to remove.
+///
+/// @return Returns 0 on success, -1 if the key is not in the cache.
+int lruCacheRemove(LRUCache *lruCache, const void *key) {
+    if ((lruCache == NULL) || (key == NULL)) {
+        // Nothing we can do
+        return -1;
+    }
+
+    ListNode *node = linkedListSearch(lruCache->list, key);
+    if (node == NULL) {
+        return -1;
+    }
+
+    lruCache->bytes -= (size_t) node->size;
+    return linkedListRemoveNode(lruCache->list, node);
+}
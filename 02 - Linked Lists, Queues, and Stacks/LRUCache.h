@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              LRUCache.h
+///
+/// @brief             Least-recently-used cache built on LinkedList.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+// Standard C includes
+#include <stddef.h>
+
+#include "LinkedList.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct LRUCache
+///
+/// @brief Fixed-capacity key/value cache that evicts the least recently used
+/// entry when full.
+///
+/// @param list Entries in order of use, most recent at the front.  Each node's
+///   value is the key followed by the entry's value, and the list's hash
+///   index maps keys to nodes.
+/// @param keySize Number of bytes in every key.
+/// @param valueOffset Where each value starts within its node's value.  This
+///   is keySize rounded up so that values are suitably aligned.
+/// @param maxEntries Most entries the cache may hold, or 0 for no limit.
+/// @param maxBytes Most bytes of keys, values and padding between them the
+///   cache may hold, or 0 for no limit.
+/// @param bytes Number of bytes of keys, values and padding the cache holds
+///   now.
+/// @param evict Function called with each entry the cache evicts to make room,
+///   or NULL.
+/// @param evictContext Passed through to evict.
+/// @param scratch Buffer used to put a key and value together before they are
+///   copied into a node.
+/// @param scratchSize Number of bytes scratch can hold.
+/// @param hits Number of lookups that found their key.
+/// @param misses Number of lookups that did not find their key.
+/// @param evictions Number of entries evicted to make room.
+/// @param allocator Where the cache, its scratch buffer and its list get their
+///   memory.  See lruCacheCreateWithAllocator.
+typedef struct LRUCache {
+    LinkedList *list;
+    int keySize;
+    int valueOffset;
+    size_t maxEntries;
+    size_t maxBytes;
+    size_t bytes;
+    void (*evict)(const void *key, const void *value, int valueSize,
+        void *context);
+    void *evictContext;
+    unsigned char *scratch;
+    int scratchSize;
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long evictions;
+    Allocator allocator;
+} LRUCache;
+
+// Base LRUCache prototypes
+LRUCache* lruCacheCreate(int keySize, size_t maxEntries, size_t maxBytes,
+    int (*compare)(const void*, const void*), size_t (*hash)(const void*));
+LRUCache* lruCacheCreateWithAllocator(int keySize, size_t maxEntries,
+    size_t maxBytes, int (*compare)(const void*, const void*),
+    size_t (*hash)(const void*), const Allocator *allocator);
+LRUCache* lruCacheDestroy(LRUCache *lruCache);
+int lruCacheSetEvictCallback(LRUCache *lruCache,
+    void (*evict)(const void *key, const void *value, int valueSize,
+        void *context),
+    void *context);
+void* lruCacheGet(LRUCache *lruCache, const void *key, int *valueSize);
+int lruCachePut(LRUCache *lruCache, const void *key, const void *value,
+    int valueSize);
+int lruCacheRemove(LRUCache *lruCache, const void *key);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // LRU_CACHE_H
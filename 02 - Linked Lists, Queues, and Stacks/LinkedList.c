@@ -30,54 +30,404 @@
 /// @brief Library implementation of the LinkedList.
 
 // Standard C includes
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "LinkedList.h"
 
+/// @def NODE_SLAB_BYTES
+///
+/// @brief Approximate size of each block of nodes a ListNodePool allocates.
+#define NODE_SLAB_BYTES 4096
+
+/// @def MIN_NODES_PER_SLAB
+///
+/// @brief Fewest nodes a ListNodePool allocates at once, however big they are.
+#define MIN_NODES_PER_SLAB 8
+
+/// @def MIN_INDEX_CAPACITY
+///
+/// @brief Fewest slots a ListIndex starts with.  Must be a power of 2.
+#define MIN_INDEX_CAPACITY 16
+
+/// @struct ListIndex
+///
+/// @brief Open-addressing hash table from values to the ListNodes holding
+/// them.  Collisions are resolved by linear probing and the table is kept at
+/// most half full.
+///
+/// @param hash The caller's hash function for values.
+/// @param nodes The node in each slot, or NULL for an empty slot.
+/// @param hashes The hash of the value of the node in each slot, so probing
+///   only calls compare on real candidates.
+/// @param capacity Number of slots.  Always a power of 2.
+/// @param shift Right shift that turns a mixed 64-bit hash into a slot number.
+/// @param count Number of occupied slots.
+/// @param allocator The allocator of the list the index belongs to.
+typedef struct ListIndex {
+    size_t (*hash)(const void*);
+    ListNode **nodes;
+    size_t *hashes;
+    size_t capacity;
+    int shift;
+    size_t count;
+    const Allocator *allocator;
+} ListIndex;
+
+/// @struct ListNodeSlab
+///
+/// @brief Header of a single allocation that holds many ListNodes of the same
+/// size class.  The nodes follow the header directly.
+///
+/// @param next Pointer to the next slab owned by the same pool.
+/// @param size The number of bytes in the slab, header included.
+typedef struct ListNodeSlab {
+    struct ListNodeSlab *next;
+    size_t size;
+} ListNodeSlab;
+
 // ListNode functions need to come first
 
-/// @fn ListNode* listNodeCreate(void *value, int size)
+/// @fn static int listNodeSizeClass(int size)
+///
+/// @brief Get the ListNodePool size class that holds values of a given size.
+///
+/// @param size The number of bytes the value takes up.
 ///
-/// @brief Allocate and initialize a ListNode.
+/// @return Returns the size class, or LIST_NODE_POOL_CLASSES if the value is
+/// too big to be pooled.
+static int listNodeSizeClass(int size) {
+    int sizeClass = 0;
+    while ((sizeClass < LIST_NODE_POOL_CLASSES) && (size > (8 << sizeClass))) {
+        sizeClass++;
+    }
+
+    return sizeClass;
+}
+
+/// @fn static int listNodePoolRefill(ListNodePool *nodePool,
+///   const Allocator *allocator, int sizeClass)
 ///
+/// @brief Allocate a new slab of nodes for one size class of a ListNodePool.
+///
+/// @param nodePool A pointer to the ListNodePool to add nodes to.
+/// @param allocator The allocator to get the slab from.
+/// @param sizeClass The size class to add nodes to.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int listNodePoolRefill(ListNodePool *nodePool,
+    const Allocator *allocator, int sizeClass
+) {
+    size_t stride = sizeof(ListNode) + ((size_t) 8 << sizeClass);
+    size_t numNodes = (NODE_SLAB_BYTES - sizeof(ListNodeSlab)) / stride;
+    if (numNodes < MIN_NODES_PER_SLAB) {
+        numNodes = MIN_NODES_PER_SLAB;
+    }
+
+    size_t slabSize = sizeof(ListNodeSlab) + (numNodes * stride);
+    ListNodeSlab *slab = (ListNodeSlab*) allocatorAlloc(allocator, slabSize);
+    if (slab == NULL) {
+        // Out of memory
+        return -1;
+    }
+    slab->size = slabSize;
+    slab->next = nodePool->slabs;
+    nodePool->slabs = slab;
+
+    // Thread every node in the slab onto the free list for its class
+    unsigned char *nodes = (unsigned char*) (slab + 1);
+    for (size_t ii = 0; ii < numNodes; ii++) {
+        ListNode *node = (ListNode*) (nodes + (ii * stride));
+        node->sizeClass = sizeClass;
+        node->next = nodePool->freeNodes[sizeClass];
+        nodePool->freeNodes[sizeClass] = node;
+    }
+
+    return 0;
+}
+
+/// @fn ListNode* listNodeCreate(LinkedList *linkedList, const void *value,
+///   int size)
+///
+/// @brief Get a ListNode from a linked list's pool and initialize it.
+///
+/// @param linkedList A pointer to the LinkedList the node is for.
 /// @param value A pointer to the value to be assigned to the ListNode.  This
 ///   value will be copied into the ListNode.
 /// @param size The number of bytes the value takes up.
 ///
-/// @return Returns a pointer to an allocated and initialized ListNode on
-/// success, NULL on failure.
-ListNode* listNodeCreate(void *value, int size) {
-    // Both prev and next of the new node need to be initialized to
-    // NULL and we need to test its value against NULL, so use calloc.
-    ListNode *node = (ListNode*) calloc(1, sizeof(ListNode));
-    if (node == NULL) {
-        // Out of memory
+/// @note Values too big for the pool get a node of their own.  Either way the
+/// node and its value are one allocation.
+///
+/// @return Returns a pointer to an initialized ListNode on success, NULL on
+/// failure.
+ListNode* listNodeCreate(LinkedList *linkedList, const void *value, int size) {
+    if ((size < 0) || ((value == NULL) && (size > 0))) {
         return NULL;
     }
 
-    // Copy the value to the new node
-    node->value = malloc(size);
-    if (node->value == NULL) {
-        free(node); node = NULL;
-        return NULL;
+    ListNode *node = NULL;
+    int sizeClass = listNodeSizeClass(size);
+    if (sizeClass == LIST_NODE_POOL_CLASSES) {
+        node = (ListNode*) allocatorAlloc(&linkedList->allocator,
+            sizeof(ListNode) + (size_t) size);
+        if (node == NULL) {
+            // Out of memory
+            return NULL;
+        }
+        LIST_STATS_ADD(linkedList->stats, LIST_STATS_MALLOCS, 1);
+        node->sizeClass = sizeClass;
+    } else {
+        ListNodePool *nodePool = &linkedList->nodePool;
+        if (nodePool->freeNodes[sizeClass] == NULL) {
+            if (listNodePoolRefill(nodePool, &linkedList->allocator,
+                sizeClass) != 0
+            ) {
+                // Out of memory
+                return NULL;
+            }
+            LIST_STATS_ADD(linkedList->stats, LIST_STATS_MALLOCS, 1);
+        }
+        node = nodePool->freeNodes[sizeClass];
+        nodePool->freeNodes[sizeClass] = node->next;
+    }
+
+    node->next = NULL;
+    node->prev = NULL;
+    node->size = size;
+    if (size > 0) {
+        memcpy(node->value, value, (size_t) size);
     }
-    memcpy(node->value, value, size);
 
     return node;
 }
 
-/// @fn ListNode* listNodeDestroy(ListNode *node)
+/// @fn ListNode* listNodeDestroy(LinkedList *linkedList, ListNode *node)
+///
+/// @brief Give a ListNode back to the pool of the linked list it came from.
+///
+/// @param linkedList A pointer to the LinkedList the node came from.
+/// @param node A pointer to a ListNode created by listNodeCreate.
+///
+/// @return This function always succeeds and always returns NULL.
+ListNode* listNodeDestroy(LinkedList *linkedList, ListNode *node) {
+    if (node->sizeClass == LIST_NODE_POOL_CLASSES) {
+        allocatorFree(&linkedList->allocator, node,
+            sizeof(ListNode) + (size_t) node->size);
+        node = NULL;
+        LIST_STATS_ADD(linkedList->stats, LIST_STATS_FREES, 1);
+        return NULL;
+    }
+
+    ListNodePool *nodePool = &linkedList->nodePool;
+    node->next = nodePool->freeNodes[node->sizeClass];
+    nodePool->freeNodes[node->sizeClass] = node;
+    node = NULL;
+
+    return NULL;
+}
+
+// ListIndex functions follow
+
+/// @fn static size_t listIndexSlot(const ListIndex *index, size_t hash)
+///
+/// @brief Get the slot a hash value would ideally occupy.
+///
+/// @note The hash is mixed with a Fibonacci multiply first, so weak hash
+/// functions such as the identity on ints still spread out across the table.
+///
+/// @return Returns the ideal slot number.
+static size_t listIndexSlot(const ListIndex *index, size_t hash) {
+    return (size_t) (((uint64_t) hash * 0x9E3779B97F4A7C15ULL) >> index->shift);
+}
+
+/// @fn static void listIndexPlace(ListIndex *index, ListNode *node,
+///   size_t hash)
+///
+/// @brief Put a node in the first free slot at or after its ideal slot.
+///
+/// @note The caller must make sure there is a free slot.
+static void listIndexPlace(ListIndex *index, ListNode *node, size_t hash) {
+    size_t mask = index->capacity - 1;
+    size_t slot = listIndexSlot(index, hash);
+    while (index->nodes[slot] != NULL) {
+        slot = (slot + 1) & mask;
+    }
+
+    index->nodes[slot] = node;
+    index->hashes[slot] = hash;
+    index->count++;
+}
+
+/// @fn static int listIndexResize(ListIndex *index, size_t newCapacity)
+///
+/// @brief Move every entry of a ListIndex into a table of a new size.
+///
+/// @param index A pointer to the ListIndex to resize.
+/// @param newCapacity The new number of slots.  Must be a power of 2.
+///
+/// @return Returns 0 on success, -1 on failure.  On failure the ListIndex is
+/// unchanged.
+static int listIndexResize(ListIndex *index, size_t newCapacity) {
+    const Allocator *allocator = index->allocator;
+    ListNode **newNodes = (ListNode**) allocatorCalloc(allocator, newCapacity,
+        sizeof(ListNode*));
+    size_t *newHashes = (size_t*) allocatorAlloc(allocator,
+        newCapacity * sizeof(size_t));
+    if ((newNodes == NULL) || (newHashes == NULL)) {
+        // Out of memory
+        allocatorFree(allocator, newNodes, newCapacity * sizeof(ListNode*));
+        newNodes = NULL;
+        allocatorFree(allocator, newHashes, newCapacity * sizeof(size_t));
+        newHashes = NULL;
+        return -1;
+    }
+
+    ListNode **oldNodes = index->nodes;
+    size_t *oldHashes = index->hashes;
+    size_t oldCapacity = index->capacity;
+
+    int shift = 64;
+    for (size_t capacity = newCapacity; capacity > 1; capacity >>= 1) {
+        shift--;
+    }
+
+    index->nodes = newNodes;
+    index->hashes = newHashes;
+    index->capacity = newCapacity;
+    index->shift = shift;
+    index->count = 0;
+    for (size_t ii = 0; ii < oldCapacity; ii++) {
+        if (oldNodes[ii] != NULL) {
+            listIndexPlace(index, oldNodes[ii], oldHashes[ii]);
+        }
+    }
+
+    allocatorFree(allocator, oldNodes, oldCapacity * sizeof(ListNode*));
+    oldNodes = NULL;
+    allocatorFree(allocator, oldHashes, oldCapacity * sizeof(size_t));
+    oldHashes = NULL;
+
+    return 0;
+}
+
+/// @fn static int listIndexReserve(ListIndex *index, size_t count)
 ///
-/// @brief Release all the memory allocated to hold a ListNode and its value.
+/// @brief Make sure a ListIndex can hold count entries without going over
+/// half full.
 ///
-/// @param node A pointer to a previously-allocated ListNode.
+/// @return Returns 0 on success, -1 on failure.
+static int listIndexReserve(ListIndex *index, size_t count) {
+    size_t newCapacity = index->capacity;
+    while (count > newCapacity / 2) {
+        newCapacity *= 2;
+    }
+
+    if (newCapacity == index->capacity) {
+        return 0;
+    }
+
+    return listIndexResize(index, newCapacity);
+}
+
+/// @fn static ListNode* listIndexFind(const ListIndex *index,
+///   int (*compare)(const void*, const void*), const void *value,
+///   struct ListStatsRecord *stats)
+///
+/// @brief Look up a value in a ListIndex.
+///
+/// @param stats The counters of the list the index belongs to.  Every occupied
+///   slot probed counts as a node visited and every call to compare as a
+///   compare, so long probe chains show up the same way long scans do.
+///
+/// @return Returns a node holding the value if there is one, NULL if not.
+static ListNode* listIndexFind(const ListIndex *index,
+    int (*compare)(const void*, const void*), const void *value,
+    struct ListStatsRecord *stats
+) {
+    size_t hash = index->hash(value);
+    size_t mask = index->capacity - 1;
+    ListNode *found = NULL;
+    size_t visited = 0;
+    size_t compares = 0;
+    for (size_t slot = listIndexSlot(index, hash);
+        index->nodes[slot] != NULL;
+        slot = (slot + 1) & mask
+    ) {
+        visited++;
+        if (index->hashes[slot] == hash) {
+            compares++;
+            if (compare(index->nodes[slot]->value, value) == 0) {
+                found = index->nodes[slot];
+                break;
+            }
+        }
+    }
+
+    LIST_STATS_ADD(stats, LIST_STATS_NODES_VISITED, visited);
+    LIST_STATS_ADD(stats, LIST_STATS_COMPARES, compares);
+    // stats is only used when built with DS_INSTRUMENTATION
+    (void) stats;
+
+    return found;
+}
+
+/// @fn static void listIndexRemove(ListIndex *index, ListNode *node)
+///
+/// @brief Remove a specific node from a ListIndex.
+///
+/// @note Entries after the removed one are shifted back into the gap, so the
+/// table never needs tombstones.
+static void listIndexRemove(ListIndex *index, ListNode *node) {
+    size_t mask = index->capacity - 1;
+    size_t slot = listIndexSlot(index, index->hash(node->value));
+    while (index->nodes[slot] != node) {
+        if (index->nodes[slot] == NULL) {
+            // Not indexed.  Shouldn't happen, but don't corrupt the table.
+            return;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & mask;
+        index->nodes[next] != NULL;
+        next = (next + 1) & mask
+    ) {
+        // An entry can move back into the hole only if the hole is not before
+        // its ideal slot, going around the table.
+        size_t ideal = listIndexSlot(index, index->hashes[next]);
+        if (((next - ideal) & mask) >= ((next - hole) & mask)) {
+            index->nodes[hole] = index->nodes[next];
+            index->hashes[hole] = index->hashes[next];
+            hole = next;
+        }
+    }
+
+    index->nodes[hole] = NULL;
+    index->count--;
+}
+
+/// @fn static ListIndex* listIndexDestroy(ListIndex *index)
+///
+/// @brief Release all the memory held by a ListIndex.  The nodes it refers to
+/// are untouched.
 ///
 /// @return This function always succeeds and always returns NULL.
-ListNode* listNodeDestroy(ListNode *node) {
-    // Deallocate the ListNode in the reverse order it was created
-    free(node->value); node->value = NULL;
-    free(node); node = NULL;
+static ListIndex* listIndexDestroy(ListIndex *index) {
+    if (index != NULL) {
+        const Allocator *allocator = index->allocator;
+        allocatorFree(allocator, index->nodes,
+            index->capacity * sizeof(ListNode*));
+        index->nodes = NULL;
+        allocatorFree(allocator, index->hashes,
+            index->capacity * sizeof(size_t));
+        index->hashes = NULL;
+        allocatorFree(allocator, index, sizeof(ListIndex));
+        index = NULL;
+    }
+
     return NULL;
 }
 
@@ -90,24 +440,97 @@ ListNode* listNodeDestroy(ListNode *node) {
 /// @return Returns a pointer to an allocated and initialized LinkedList on
 /// success, NULL on failure.
 LinkedList* linkedListCreate(int (*compare)(const void*, const void*)) {
+    return linkedListCreateWithAllocator(compare, NULL);
+}
+
+/// @fn LinkedList* linkedListCreateWithAllocator(
+///   int (*compare)(const void*, const void*), const Allocator *allocator)
+///
+/// @brief Allocate and initialize a linked list that gets all of its memory
+/// from a given allocator.
+///
+/// @param compare Function that compares two values in the list.
+/// @param allocator The allocator to use, or NULL for malloc and free.  It is
+///   copied, so only its context has to outlive the list.
+///
+/// @note With an Arena, a list that is only needed for a while can be thrown
+/// away with the rest of the Arena instead of being destroyed node by node.
+///
+/// @return Returns a pointer to an allocated and initialized LinkedList on
+/// success, NULL on failure.
+LinkedList* linkedListCreateWithAllocator(
+    int (*compare)(const void*, const void*), const Allocator *allocator
+) {
     if (compare == NULL) {
         // We can't create a list like this
         return NULL;
     }
 
-    LinkedList *linkedList = (LinkedList*) calloc(1, sizeof(LinkedList));
+    Allocator listAllocator
+        = (allocator != NULL) ? *allocator : allocatorLibc();
+
+    LinkedList *linkedList = (LinkedList*) allocatorCalloc(&listAllocator, 1,
+        sizeof(LinkedList));
     if (linkedList == NULL) {
         // Out of memory
         return NULL;
     }
 
     linkedList->compare = compare;
-    // All other values are initialized to 0 by calloc
+    linkedList->allocator = listAllocator;
+    // All other values, including the empty node pool, are initialized to 0
+    // by calloc
+    linkedList->stats = listStatsRegister("LinkedList", linkedList);
+    LIST_STATS_ADD(linkedList->stats, LIST_STATS_MALLOCS, 1);
 
     return linkedList;
 }
 
-/// @fn int linkedListInsertFront(LinkedList *linkedList, void *value, int size)
+/// @fn LinkedList* linkedListDestroy(LinkedList *linkedList)
+///
+/// @brief Release all the memory held by a linked list, its nodes and their
+/// values.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+///
+/// @return This function always succeeds and always returns NULL.
+LinkedList* linkedListDestroy(LinkedList *linkedList) {
+    if (linkedList == NULL) {
+        return NULL;
+    }
+
+    // Pooled nodes go away with their slabs, so only the nodes that were
+    // allocated on their own have to be freed one at a time
+    ListNode *cur = linkedList->head;
+    while (cur != NULL) {
+        ListNode *next = cur->next;
+        if (cur->sizeClass == LIST_NODE_POOL_CLASSES) {
+            allocatorFree(&linkedList->allocator, cur,
+                sizeof(ListNode) + (size_t) cur->size);
+        }
+        cur = next;
+    }
+
+    linkedList->index = listIndexDestroy(linkedList->index);
+    linkedList->stats = listStatsUnregister(linkedList->stats);
+
+    ListNodeSlab *slab = linkedList->nodePool.slabs;
+    while (slab != NULL) {
+        ListNodeSlab *next = slab->next;
+        allocatorFree(&linkedList->allocator, slab, slab->size);
+        slab = next;
+    }
+
+    // The allocator is about to be freed along with the list
+    Allocator allocator = linkedList->allocator;
+    allocatorFree(&allocator, linkedList, sizeof(LinkedList));
+    linkedList = NULL;
+
+    return NULL;
+}
+
+/// @fn int linkedListInsertFront(LinkedList *linkedList, const void *value,
+///   int size)
 ///
 /// @brief Insert a new value at the front of a linked list.
 ///
@@ -116,14 +539,24 @@ LinkedList* linkedListCreate(int (*compare)(const void*, const void*)) {
 /// @param size The number of bytes the value takes up.
 ///
 /// @return Returns 0 on success, -1 on failure.
-int linkedListInsertFront(LinkedList *linkedList, void *value, int size) {
+int linkedListInsertFront(LinkedList *linkedList, const void *value, int size) {
     if (linkedList == NULL) {
         // Nothing we can do
         return -1;
     }
 
+    LIST_STATS_TIMER(start);
+
+    // Make room in the index first so that nothing can fail after the node
+    // is linked in
+    if ((linkedList->index != NULL) && (listIndexReserve(linkedList->index,
+        linkedList->index->count + 1) != 0)
+    ) {
+        return -1;
+    }
+
     // Create the new node and copy the value
-    ListNode *node = listNodeCreate(value, size);
+    ListNode *node = listNodeCreate(linkedList, value, size);
     if (node == NULL) {
         return -1;
     }
@@ -132,8 +565,8 @@ int linkedListInsertFront(LinkedList *linkedList, void *value, int size) {
     if (linkedList->head != NULL) {
         linkedList->head->prev = node;
     }
-    node->next = linkedList->head
-    // No need to set node->prev since node was created with calloc
+    node->next = linkedList->head;
+    // No need to set node->prev since listNodeCreate cleared it
     linkedList->head = node;
     if (linkedList->tail == NULL) {
         // List was empty
@@ -141,10 +574,17 @@ int linkedListInsertFront(LinkedList *linkedList, void *value, int size) {
     }
     linkedList->size++;
 
+    if (linkedList->index != NULL) {
+        listIndexPlace(linkedList->index, node,
+            linkedList->index->hash(node->value));
+    }
+    LIST_STATS_LATENCY(linkedList->stats, LIST_STATS_OP_INSERT, start);
+
     return 0;
 }
 
-/// @fn int linkedListInsertBack(LinkedList *linkedList, void *value, int size)
+/// @fn int linkedListInsertBack(LinkedList *linkedList, const void *value,
+///   int size)
 ///
 /// @brief Insert a new value at the back of a linked list.
 ///
@@ -153,14 +593,24 @@ int linkedListInsertFront(LinkedList *linkedList, void *value, int size) {
 /// @param size The number of bytes the value takes up.
 ///
 /// @return Returns 0 on success, -1 on failure.
-int linkedListInsertBack(LinkedList *linkedList, void *value, int size) {
+int linkedListInsertBack(LinkedList *linkedList, const void *value, int size) {
     if (linkedList == NULL) {
         // Nothing we can do
         return -1;
     }
 
+    LIST_STATS_TIMER(start);
+
+    // Make room in the index first so that nothing can fail after the node
+    // is linked in
+    if ((linkedList->index != NULL) && (listIndexReserve(linkedList->index,
+        linkedList->index->count + 1) != 0)
+    ) {
+        return -1;
+    }
+
     // Create the new node and copy the value
-    ListNode *node = listNodeCreate(value, size);
+    ListNode *node = listNodeCreate(linkedList, value, size);
     if (node == NULL) {
         return -1;
     }
@@ -170,7 +620,7 @@ int linkedListInsertBack(LinkedList *linkedList, void *value, int size) {
         linkedList->tail->next = node;
     }
     node->prev = linkedList->tail;
-    // No need to set node->next since node was created with calloc
+    // No need to set node->next since listNodeCreate cleared it
     linkedList->tail = node;
     if (linkedList->head == NULL) {
         // List was empty
@@ -178,6 +628,12 @@ int linkedListInsertBack(LinkedList *linkedList, void *value, int size) {
     }
     linkedList->size++;
 
+    if (linkedList->index != NULL) {
+        listIndexPlace(linkedList->index, node,
+            linkedList->index->hash(node->value));
+    }
+    LIST_STATS_LATENCY(linkedList->stats, LIST_STATS_OP_INSERT, start);
+
     return 0;
 }
 
@@ -188,6 +644,10 @@ int linkedListInsertBack(LinkedList *linkedList, void *value, int size) {
 /// @param linkedList A pointer to a previously-initialized LinkedList.
 /// @param value A pointer to the value to search for.
 ///
+/// @note With an index enabled this is O(1) expected time, but when several
+/// nodes hold equal values it may return any one of them rather than the one
+/// nearest the front.
+///
 /// @return Returns a pointer to the ListNode that contains the value on
 /// success, NULL on failure.
 ListNode* linkedListSearch(LinkedList *linkedList, const void *value) {
@@ -196,16 +656,35 @@ ListNode* linkedListSearch(LinkedList *linkedList, const void *value) {
         return NULL;
     }
 
+    LIST_STATS_TIMER(start);
+    LIST_STATS_ADD(linkedList->stats, LIST_STATS_SEARCHES, 1);
+    if (linkedList->index != NULL) {
+        ListNode *found
+            = listIndexFind(linkedList->index, linkedList->compare, value,
+                linkedList->stats);
+        LIST_STATS_LATENCY(linkedList->stats, LIST_STATS_OP_SEARCH, start);
+        return found;
+    }
+
     // Get the comparison function from the list
     int (*compare)(const void*, const void*) = linkedList->compare;
 
+    ListNode *found = NULL;
+    size_t visited = 0;
     for (ListNode *cur = linkedList->head; cur != NULL; cur = cur->next) {
+        visited++;
         if (compare(cur->value, value) == 0) {
-            return cur;
+            found = cur;
+            break;
         }
     }
 
-    return NULL;
+    // Every node visited is compared once
+    LIST_STATS_ADD(linkedList->stats, LIST_STATS_NODES_VISITED, visited);
+    LIST_STATS_ADD(linkedList->stats, LIST_STATS_COMPARES, visited);
+    LIST_STATS_LATENCY(linkedList->stats, LIST_STATS_OP_SEARCH, start);
+
+    return found;
 }
 
 /// @fn int linkedListRemoveValue(LinkedList *linkedList, const void *value)
@@ -215,6 +694,9 @@ ListNode* linkedListSearch(LinkedList *linkedList, const void *value) {
 /// @param linkedList A pointer to a previously-initialized LinkedList.
 /// @param value A pointer to the value to remove.
 ///
+/// @note Like linkedListSearch, with an index enabled the node removed may be
+/// any one holding an equal value.
+///
 /// @return Returns 0 on success, -1 on failure.
 int linkedListRemoveValue(LinkedList *linkedList, const void *value) {
     ListNode *found = linkedListSearch(linkedList, value);
@@ -223,24 +705,92 @@ int linkedListRemoveValue(LinkedList *linkedList, const void *value) {
         return -1;
     }
 
-    // Splice out the found node from its neighbors
-    if (found->prev != NULL) {
-        found->prev->next = found->next;
+    return linkedListRemoveNode(linkedList, found);
+}
+
+/// @fn static void linkedListUnlink(LinkedList *linkedList, ListNode *node)
+///
+/// @brief Splice a node out from its neighbors without destroying it.
+///
+/// @param linkedList A pointer to the LinkedList the node is in.
+/// @param node A pointer to the ListNode to splice out.
+static void linkedListUnlink(LinkedList *linkedList, ListNode *node) {
+    // Splice out the node from its neighbors
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
     }
-    if (found->next != NULL) {
-        found->next->prev = found->prev;
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
     }
 
     // Update head and tail if we're the beginning or end of the list
-    if (found == linkedList->head) {
-        linkedList->head = found->next;
+    if (node == linkedList->head) {
+        linkedList->head = node->next;
     }
-    if (found == linkedList->tail) {
-        linkedList->tail = found->prev;
+    if (node == linkedList->tail) {
+        linkedList->tail = node->prev;
     }
 
-    found = listNodeDestroy(found);
+    node->next = NULL;
+    node->prev = NULL;
+}
+
+/// @fn int linkedListRemoveNode(LinkedList *linkedList, ListNode *node)
+///
+/// @brief Remove a specific node from a linked list in O(1) time.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param node A pointer to a ListNode in linkedList, such as one returned by
+///   linkedListSearch.
+///
+/// @return Returns 0 on success, -1 on failure.
+int linkedListRemoveNode(LinkedList *linkedList, ListNode *node) {
+    if ((linkedList == NULL) || (node == NULL)) {
+        // Nothing we can do
+        return -1;
+    }
+
+    LIST_STATS_TIMER(start);
+    linkedListUnlink(linkedList, node);
+    if (linkedList->index != NULL) {
+        listIndexRemove(linkedList->index, node);
+    }
+    node = listNodeDestroy(linkedList, node);
     linkedList->size--;
+    LIST_STATS_LATENCY(linkedList->stats, LIST_STATS_OP_REMOVE, start);
+
+    return 0;
+}
+
+/// @fn int linkedListMoveToFront(LinkedList *linkedList, ListNode *node)
+///
+/// @brief Move a node of a linked list to the front of the list in O(1) time.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param node A pointer to a ListNode in linkedList.
+///
+/// @note The node itself is relinked, not copied, so pointers to it and to its
+/// value stay valid.
+///
+/// @return Returns 0 on success, -1 on failure.
+int linkedListMoveToFront(LinkedList *linkedList, ListNode *node) {
+    if ((linkedList == NULL) || (node == NULL)) {
+        // Nothing we can do
+        return -1;
+    } else if (node == linkedList->head) {
+        // Already there
+        return 0;
+    }
+
+    linkedListUnlink(linkedList, node);
+    node->next = linkedList->head;
+    if (linkedList->head != NULL) {
+        linkedList->head->prev = node;
+    }
+    linkedList->head = node;
+    if (linkedList->tail == NULL) {
+        linkedList->tail = node;
+    }
 
     return 0;
 }
@@ -281,57 +831,233 @@ void* linkedListPeekBack(LinkedList *linkedList) {
     return back;
 }
 
-/// @fn void* linkedListPopFront(LinkedList *linkedList)
+/// @fn int linkedListPopFront(LinkedList *linkedList, void *value, int size)
 ///
-/// @brief Get the value from the front of the list if there is one and destroy
-/// the ListNode.
+/// @brief Copy out the value from the front of the list if there is one and
+/// destroy the ListNode.
 ///
 /// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param value A pointer to the buffer to copy the value into, or NULL to
+///   discard the value.
+/// @param size The number of bytes the buffer can hold.
 ///
-/// @return Returns the value at the front of the list on success, NULL on
-/// failure.
-void* linkedListPopFront(LinkedList *linkedList) {
+/// @note The node goes back to the list's pool, so popping never frees.
+///
+/// @return Returns 0 on success, -1 if the list is empty or the value does not
+/// fit in the buffer.  The list is unchanged on failure.
+int linkedListPopFront(LinkedList *linkedList, void *value, int size) {
     if ((linkedList == NULL) || (linkedList->head == NULL)) {
-        return NULL;
+        return -1;
     }
 
+    LIST_STATS_TIMER(start);
     ListNode *node = linkedList->head;
-    void *front = node->value;
+    if (value != NULL) {
+        if (size < node->size) {
+            return -1;
+        }
+        memcpy(value, node->value, (size_t) node->size);
+    }
 
     linkedList->head = node->next;
-    if (linkedList->size == 1) {
+    if (linkedList->head != NULL) {
+        linkedList->head->prev = NULL;
+    } else {
         linkedList->tail = NULL;
     }
-    free(node); node = NULL;
+    if (linkedList->index != NULL) {
+        listIndexRemove(linkedList->index, node);
+    }
+    node = listNodeDestroy(linkedList, node);
     linkedList->size--;
+    LIST_STATS_LATENCY(linkedList->stats, LIST_STATS_OP_POP, start);
 
-    return front;
+    return 0;
 }
 
-/// @fn void* linkedListPopBack(LinkedList *linkedList)
+/// @fn int linkedListPopBack(LinkedList *linkedList, void *value, int size)
 ///
-/// @brief Get the value from the back of the list if there is one and destroy
-/// the ListNode.
+/// @brief Copy out the value from the back of the list if there is one and
+/// destroy the ListNode.
 ///
 /// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param value A pointer to the buffer to copy the value into, or NULL to
+///   discard the value.
+/// @param size The number of bytes the buffer can hold.
 ///
-/// @return Returns the value at the back of the list on success, NULL on
-/// failure.
-void* linkedListPopBack(LinkedList *linkedList) {
-    if ((linkedList == NULL) || (linkedList->head == NULL)) {
-        return NULL;
+/// @note The node goes back to the list's pool, so popping never frees.
+///
+/// @return Returns 0 on success, -1 if the list is empty or the value does not
+/// fit in the buffer.  The list is unchanged on failure.
+int linkedListPopBack(LinkedList *linkedList, void *value, int size) {
+    if ((linkedList == NULL) || (linkedList->tail == NULL)) {
+        return -1;
     }
 
+    LIST_STATS_TIMER(start);
     ListNode *node = linkedList->tail;
-    void *back = node->value;
+    if (value != NULL) {
+        if (size < node->size) {
+            return -1;
+        }
+        memcpy(value, node->value, (size_t) node->size);
+    }
 
     linkedList->tail = node->prev;
-    if (linkedList->size == 1) {
+    if (linkedList->tail != NULL) {
+        linkedList->tail->next = NULL;
+    } else {
         linkedList->head = NULL;
     }
-    free(node); node = NULL;
+    if (linkedList->index != NULL) {
+        listIndexRemove(linkedList->index, node);
+    }
+    node = listNodeDestroy(linkedList, node);
     linkedList->size--;
+    LIST_STATS_LATENCY(linkedList->stats, LIST_STATS_OP_POP, start);
 
-    return back;
+    return 0;
 }
 
+// LinkedList hash index functions follow
+
+/// @fn int linkedListEnableIndex(LinkedList *linkedList,
+///   size_t (*hash)(const void*))
+///
+/// @brief Build a hash index over the values of a linked list so that search
+/// and remove-by-value take O(1) expected time.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param hash Function that hashes a value.  Values that the list's compare
+///   function says are equal must hash the same.
+///
+/// @note Once enabled, the index is kept up to date by every insert, pop and
+/// remove.  Enabling it again with a different hash function rebuilds it.
+///
+/// @return Returns 0 on success, -1 on failure.
+int linkedListEnableIndex(LinkedList *linkedList,
+    size_t (*hash)(const void*)
+) {
+    if ((linkedList == NULL) || (hash == NULL)) {
+        return -1;
+    }
+
+    ListIndex *index = (ListIndex*) allocatorCalloc(&linkedList->allocator, 1,
+        sizeof(ListIndex));
+    if (index == NULL) {
+        // Out of memory
+        return -1;
+    }
+    index->hash = hash;
+    index->allocator = &linkedList->allocator;
+
+    size_t capacity = MIN_INDEX_CAPACITY;
+    while ((size_t) linkedList->size > capacity / 2) {
+        capacity *= 2;
+    }
+    if (listIndexResize(index, capacity) != 0) {
+        index = listIndexDestroy(index);
+        return -1;
+    }
+
+    for (ListNode *cur = linkedList->head; cur != NULL; cur = cur->next) {
+        listIndexPlace(index, cur, hash(cur->value));
+    }
+
+    listIndexDestroy(linkedList->index);
+    linkedList->index = index;
+
+    return 0;
+}
+
+/// @fn int linkedListDisableIndex(LinkedList *linkedList)
+///
+/// @brief Drop the hash index of a linked list, if it has one.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+///
+/// @return Returns 0 on success, -1 on failure.
+int linkedListDisableIndex(LinkedList *linkedList) {
+    if (linkedList == NULL) {
+        return -1;
+    }
+
+    linkedList->index = listIndexDestroy(linkedList->index);
+
+    return 0;
+}
+
+// LinkedList instrumentation functions follow
+
+/// @fn int linkedListGetStats(LinkedList *linkedList, ListStats *stats)
+///
+/// @brief Get a snapshot of the instrumentation counters of a linked list.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param stats The snapshot to fill in.
+///
+/// @note Counters are only kept when the library is built with
+/// DS_INSTRUMENTATION.  Searches answered by the hash index count one node
+/// visited per index slot they probe and one compare per equality check.
+///
+/// @return Returns 0 on success, -1 on failure or if instrumentation was not
+/// built in.
+int linkedListGetStats(LinkedList *linkedList, ListStats *stats) {
+    if (linkedList == NULL) {
+        // Nothing we can do
+        return -1;
+    }
+
+    return listStatsGet(linkedList->stats, stats);
+}
+
+/// @fn int linkedListMemoryUsage(LinkedList *linkedList,
+///   LLMemoryUsage *memoryUsage)
+///
+/// @brief Report how much memory a linked list holds and what it holds it
+/// for.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param memoryUsage The report to fill in.
+///
+/// @note This walks every node, so it is O(n).  Nodes that go back to the
+/// pool are kept for reuse rather than freed, and show up as overhead.
+///
+/// @return Returns 0 on success, -1 on failure.
+int linkedListMemoryUsage(LinkedList *linkedList, LLMemoryUsage *memoryUsage) {
+    if ((linkedList == NULL) || (memoryUsage == NULL)) {
+        // Nothing we can do
+        return -1;
+    }
+
+    size_t nodeBytes = 0;
+    size_t valueBytes = 0;
+    size_t totalBytes = sizeof(LinkedList);
+    for (ListNode *cur = linkedList->head; cur != NULL; cur = cur->next) {
+        nodeBytes += sizeof(ListNode);
+        valueBytes += (size_t) cur->size;
+        if (cur->sizeClass == LIST_NODE_POOL_CLASSES) {
+            // Pooled nodes are counted with their slabs
+            totalBytes += sizeof(ListNode) + (size_t) cur->size;
+        }
+    }
+
+    for (ListNodeSlab *slab = linkedList->nodePool.slabs; slab != NULL;
+        slab = slab->next
+    ) {
+        totalBytes += slab->size;
+    }
+
+    const ListIndex *index = linkedList->index;
+    if (index != NULL) {
+        totalBytes += sizeof(ListIndex)
+            + (index->capacity * (sizeof(ListNode*) + sizeof(size_t)));
+    }
+
+    memoryUsage->nodeBytes = nodeBytes;
+    memoryUsage->valueBytes = valueBytes;
+    memoryUsage->overheadBytes = totalBytes - nodeBytes - valueBytes;
+    memoryUsage->totalBytes = totalBytes;
+
+    return 0;
+}
@@ -36,24 +36,54 @@
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+// Standard C includes
+#include <stddef.h>
+
+#include "Allocator.h"
+#include "ListStats.h"
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+/// @def LIST_NODE_POOL_CLASSES
+///
+/// @brief Number of value size classes kept in a ListNodePool.  Class n holds
+/// values of up to (8 << n) bytes; larger values get a node of their own.
+#define LIST_NODE_POOL_CLASSES 6
+
 /// @struct ListNode
 ///
 /// @brief Individual node component of a linked list.
 ///
 /// @param next Pointer to the next ListNode in the list.
 /// @param prev Pointer to the previous ListNode in the list.
-/// @param value Pointer to the value that is at this node.
+/// @param size The number of bytes in value.
+/// @param sizeClass The ListNodePool size class the node was allocated from,
+///   or LIST_NODE_POOL_CLASSES if it was allocated on its own.
+/// @param value The value that is at this node, stored inline directly after
+///   the rest of the node.
 typedef struct ListNode {
     struct ListNode *next;
     struct ListNode *prev;
-    void *value;
+    int size;
+    int sizeClass;
+    unsigned char value[];
 } ListNode;
 
+/// @struct ListNodePool
+///
+/// @brief Recycles the ListNodes of a linked list so that steady-state inserts
+/// and pops don't have to allocate.
+///
+/// @param freeNodes One list of free nodes per size class, linked by next.
+/// @param slabs Every block of nodes the pool has allocated.
+typedef struct ListNodePool {
+    ListNode *freeNodes[LIST_NODE_POOL_CLASSES];
+    struct ListNodeSlab *slabs;
+} ListNodePool;
+
 /// @struct LinkedList
 ///
 /// @brief Base container for a linked list.
@@ -63,21 +93,65 @@ typedef struct ListNode {
 /// @param head Pointer to the first ListNode in the list.
 /// @param tail Pointer to the last ListNode in the list.
 /// @param size Number of elements in the list.
+/// @param nodePool Where the list's nodes come from and go back to.
+/// @param index Optional hash index from values to nodes, or NULL.  See
+///   linkedListEnableIndex.
+/// @param stats The list's instrumentation counters, or NULL if built without
+///   DS_INSTRUMENTATION.  See linkedListGetStats.
+/// @param allocator Where the list, its nodes and its index get their memory.
+///   See linkedListCreateWithAllocator.
 typedef struct LinkedList {
     int (*compare)(const void*, const void*);
     ListNode *head;
     ListNode *tail;
     int size;
+    ListNodePool nodePool;
+    struct ListIndex *index;
+    struct ListStatsRecord *stats;
+    Allocator allocator;
 } LinkedList;
 
+/// @struct LLMemoryUsage
+///
+/// @brief Where the memory of a LinkedList goes.  See linkedListMemoryUsage.
+///
+/// @param nodeBytes The bytes of the links and sizes of the nodes in the list.
+/// @param valueBytes The bytes of the values in the list.
+/// @param overheadBytes Every other byte the list holds:  the LinkedList
+///   itself, free nodes kept by the pool, slab headers, the part of each
+///   pooled node its value doesn't fill, and the hash index.
+/// @param totalBytes The sum of the above.
+typedef struct LLMemoryUsage {
+    size_t nodeBytes;
+    size_t valueBytes;
+    size_t overheadBytes;
+    size_t totalBytes;
+} LLMemoryUsage;
+
 // Base LinkedList prototypes
 LinkedList* linkedListCreate(int (*compare)(const void*, const void*));
-int linkedListInsertFront(LinkedList *linkedList, void *value, int size);
-int linkedListInsertBack(LinkedList *linkedList, void *value, int size);
+LinkedList* linkedListCreateWithAllocator(
+    int (*compare)(const void*, const void*), const Allocator *allocator);
+LinkedList* linkedListDestroy(LinkedList *linkedList);
+int linkedListInsertFront(LinkedList *linkedList, const void *value, int size);
+int linkedListInsertBack(LinkedList *linkedList, const void *value, int size);
 ListNode* linkedListSearch(LinkedList *linkedList, const void *value);
 int linkedListRemoveValue(LinkedList *linkedList, const void *value);
+int linkedListRemoveNode(LinkedList *linkedList, ListNode *node);
+int linkedListMoveToFront(LinkedList *linkedList, ListNode *node);
 void* linkedListPeekFront(LinkedList *linkedList);
 void* linkedListPeekBack(LinkedList *linkedList);
+int linkedListPopFront(LinkedList *linkedList, void *value, int size);
+int linkedListPopBack(LinkedList *linkedList, void *value, int size);
+
+// LinkedList hash index prototypes
+int linkedListEnableIndex(LinkedList *linkedList,
+    size_t (*hash)(const void*));
+int linkedListDisableIndex(LinkedList *linkedList);
+
+// Instrumentation prototypes
+int linkedListGetStats(LinkedList *linkedList, ListStats *stats);
+int linkedListMemoryUsage(LinkedList *linkedList, LLMemoryUsage *memoryUsage);
 
 #ifdef __cplusplus
 } // extern "C"
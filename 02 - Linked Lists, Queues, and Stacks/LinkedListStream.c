@@ -0,0 +1,602 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file LinkedListStream.c
+///
+/// @brief Library implementation of LinkedList serialization.
+///
+/// A serialized list is an 8-byte stream header, "LLST" followed by a
+/// little-endian version number, and then one record per node from front to
+/// back.  Each record is the value's size as a 4-byte little-endian integer
+/// followed by that many bytes of value.  There is no trailer:  the stream
+/// ends where the last whole record ends, so a stream cut short by a crash is
+/// recognizable as one.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "LinkedListStream.h"
+
+/// @def STREAM_BUFFER_BYTES
+///
+/// @brief Size of the buffer records are gathered into before each write and
+/// read into before they are handed out.
+#define STREAM_BUFFER_BYTES (64 * 1024)
+
+/// @def STREAM_HEADER_BYTES
+///
+/// @brief Size of the header at the start of every serialized list.
+#define STREAM_HEADER_BYTES 8
+
+/// @def RECORD_PREFIX_BYTES
+///
+/// @brief Size of the length at the start of every record.
+#define RECORD_PREFIX_BYTES 4
+
+/// @def STREAM_VERSION
+///
+/// @brief Version of the stream format written by this code.
+#define STREAM_VERSION 1
+
+/// @var streamMagic
+///
+/// @brief First four bytes of every serialized list.
+static const unsigned char streamMagic[4] = { 'L', 'L', 'S', 'T' };
+
+/// @struct ListStream
+///
+/// @brief A FILE* or file descriptor plus a buffer, used for both reading and
+/// writing.
+///
+/// @param file The FILE* to use, or NULL to use fd.
+/// @param fd The file descriptor to use when file is NULL.
+/// @param buffer Pointer to the buffered bytes.
+/// @param bufferSize Number of bytes buffer can hold.
+/// @param start Offset of the first buffered byte not yet consumed.
+/// @param end Offset just past the last buffered byte.
+/// @param failed Nonzero once a read or write has failed.
+typedef struct ListStream {
+    FILE *file;
+    int fd;
+    unsigned char *buffer;
+    size_t bufferSize;
+    size_t start;
+    size_t end;
+    int failed;
+} ListStream;
+
+/// @struct ListReader
+///
+/// @brief A ListStream being read from.
+///
+/// @param stream The stream the records come from.
+struct ListReader {
+    ListStream stream;
+};
+
+/// @fn static void encodeLength(unsigned char *bytes, uint32_t length)
+///
+/// @brief Store a 32-bit value as 4 little-endian bytes.
+static void encodeLength(unsigned char *bytes, uint32_t length) {
+    bytes[0] = (unsigned char) length;
+    bytes[1] = (unsigned char) (length >> 8);
+    bytes[2] = (unsigned char) (length >> 16);
+    bytes[3] = (unsigned char) (length >> 24);
+}
+
+/// @fn static uint32_t decodeLength(const unsigned char *bytes)
+///
+/// @brief Load a 32-bit value from 4 little-endian bytes.
+static uint32_t decodeLength(const unsigned char *bytes) {
+    return (uint32_t) bytes[0] | ((uint32_t) bytes[1] << 8)
+        | ((uint32_t) bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+}
+
+// ListStream functions follow
+
+/// @fn static int listStreamInit(ListStream *stream, FILE *file, int fd)
+///
+/// @brief Initialize a ListStream and allocate its buffer.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int listStreamInit(ListStream *stream, FILE *file, int fd) {
+    stream->file = file;
+    stream->fd = fd;
+    stream->bufferSize = STREAM_BUFFER_BYTES;
+    stream->start = 0;
+    stream->end = 0;
+    stream->failed = 0;
+    stream->buffer = (unsigned char*) malloc(stream->bufferSize);
+    if (stream->buffer == NULL) {
+        // Out of memory
+        return -1;
+    }
+
+    return 0;
+}
+
+/// @fn static void listStreamFree(ListStream *stream)
+///
+/// @brief Release the buffer of a ListStream.  The file is left open.
+static void listStreamFree(ListStream *stream) {
+    free(stream->buffer); stream->buffer = NULL;
+}
+
+/// @fn static int listStreamWriteRaw(ListStream *stream, const void *bytes,
+///   size_t length)
+///
+/// @brief Write bytes straight to the underlying file, bypassing the buffer.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int listStreamWriteRaw(ListStream *stream, const void *bytes,
+    size_t length
+) {
+    if (stream->file != NULL) {
+        if (fwrite(bytes, 1, length, stream->file) != length) {
+            stream->failed = 1;
+            return -1;
+        }
+        return 0;
+    }
+
+    const unsigned char *next = (const unsigned char*) bytes;
+    while (length > 0) {
+        ssize_t written = write(stream->fd, next, length);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            stream->failed = 1;
+            return -1;
+        }
+        next += written;
+        length -= (size_t) written;
+    }
+
+    return 0;
+}
+
+/// @fn static int listStreamFlush(ListStream *stream)
+///
+/// @brief Write out everything in the buffer of a stream being written.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int listStreamFlush(ListStream *stream) {
+    if (stream->end > 0) {
+        if (listStreamWriteRaw(stream, stream->buffer, stream->end) != 0) {
+            return -1;
+        }
+        stream->end = 0;
+    }
+
+    return 0;
+}
+
+/// @fn static int listStreamWrite(ListStream *stream, const void *bytes,
+///   size_t length)
+///
+/// @brief Add bytes to a stream being written.
+///
+/// @note Small writes are gathered in the buffer.  A write too big for the
+/// buffer flushes it and goes straight to the file.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int listStreamWrite(ListStream *stream, const void *bytes,
+    size_t length
+) {
+    if (length > stream->bufferSize - stream->end) {
+        if (listStreamFlush(stream) != 0) {
+            return -1;
+        } else if (length > stream->bufferSize) {
+            return listStreamWriteRaw(stream, bytes, length);
+        }
+    }
+
+    memcpy(stream->buffer + stream->end, bytes, length);
+    stream->end += length;
+
+    return 0;
+}
+
+/// @fn static size_t listStreamReadRaw(ListStream *stream, void *bytes,
+///   size_t length)
+///
+/// @brief Read up to length bytes straight from the underlying file.
+///
+/// @return Returns the number of bytes read, which is less than length only at
+/// the end of the file or on failure.
+static size_t listStreamReadRaw(ListStream *stream, void *bytes,
+    size_t length
+) {
+    if (stream->file != NULL) {
+        size_t got = fread(bytes, 1, length, stream->file);
+        if ((got < length) && ferror(stream->file)) {
+            stream->failed = 1;
+        }
+        return got;
+    }
+
+    unsigned char *next = (unsigned char*) bytes;
+    size_t got = 0;
+    while (got < length) {
+        ssize_t justRead = read(stream->fd, next + got, length - got);
+        if (justRead < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            stream->failed = 1;
+            break;
+        } else if (justRead == 0) {
+            // End of file
+            break;
+        }
+        got += (size_t) justRead;
+    }
+
+    return got;
+}
+
+/// @fn static int listStreamFill(ListStream *stream, size_t length)
+///
+/// @brief Make sure a stream being read has at least length unconsumed bytes
+/// in its buffer, growing the buffer if it is too small to hold them.
+///
+/// @return Returns 0 on success, -1 on failure or if the stream ends first.
+static int listStreamFill(ListStream *stream, size_t length) {
+    size_t available = stream->end - stream->start;
+    if (available >= length) {
+        return 0;
+    }
+
+    if (length > stream->bufferSize) {
+        unsigned char *buffer = (unsigned char*) realloc(stream->buffer, length);
+        if (buffer == NULL) {
+            // Out of memory
+            stream->failed = 1;
+            return -1;
+        }
+        stream->buffer = buffer;
+        stream->bufferSize = length;
+    }
+
+    // Slide what's left to the front and top the buffer up in one read
+    memmove(stream->buffer, stream->buffer + stream->start, available);
+    stream->start = 0;
+    stream->end = available;
+    stream->end += listStreamReadRaw(stream, stream->buffer + stream->end,
+        stream->bufferSize - stream->end);
+
+    return ((stream->end >= length) && (stream->failed == 0)) ? 0 : -1;
+}
+
+// LinkedList serialization functions follow
+
+/// @fn static int linkedListWriteStream(LinkedList *linkedList,
+///   ListStream *stream)
+///
+/// @brief Write the header and every node of a linked list to a stream.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int linkedListWriteStream(LinkedList *linkedList, ListStream *stream) {
+    unsigned char header[STREAM_HEADER_BYTES];
+    memcpy(header, streamMagic, sizeof(streamMagic));
+    encodeLength(header + sizeof(streamMagic), STREAM_VERSION);
+    if (listStreamWrite(stream, header, sizeof(header)) != 0) {
+        return -1;
+    }
+
+    for (ListNode *cur = linkedList->head; cur != NULL; cur = cur->next) {
+        unsigned char prefix[RECORD_PREFIX_BYTES];
+        encodeLength(prefix, (uint32_t) cur->size);
+        if ((listStreamWrite(stream, prefix, sizeof(prefix)) != 0)
+            || (listStreamWrite(stream, cur->value, (size_t) cur->size) != 0)
+        ) {
+            return -1;
+        }
+    }
+
+    return listStreamFlush(stream);
+}
+
+/// @fn int linkedListWriteFile(LinkedList *linkedList, FILE *file)
+///
+/// @brief Serialize every value of a linked list, front to back, to a FILE*.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param file The file to write to, opened for binary writing.
+///
+/// @note Records are gathered into large chunks before they are written and
+/// the file is flushed at the end.  Getting the data onto disk, with fsync or
+/// otherwise, is up to the caller.
+///
+/// @return Returns 0 on success, -1 on failure.
+int linkedListWriteFile(LinkedList *linkedList, FILE *file) {
+    if ((linkedList == NULL) || (file == NULL)) {
+        // Nothing we can do
+        return -1;
+    }
+
+    ListStream stream;
+    if (listStreamInit(&stream, file, -1) != 0) {
+        return -1;
+    }
+
+    int returnValue = linkedListWriteStream(linkedList, &stream);
+    if ((returnValue == 0) && (fflush(file) != 0)) {
+        returnValue = -1;
+    }
+    listStreamFree(&stream);
+
+    return returnValue;
+}
+
+/// @fn int linkedListWriteFd(LinkedList *linkedList, int fd)
+///
+/// @brief Serialize every value of a linked list, front to back, to a file
+/// descriptor.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param fd The file descriptor to write to.
+///
+/// @note Records are gathered into large chunks so there are few write calls.
+///
+/// @return Returns 0 on success, -1 on failure.
+int linkedListWriteFd(LinkedList *linkedList, int fd) {
+    if ((linkedList == NULL) || (fd < 0)) {
+        // Nothing we can do
+        return -1;
+    }
+
+    ListStream stream;
+    if (listStreamInit(&stream, NULL, fd) != 0) {
+        return -1;
+    }
+
+    int returnValue = linkedListWriteStream(linkedList, &stream);
+    listStreamFree(&stream);
+
+    return returnValue;
+}
+
+/// @fn static int linkedListReadAll(LinkedList *linkedList,
+///   ListReader *listReader)
+///
+/// @brief Append every remaining record of a reader to a linked list.
+///
+/// @return Returns the number of values appended on success, -1 on failure.
+static int linkedListReadAll(LinkedList *linkedList, ListReader *listReader) {
+    int appended = 0;
+    const void *value = NULL;
+    int size = 0;
+    int result = 0;
+    while ((result = listReaderNext(listReader, &value, &size)) > 0) {
+        if ((appended == INT_MAX)
+            || (linkedListInsertBack(linkedList, value, size) != 0)
+        ) {
+            return -1;
+        }
+        appended++;
+    }
+
+    return (result == 0) ? appended : -1;
+}
+
+/// @fn int linkedListReadFile(LinkedList *linkedList, FILE *file)
+///
+/// @brief Append every value of a serialized list in a FILE* to the back of a
+/// linked list.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param file The file to read from, opened for binary reading.
+///
+/// @note On failure the values read before the problem stay in the list.
+///
+/// @return Returns the number of values appended on success, -1 on failure
+/// or if the stream is cut short.
+int linkedListReadFile(LinkedList *linkedList, FILE *file) {
+    if (linkedList == NULL) {
+        // Nothing we can do
+        return -1;
+    }
+
+    ListReader *listReader = listReaderCreate(file);
+    if (listReader == NULL) {
+        return -1;
+    }
+
+    int returnValue = linkedListReadAll(linkedList, listReader);
+    listReader = listReaderDestroy(listReader);
+
+    return returnValue;
+}
+
+/// @fn int linkedListReadFd(LinkedList *linkedList, int fd)
+///
+/// @brief Append every value of a serialized list in a file descriptor to the
+/// back of a linked list.
+///
+/// @param linkedList A pointer to a previously-initialized LinkedList.
+/// @param fd The file descriptor to read from.
+///
+/// @note On failure the values read before the problem stay in the list.
+///
+/// @return Returns the number of values appended on success, -1 on failure
+/// or if the stream is cut short.
+int linkedListReadFd(LinkedList *linkedList, int fd) {
+    if (linkedList == NULL) {
+        // Nothing we can do
+        return -1;
+    }
+
+    ListReader *listReader = listReaderCreateFd(fd);
+    if (listReader == NULL) {
+        return -1;
+    }
+
+    int returnValue = linkedListReadAll(linkedList, listReader);
+    listReader = listReaderDestroy(listReader);
+
+    return returnValue;
+}
+
+// ListReader functions follow
+
+/// @fn static ListReader* listReaderOpen(FILE *file, int fd)
+///
+/// @brief Create a ListReader and check the stream header.
+///
+/// @return Returns a pointer to the new ListReader on success, NULL on
+/// failure or if the stream is not a serialized list.
+static ListReader* listReaderOpen(FILE *file, int fd) {
+    ListReader *listReader = (ListReader*) malloc(sizeof(ListReader));
+    if (listReader == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    if (listStreamInit(&listReader->stream, file, fd) != 0) {
+        free(listReader); listReader = NULL;
+        return NULL;
+    }
+
+    ListStream *stream = &listReader->stream;
+    if ((listStreamFill(stream, STREAM_HEADER_BYTES) != 0)
+        || (memcmp(stream->buffer + stream->start, streamMagic,
+            sizeof(streamMagic)) != 0)
+        || (decodeLength(stream->buffer + stream->start + sizeof(streamMagic))
+            != STREAM_VERSION)
+    ) {
+        return listReaderDestroy(listReader);
+    }
+    stream->start += STREAM_HEADER_BYTES;
+
+    return listReader;
+}
+
+/// @fn ListReader* listReaderCreate(FILE *file)
+///
+/// @brief Start reading a serialized list from a FILE*.
+///
+/// @param file The file to read from, opened for binary reading.
+///
+/// @note The stream header is read and checked right away.
+///
+/// @return Returns a pointer to the new ListReader on success, NULL on
+/// failure or if the file does not hold a serialized list.
+ListReader* listReaderCreate(FILE *file) {
+    if (file == NULL) {
+        return NULL;
+    }
+
+    return listReaderOpen(file, -1);
+}
+
+/// @fn ListReader* listReaderCreateFd(int fd)
+///
+/// @brief Start reading a serialized list from a file descriptor.
+///
+/// @param fd The file descriptor to read from.
+///
+/// @note The stream header is read and checked right away.
+///
+/// @return Returns a pointer to the new ListReader on success, NULL on
+/// failure or if the file does not hold a serialized list.
+ListReader* listReaderCreateFd(int fd) {
+    if (fd < 0) {
+        return NULL;
+    }
+
+    return listReaderOpen(NULL, fd);
+}
+
+/// @fn ListReader* listReaderDestroy(ListReader *listReader)
+///
+/// @brief Release the memory held by a ListReader.  The file it was reading
+/// is left open.
+///
+/// @param listReader A pointer to the ListReader to destroy.
+///
+/// @return This function always succeeds and always returns NULL.
+ListReader* listReaderDestroy(ListReader *listReader) {
+    if (listReader != NULL) {
+        listStreamFree(&listReader->stream);
+        free(listReader); listReader = NULL;
+    }
+
+    return NULL;
+}
+
+/// @fn int listReaderNext(ListReader *listReader, const void **value,
+///   int *size)
+///
+/// @brief Get the next value of a serialized list.
+///
+/// @param listReader A pointer to a ListReader.
+/// @param value Set to point at the value inside the reader's buffer.  It is
+///   only valid until the next call.
+/// @param size Set to the number of bytes in the value.
+///
+/// @note The buffer only grows beyond its usual size to fit a single value
+/// bigger than it.
+///
+/// @return Returns 1 if a value was read, 0 at the clean end of the stream, or
+/// -1 on failure or if the stream ends partway through a record.
+int listReaderNext(ListReader *listReader, const void **value, int *size) {
+    if ((listReader == NULL) || (value == NULL) || (size == NULL)) {
+        return -1;
+    }
+
+    ListStream *stream = &listReader->stream;
+    if (listStreamFill(stream, RECORD_PREFIX_BYTES) != 0) {
+        // Running out exactly between records is the normal end
+        return ((stream->failed == 0) && (stream->end == stream->start))
+            ? 0 : -1;
+    }
+
+    uint32_t length = decodeLength(stream->buffer + stream->start);
+    if (length > (uint32_t) INT_MAX) {
+        // Not something we wrote
+        return -1;
+    } else if (listStreamFill(stream, RECORD_PREFIX_BYTES + (size_t) length)
+        != 0
+    ) {
+        return -1;
+    }
+
+    *value = stream->buffer + stream->start + RECORD_PREFIX_BYTES;
+    *size = (int) length;
+    stream->start += RECORD_PREFIX_BYTES + (size_t) length;
+
+    return 1;
+}
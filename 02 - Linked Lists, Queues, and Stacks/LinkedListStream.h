@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              LinkedListStream.h
+///
+/// @brief             Streaming binary serialization for LinkedList.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef LINKED_LIST_STREAM_H
+#define LINKED_LIST_STREAM_H
+
+// Standard C includes
+#include <stdio.h>
+
+#include "LinkedList.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct ListReader
+///
+/// @brief Reads the records of a serialized LinkedList back one at a time
+/// through a fixed-size buffer, so a stream of any length can be replayed
+/// without holding it all in memory.  The layout is private to
+/// LinkedListStream.c.
+typedef struct ListReader ListReader;
+
+// LinkedList serialization prototypes
+int linkedListWriteFile(LinkedList *linkedList, FILE *file);
+int linkedListWriteFd(LinkedList *linkedList, int fd);
+int linkedListReadFile(LinkedList *linkedList, FILE *file);
+int linkedListReadFd(LinkedList *linkedList, int fd);
+
+// ListReader prototypes
+ListReader* listReaderCreate(FILE *file);
+ListReader* listReaderCreateFd(int fd);
+ListReader* listReaderDestroy(ListReader *listReader);
+int listReaderNext(ListReader *listReader, const void **value, int *size);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // LINKED_LIST_STREAM_H
@@ -0,0 +1,574 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file RingDeque.c
+///
+/// @brief Library implementation of the RingDeque.
+///
+/// The values occupy capacity slots starting at head and wrapping around the
+/// end of the buffer, so any run of values is at most two contiguous pieces
+/// and every batched copy is at most two memcpy calls.
+
+// Standard C includes
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "RingDeque.h"
+
+/// @def MIN_CAPACITY
+///
+/// @brief Fewest values the buffer is allocated with.  Must be a power of two.
+#define MIN_CAPACITY 16
+
+/// @fn static unsigned char* ringDequeSlot(const RingDeque *ringDeque,
+///   size_t position)
+///
+/// @brief Get a pointer to a slot of the buffer.
+///
+/// @param ringDeque A pointer to the RingDeque.
+/// @param position The slot, which may be past the end of the buffer and is
+///   wrapped around it.
+///
+/// @return Returns a pointer to the slot.
+static unsigned char* ringDequeSlot(const RingDeque *ringDeque,
+    size_t position
+) {
+    return ringDeque->buffer + ((position & (ringDeque->capacity - 1))
+        * (size_t) ringDeque->elementSize);
+}
+
+/// @fn static void ringDequeCopyValue(void *destination, const void *source,
+///   int elementSize)
+///
+/// @brief Copy one value.
+///
+/// @note A memcpy of a size the compiler can't see is a library call that
+/// costs more than the rest of a push or pop.  Giving the common sizes their
+/// own constant-size memcpy lets those compile to a single move.
+static void ringDequeCopyValue(void *destination, const void *source,
+    int elementSize
+) {
+    switch (elementSize) {
+        case 4:
+            memcpy(destination, source, 4);
+            break;
+        case 8:
+            memcpy(destination, source, 8);
+            break;
+        case 16:
+            memcpy(destination, source, 16);
+            break;
+        default:
+            memcpy(destination, source, (size_t) elementSize);
+            break;
+    }
+}
+
+/// @fn static void ringDequeCopyIn(RingDeque *ringDeque, size_t position,
+///   const unsigned char *values, size_t count)
+///
+/// @brief Copy values into consecutive slots of the buffer, wrapping around
+/// its end if they have to.
+static void ringDequeCopyIn(RingDeque *ringDeque, size_t position,
+    const unsigned char *values, size_t count
+) {
+    size_t elementSize = (size_t) ringDeque->elementSize;
+    size_t start = position & (ringDeque->capacity - 1);
+    size_t first = ringDeque->capacity - start;
+    if (first > count) {
+        first = count;
+    }
+
+    memcpy(ringDeque->buffer + (start * elementSize), values,
+        first * elementSize);
+    if (count > first) {
+        memcpy(ringDeque->buffer, values + (first * elementSize),
+            (count - first) * elementSize);
+    }
+}
+
+/// @fn static void ringDequeCopyOut(const RingDeque *ringDeque,
+///   size_t position, unsigned char *values, size_t count)
+///
+/// @brief Copy values out of consecutive slots of the buffer, wrapping around
+/// its end if they have to.
+static void ringDequeCopyOut(const RingDeque *ringDeque, size_t position,
+    unsigned char *values, size_t count
+) {
+    size_t elementSize = (size_t) ringDeque->elementSize;
+    size_t start = position & (ringDeque->capacity - 1);
+    size_t first = ringDeque->capacity - start;
+    if (first > count) {
+        first = count;
+    }
+
+    memcpy(values, ringDeque->buffer + (start * elementSize),
+        first * elementSize);
+    if (count > first) {
+        memcpy(values + (first * elementSize), ringDeque->buffer,
+            (count - first) * elementSize);
+    }
+}
+
+/// @fn static int ringDequeGrow(RingDeque *ringDeque, size_t minCapacity)
+///
+/// @brief Make sure the buffer can hold at least minCapacity values.
+///
+/// @note The buffer doubles until it is big enough.  After the realloc, the
+/// values that wrapped around are no longer at the end of the buffer, so the
+/// shorter of the two pieces is moved to make them contiguous modulo the new
+/// capacity again.  The new capacity is at least twice the old one, so the
+/// move never overlaps.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int ringDequeGrow(RingDeque *ringDeque, size_t minCapacity) {
+    size_t oldCapacity = ringDeque->capacity;
+    if (minCapacity <= oldCapacity) {
+        return 0;
+    }
+
+    size_t elementSize = (size_t) ringDeque->elementSize;
+    size_t newCapacity = (oldCapacity > 0) ? oldCapacity : MIN_CAPACITY;
+    while (newCapacity < minCapacity) {
+        if (newCapacity > (SIZE_MAX / 2)) {
+            // Can't be allocated
+            return -1;
+        }
+        newCapacity *= 2;
+    }
+    if (newCapacity > (SIZE_MAX / elementSize)) {
+        // Can't be allocated
+        return -1;
+    }
+
+    unsigned char *buffer = (unsigned char*) allocatorRealloc(
+        &ringDeque->allocator, ringDeque->buffer, oldCapacity * elementSize,
+        newCapacity * elementSize);
+    if (buffer == NULL) {
+        // Out of memory
+        return -1;
+    }
+    ringDeque->buffer = buffer;
+    ringDeque->capacity = newCapacity;
+
+    if (ringDeque->head + ringDeque->size > oldCapacity) {
+        size_t frontPiece = oldCapacity - ringDeque->head;
+        size_t wrappedPiece = ringDeque->size - frontPiece;
+        if (frontPiece <= wrappedPiece) {
+            // Move the values from head on to the end of the new buffer
+            size_t newHead = newCapacity - frontPiece;
+            memcpy(buffer + (newHead * elementSize),
+                buffer + (ringDeque->head * elementSize),
+                frontPiece * elementSize);
+            ringDeque->head = newHead;
+        } else {
+            // Move the values that wrapped to just past the old end
+            memcpy(buffer + (oldCapacity * elementSize), buffer,
+                wrappedPiece * elementSize);
+        }
+    }
+
+    return 0;
+}
+
+/// @fn RingDeque* ringDequeCreate(int elementSize)
+///
+/// @brief Create an empty ring deque.
+///
+/// @param elementSize Number of bytes in each value.
+///
+/// @return Returns a pointer to the new RingDeque on success, NULL on failure.
+RingDeque* ringDequeCreate(int elementSize) {
+    return ringDequeCreateWithAllocator(elementSize, NULL);
+}
+
+/// @fn RingDeque* ringDequeCreateWithAllocator(int elementSize,
+///   const Allocator *allocator)
+///
+/// @brief Create an empty ring deque that gets all of its memory from a given
+/// allocator.
+///
+/// @param elementSize Number of bytes in each value.
+/// @param allocator The allocator to use, or NULL for malloc and free.  It is
+///   copied, so only its context has to outlive the deque.
+///
+/// @note No buffer is allocated until the first push or ringDequeReserve.
+///
+/// @return Returns a pointer to the new RingDeque on success, NULL on failure.
+RingDeque* ringDequeCreateWithAllocator(int elementSize,
+    const Allocator *allocator
+) {
+    if (elementSize <= 0) {
+        // We can't create a deque like this
+        return NULL;
+    }
+
+    Allocator dequeAllocator
+        = (allocator != NULL) ? *allocator : allocatorLibc();
+
+    RingDeque *ringDeque = (RingDeque*) allocatorCalloc(
+        &dequeAllocator, 1, sizeof(RingDeque));
+    if (ringDeque == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    ringDeque->elementSize = elementSize;
+    ringDeque->allocator = dequeAllocator;
+    // All other values are initialized to 0 by calloc
+
+    return ringDeque;
+}
+
+/// @fn RingDeque* ringDequeDestroy(RingDeque *ringDeque)
+///
+/// @brief Release all the memory held by a ring deque and its values.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+///
+/// @return This function always succeeds and always returns NULL.
+RingDeque* ringDequeDestroy(RingDeque *ringDeque) {
+    if (ringDeque != NULL) {
+        allocatorFree(&ringDeque->allocator, ringDeque->buffer,
+            ringDeque->capacity * (size_t) ringDeque->elementSize);
+        ringDeque->buffer = NULL;
+
+        // The allocator is about to be freed along with the deque
+        Allocator allocator = ringDeque->allocator;
+        allocatorFree(&allocator, ringDeque, sizeof(RingDeque));
+        ringDeque = NULL;
+    }
+
+    return NULL;
+}
+
+/// @fn int ringDequeReserve(RingDeque *ringDeque, size_t capacity)
+///
+/// @brief Make sure a ring deque can hold at least capacity values without
+/// growing.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param capacity The number of values to make room for.  It is rounded up
+///   to a power of two.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ringDequeReserve(RingDeque *ringDeque, size_t capacity) {
+    if (ringDeque == NULL) {
+        return -1;
+    }
+
+    return ringDequeGrow(ringDeque, capacity);
+}
+
+/// @fn int ringDequePushFront(RingDeque *ringDeque, const void *value)
+///
+/// @brief Insert a new value at the front of a ring deque.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param value A pointer to the elementSize bytes to copy to the front of the
+///   deque.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ringDequePushFront(RingDeque *ringDeque, const void *value) {
+    if ((ringDeque == NULL) || (value == NULL)) {
+        return -1;
+    } else if (ringDequeGrow(ringDeque, ringDeque->size + 1) != 0) {
+        return -1;
+    }
+
+    ringDeque->head = (ringDeque->head - 1) & (ringDeque->capacity - 1);
+    ringDequeCopyValue(ringDequeSlot(ringDeque, ringDeque->head), value,
+        ringDeque->elementSize);
+    ringDeque->size++;
+
+    return 0;
+}
+
+/// @fn int ringDequePushBack(RingDeque *ringDeque, const void *value)
+///
+/// @brief Insert a new value at the back of a ring deque.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param value A pointer to the elementSize bytes to copy to the back of the
+///   deque.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ringDequePushBack(RingDeque *ringDeque, const void *value) {
+    if ((ringDeque == NULL) || (value == NULL)) {
+        return -1;
+    } else if (ringDequeGrow(ringDeque, ringDeque->size + 1) != 0) {
+        return -1;
+    }
+
+    ringDequeCopyValue(
+        ringDequeSlot(ringDeque, ringDeque->head + ringDeque->size), value,
+        ringDeque->elementSize);
+    ringDeque->size++;
+
+    return 0;
+}
+
+/// @fn void* ringDequePeekFront(RingDeque *ringDeque)
+///
+/// @brief Get the value from the front of the deque if there is one.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+///
+/// @return Returns the value at the front of the deque on success, NULL on
+/// failure.
+void* ringDequePeekFront(RingDeque *ringDeque) {
+    return ringDequeAt(ringDeque, 0);
+}
+
+/// @fn void* ringDequePeekBack(RingDeque *ringDeque)
+///
+/// @brief Get the value from the back of the deque if there is one.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+///
+/// @return Returns the value at the back of the deque on success, NULL on
+/// failure.
+void* ringDequePeekBack(RingDeque *ringDeque) {
+    void *back = NULL;
+
+    if ((ringDeque != NULL) && (ringDeque->size > 0)) {
+        back = ringDequeAt(ringDeque, ringDeque->size - 1);
+    }
+
+    return back;
+}
+
+/// @fn void* ringDequeAt(RingDeque *ringDeque, size_t index)
+///
+/// @brief Get a value of the deque by its position.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param index The position of the value, counting from 0 at the front.
+///
+/// @note The pointer is only good until the next push, which may move the
+/// buffer.
+///
+/// @return Returns a pointer to the value on success, NULL if index is out of
+/// range.
+void* ringDequeAt(RingDeque *ringDeque, size_t index) {
+    void *value = NULL;
+
+    if ((ringDeque != NULL) && (index < ringDeque->size)) {
+        value = ringDequeSlot(ringDeque, ringDeque->head + index);
+    }
+
+    return value;
+}
+
+/// @fn int ringDequePopFront(RingDeque *ringDeque, void *value)
+///
+/// @brief Copy out the value from the front of the deque if there is one and
+/// remove it.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param value A pointer to an elementSize-byte buffer to copy the value
+///   into, or NULL to discard the value.
+///
+/// @return Returns 0 on success, -1 if the deque is empty.
+int ringDequePopFront(RingDeque *ringDeque, void *value) {
+    if ((ringDeque == NULL) || (ringDeque->size == 0)) {
+        return -1;
+    }
+
+    if (value != NULL) {
+        ringDequeCopyValue(value, ringDequeSlot(ringDeque, ringDeque->head),
+            ringDeque->elementSize);
+    }
+    ringDeque->head = (ringDeque->head + 1) & (ringDeque->capacity - 1);
+    ringDeque->size--;
+
+    return 0;
+}
+
+/// @fn int ringDequePopBack(RingDeque *ringDeque, void *value)
+///
+/// @brief Copy out the value from the back of the deque if there is one and
+/// remove it.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param value A pointer to an elementSize-byte buffer to copy the value
+///   into, or NULL to discard the value.
+///
+/// @return Returns 0 on success, -1 if the deque is empty.
+int ringDequePopBack(RingDeque *ringDeque, void *value) {
+    if ((ringDeque == NULL) || (ringDeque->size == 0)) {
+        return -1;
+    }
+
+    ringDeque->size--;
+    if (value != NULL) {
+        ringDequeCopyValue(value,
+            ringDequeSlot(ringDeque, ringDeque->head + ringDeque->size),
+            ringDeque->elementSize);
+    }
+
+    return 0;
+}
+
+// Batched RingDeque functions follow
+
+/// @fn int ringDequePushFrontMany(RingDeque *ringDeque, const void *values,
+///   size_t count)
+///
+/// @brief Insert several values at the front of a ring deque at once.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param values The count * elementSize bytes to insert.
+/// @param count The number of values to insert.
+///
+/// @note The values keep their order, so values[0] ends up at the front.
+///
+/// @return Returns 0 on success, -1 on failure.  The deque is unchanged on
+/// failure.
+int ringDequePushFrontMany(RingDeque *ringDeque, const void *values,
+    size_t count
+) {
+    if ((ringDeque == NULL) || ((values == NULL) && (count > 0))) {
+        return -1;
+    } else if (count == 0) {
+        return 0;
+    } else if ((count > SIZE_MAX - ringDeque->size)
+        || (ringDequeGrow(ringDeque, ringDeque->size + count) != 0)
+    ) {
+        return -1;
+    }
+
+    ringDeque->head = (ringDeque->head - count) & (ringDeque->capacity - 1);
+    ringDequeCopyIn(ringDeque, ringDeque->head, (const unsigned char*) values,
+        count);
+    ringDeque->size += count;
+
+    return 0;
+}
+
+/// @fn int ringDequePushBackMany(RingDeque *ringDeque, const void *values,
+///   size_t count)
+///
+/// @brief Insert several values at the back of a ring deque at once.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param values The count * elementSize bytes to insert.
+/// @param count The number of values to insert.
+///
+/// @note The values keep their order, so values[count - 1] ends up at the
+/// back.
+///
+/// @return Returns 0 on success, -1 on failure.  The deque is unchanged on
+/// failure.
+int ringDequePushBackMany(RingDeque *ringDeque, const void *values,
+    size_t count
+) {
+    if ((ringDeque == NULL) || ((values == NULL) && (count > 0))) {
+        return -1;
+    } else if (count == 0) {
+        return 0;
+    } else if ((count > SIZE_MAX - ringDeque->size)
+        || (ringDequeGrow(ringDeque, ringDeque->size + count) != 0)
+    ) {
+        return -1;
+    }
+
+    ringDequeCopyIn(ringDeque, ringDeque->head + ringDeque->size,
+        (const unsigned char*) values, count);
+    ringDeque->size += count;
+
+    return 0;
+}
+
+/// @fn size_t ringDequePopFrontMany(RingDeque *ringDeque, void *values,
+///   size_t count)
+///
+/// @brief Copy out and remove up to count values from the front of a ring
+/// deque.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param values A buffer of count * elementSize bytes to copy the values
+///   into in front-to-back order, or NULL to discard them.
+/// @param count The most values to pop.
+///
+/// @return Returns the number of values popped, which is less than count only
+/// if the deque ran out.
+size_t ringDequePopFrontMany(RingDeque *ringDeque, void *values,
+    size_t count
+) {
+    if (ringDeque == NULL) {
+        return 0;
+    }
+
+    if (count > ringDeque->size) {
+        count = ringDeque->size;
+    }
+    if ((values != NULL) && (count > 0)) {
+        ringDequeCopyOut(ringDeque, ringDeque->head, (unsigned char*) values,
+            count);
+    }
+    if (count > 0) {
+        ringDeque->head = (ringDeque->head + count) & (ringDeque->capacity - 1);
+        ringDeque->size -= count;
+    }
+
+    return count;
+}
+
+/// @fn size_t ringDequePopBackMany(RingDeque *ringDeque, void *values,
+///   size_t count)
+///
+/// @brief Copy out and remove up to count values from the back of a ring
+/// deque.
+///
+/// @param ringDeque A pointer to a previously-initialized RingDeque.
+/// @param values A buffer of count * elementSize bytes to copy the values
+///   into in front-to-back order, so the old back value comes last, or NULL to
+///   discard them.
+/// @param count The most values to pop.
+///
+/// @return Returns the number of values popped, which is less than count only
+/// if the deque ran out.
+size_t ringDequePopBackMany(RingDeque *ringDeque, void *values,
+    size_t count
+) {
+    if (ringDeque == NULL) {
+        return 0;
+    }
+
+    if (count > ringDeque->size) {
+        count = ringDeque->size;
+    }
+    ringDeque->size -= count;
+    if ((values != NULL) && (count > 0)) {
+        ringDequeCopyOut(ringDeque, ringDeque->head + ringDeque->size,
+            (unsigned char*) values, count);
+    }
+
+    return count;
+}
@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              RingDeque.h
+///
+/// @brief             Circular-buffer implementation of a deque in C.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef RING_DEQUE_H
+#define RING_DEQUE_H
+
+// Standard C includes
+#include <stddef.h>
+
+#include "Allocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct RingDeque
+///
+/// @brief Base container for a double-ended queue kept in one circular
+/// buffer.  Values all have the same size and sit next to each other, so
+/// pushing and popping at either end never allocates once the buffer is big
+/// enough, and a queue or stack of them is a contiguous stream of memory.
+///
+/// @param buffer The capacity * elementSize bytes holding the values.
+/// @param capacity The number of values buffer can hold.  Always 0 or a power
+///   of two, so positions wrap with a mask instead of a division.
+/// @param head The slot of the value at the front.
+/// @param size Number of values in the deque.
+/// @param elementSize Number of bytes in each value.
+/// @param allocator Where the deque and its buffer get their memory.
+typedef struct RingDeque {
+    unsigned char *buffer;
+    size_t capacity;
+    size_t head;
+    size_t size;
+    int elementSize;
+    Allocator allocator;
+} RingDeque;
+
+// Base RingDeque prototypes
+RingDeque* ringDequeCreate(int elementSize);
+RingDeque* ringDequeCreateWithAllocator(int elementSize,
+    const Allocator *allocator);
+RingDeque* ringDequeDestroy(RingDeque *ringDeque);
+int ringDequeReserve(RingDeque *ringDeque, size_t capacity);
+int ringDequePushFront(RingDeque *ringDeque, const void *value);
+int ringDequePushBack(RingDeque *ringDeque, const void *value);
+void* ringDequePeekFront(RingDeque *ringDeque);
+void* ringDequePeekBack(RingDeque *ringDeque);
+void* ringDequeAt(RingDeque *ringDeque, size_t index);
+int ringDequePopFront(RingDeque *ringDeque, void *value);
+int ringDequePopBack(RingDeque *ringDeque, void *value);
+
+// Batched RingDeque prototypes
+int ringDequePushFrontMany(RingDeque *ringDeque, const void *values,
+    size_t count);
+int ringDequePushBackMany(RingDeque *ringDeque, const void *values,
+    size_t count);
+size_t ringDequePopFrontMany(RingDeque *ringDeque, void *values,
+    size_t count);
+size_t ringDequePopBackMany(RingDeque *ringDeque, void *values,
+    size_t count);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // RING_DEQUE_H
@@ -0,0 +1,504 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file SkipList.c
+///
+/// @brief Library implementation of the SkipList.
+///
+/// Every node is on level 0, which is an ordinary sorted singly-linked list.
+/// Each level above holds about a quarter of the nodes of the level below, so
+/// a search that runs along the top level and drops down whenever the next
+/// node would overshoot visits O(log n) nodes in expectation.
+///
+/// New nodes are linked in from the bottom level up and unlinked from the top
+/// down, so the list is well formed at every level after each single pointer
+/// write.  A concurrent version only has to make those writes atomic.
+
+// Standard C includes
+#include <stdlib.h>
+#include <string.h>
+
+#include "SkipList.h"
+
+/// @fn static int skipListRandomHeight(SkipList *skipList)
+///
+/// @brief Pick the height of a new node.
+///
+/// @note Each extra level is taken with probability 1/4.  Two random bits per
+/// level are plenty, so one xorshift64* draw covers every level.
+///
+/// @return Returns a height between 1 and SKIP_LIST_MAX_HEIGHT.
+static int skipListRandomHeight(SkipList *skipList) {
+    uint64_t x = skipList->randomState;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    skipList->randomState = x;
+    uint64_t bits = x * 0x2545F4914F6CDD1Dull;
+
+    int height = 1;
+    while ((height < SKIP_LIST_MAX_HEIGHT) && ((bits & 3) == 0)) {
+        height++;
+        bits >>= 2;
+    }
+
+    return height;
+}
+
+/// @fn static size_t skipListNodeBytes(int height, int size)
+///
+/// @brief Get the size of one node, tower and value included.
+static size_t skipListNodeBytes(int height, int size) {
+    return sizeof(SkipListNode) + ((size_t) height * sizeof(SkipListNode*))
+        + (size_t) size;
+}
+
+/// @fn static SkipListNode* skipListNodeCreate(SkipList *skipList,
+///   const void *value, int size, int height)
+///
+/// @brief Allocate a node with its tower and copy a value into it.
+///
+/// @return Returns a pointer to the new node on success, NULL on failure.
+static SkipListNode* skipListNodeCreate(SkipList *skipList,
+    const void *value, int size, int height
+) {
+    SkipListNode *node = (SkipListNode*) allocatorAlloc(&skipList->allocator,
+        skipListNodeBytes(height, size));
+    if (node == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    // The tower is pointers, so the value after it is pointer-aligned
+    node->value = (unsigned char*) &node->next[height];
+    node->size = size;
+    node->height = height;
+    for (int ii = 0; ii < height; ii++) {
+        node->next[ii] = NULL;
+    }
+    if (size > 0) {
+        memcpy(node->value, value, (size_t) size);
+    }
+
+    return node;
+}
+
+/// @fn static SkipListNode* skipListNodeDestroy(SkipList *skipList,
+///   SkipListNode *node)
+///
+/// @brief Free a node that is no longer linked into the list.
+///
+/// @return This function always succeeds and always returns NULL.
+static SkipListNode* skipListNodeDestroy(SkipList *skipList,
+    SkipListNode *node
+) {
+    allocatorFree(&skipList->allocator, node,
+        skipListNodeBytes(node->height, node->size));
+
+    return NULL;
+}
+
+/// @fn static SkipListNode* skipListFindBefore(SkipList *skipList,
+///   const void *value, int inclusive, SkipListNode **update)
+///
+/// @brief Find the last node on each level that comes before a value.
+///
+/// @param skipList A pointer to the SkipList to search.
+/// @param value The value to search for.
+/// @param inclusive If nonzero, nodes equal to value count as coming before
+///   it, so the search ends after them instead of before them.
+/// @param update If not NULL, set to the last node before value on each level
+///   currently in use.
+///
+/// @return Returns the last node before value on level 0, which is head if
+/// there isn't one.
+static SkipListNode* skipListFindBefore(SkipList *skipList,
+    const void *value, int inclusive, SkipListNode **update
+) {
+    SkipListNode *node = skipList->head;
+    for (int level = skipList->height - 1; level >= 0; level--) {
+        SkipListNode *next = node->next[level];
+        while (next != NULL) {
+            int comparison = skipList->compare(next->value, value);
+            if ((comparison > 0) || ((comparison == 0) && !inclusive)) {
+                break;
+            }
+            node = next;
+            next = node->next[level];
+        }
+        if (update != NULL) {
+            update[level] = node;
+        }
+    }
+
+    return node;
+}
+
+/// @fn SkipList* skipListCreate(int (*compare)(const void*, const void*))
+///
+/// @brief Create an empty skip list.
+///
+/// @param compare Function that compares two values.
+///
+/// @return Returns a pointer to the new SkipList on success, NULL on failure.
+SkipList* skipListCreate(int (*compare)(const void*, const void*)) {
+    return skipListCreateWithAllocator(compare, NULL);
+}
+
+/// @fn SkipList* skipListCreateWithAllocator(
+///   int (*compare)(const void*, const void*), const Allocator *allocator)
+///
+/// @brief Create an empty skip list that gets all of its memory from a given
+/// allocator.
+///
+/// @param compare Function that compares two values.
+/// @param allocator The allocator to use, or NULL for malloc and free.  It is
+///   copied, so only its context has to outlive the list.
+///
+/// @return Returns a pointer to the new SkipList on success, NULL on failure.
+SkipList* skipListCreateWithAllocator(
+    int (*compare)(const void*, const void*), const Allocator *allocator
+) {
+    if (compare == NULL) {
+        // We can't create a list like this
+        return NULL;
+    }
+
+    Allocator listAllocator
+        = (allocator != NULL) ? *allocator : allocatorLibc();
+
+    SkipList *skipList = (SkipList*) allocatorCalloc(
+        &listAllocator, 1, sizeof(SkipList));
+    if (skipList == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    skipList->compare = compare;
+    skipList->allocator = listAllocator;
+    skipList->height = 1;
+    // Any nonzero seed works.  Mixing in the address keeps two lists from
+    // building identical towers.
+    skipList->randomState = 0x9E3779B97F4A7C15ull
+        ^ ((uint64_t) (uintptr_t) skipList * 0xBF58476D1CE4E5B9ull);
+    if (skipList->randomState == 0) {
+        skipList->randomState = 1;
+    }
+
+    skipList->head = skipListNodeCreate(skipList, NULL, 0,
+        SKIP_LIST_MAX_HEIGHT);
+    if (skipList->head == NULL) {
+        allocatorFree(&listAllocator, skipList, sizeof(SkipList));
+        skipList = NULL;
+        return NULL;
+    }
+    // All other values are initialized to 0 by calloc
+
+    return skipList;
+}
+
+/// @fn SkipList* skipListDestroy(SkipList *skipList)
+///
+/// @brief Release all the memory held by a skip list and its values.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+///
+/// @return This function always succeeds and always returns NULL.
+SkipList* skipListDestroy(SkipList *skipList) {
+    if (skipList != NULL) {
+        SkipListNode *node = skipList->head;
+        while (node != NULL) {
+            SkipListNode *next = node->next[0];
+            node = skipListNodeDestroy(skipList, node);
+            node = next;
+        }
+        skipList->head = NULL;
+
+        // The allocator is about to be freed along with the list
+        Allocator allocator = skipList->allocator;
+        allocatorFree(&allocator, skipList, sizeof(SkipList));
+        skipList = NULL;
+    }
+
+    return NULL;
+}
+
+/// @fn int skipListInsert(SkipList *skipList, const void *value, int size)
+///
+/// @brief Insert a new value into a skip list in order.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+/// @param value A pointer to the value to copy into the list.
+/// @param size The number of bytes the value takes up.
+///
+/// @note A value equal to ones already in the list goes after them, so equal
+/// values come out in the order they went in.
+///
+/// @return Returns 0 on success, -1 on failure.
+int skipListInsert(SkipList *skipList, const void *value, int size) {
+    if ((skipList == NULL) || (value == NULL) || (size < 0)) {
+        // Nothing we can do
+        return -1;
+    }
+
+    SkipListNode *update[SKIP_LIST_MAX_HEIGHT];
+    skipListFindBefore(skipList, value, 1, update);
+
+    int height = skipListRandomHeight(skipList);
+    SkipListNode *node = skipListNodeCreate(skipList, value, size, height);
+    if (node == NULL) {
+        return -1;
+    }
+
+    for (int level = skipList->height; level < height; level++) {
+        update[level] = skipList->head;
+    }
+    if (height > skipList->height) {
+        skipList->height = height;
+    }
+
+    // Bottom up, so the node is reachable in order before it is a shortcut
+    for (int level = 0; level < height; level++) {
+        node->next[level] = update[level]->next[level];
+        update[level]->next[level] = node;
+    }
+    skipList->size++;
+
+    return 0;
+}
+
+/// @fn SkipListNode* skipListSearch(SkipList *skipList, const void *value)
+///
+/// @brief Search a skip list for a specific value.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+/// @param value A pointer to the value to search for.
+///
+/// @note When several nodes hold equal values, this returns the first of
+/// them.
+///
+/// @return Returns a pointer to the SkipListNode that contains the value on
+/// success, NULL on failure.
+SkipListNode* skipListSearch(SkipList *skipList, const void *value) {
+    SkipListNode *node = skipListLowerBound(skipList, value);
+    if ((node == NULL) || (skipList->compare(node->value, value) != 0)) {
+        // value not found
+        return NULL;
+    }
+
+    return node;
+}
+
+/// @fn int skipListRemoveValue(SkipList *skipList, const void *value)
+///
+/// @brief Remove the first node holding a value from a skip list.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+/// @param value A pointer to the value to remove.
+///
+/// @return Returns 0 on success, -1 if the value was not found.
+int skipListRemoveValue(SkipList *skipList, const void *value) {
+    if ((skipList == NULL) || (value == NULL)) {
+        return -1;
+    }
+
+    SkipListNode *update[SKIP_LIST_MAX_HEIGHT];
+    SkipListNode *node
+        = skipListFindBefore(skipList, value, 0, update)->next[0];
+    if ((node == NULL) || (skipList->compare(node->value, value) != 0)) {
+        // value not found
+        return -1;
+    }
+
+    // node is the first node at least as big as value on level 0, so it is
+    // also the first on every level it is linked into
+    for (int level = node->height - 1; level >= 0; level--) {
+        update[level]->next[level] = node->next[level];
+    }
+    while ((skipList->height > 1)
+        && (skipList->head->next[skipList->height - 1] == NULL)
+    ) {
+        skipList->height--;
+    }
+    node = skipListNodeDestroy(skipList, node);
+    skipList->size--;
+
+    return 0;
+}
+
+/// @fn void* skipListPeekFront(SkipList *skipList)
+///
+/// @brief Get the smallest value in the list if there is one.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+///
+/// @return Returns the value at the front of the list on success, NULL on
+/// failure.
+void* skipListPeekFront(SkipList *skipList) {
+    void *front = NULL;
+
+    SkipListNode *node = skipListFirst(skipList);
+    if (node != NULL) {
+        front = node->value;
+    }
+
+    return front;
+}
+
+/// @fn int skipListPopFront(SkipList *skipList, void *value, int size)
+///
+/// @brief Copy out the smallest value in the list if there is one and remove
+/// it.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+/// @param value A pointer to the buffer to copy the value into, or NULL to
+///   discard the value.
+/// @param size The number of bytes the buffer can hold.
+///
+/// @return Returns 0 on success, -1 if the list is empty or the value does not
+/// fit in the buffer.  The list is unchanged on failure.
+int skipListPopFront(SkipList *skipList, void *value, int size) {
+    SkipListNode *node = skipListFirst(skipList);
+    if (node == NULL) {
+        return -1;
+    }
+
+    if (value != NULL) {
+        if (size < node->size) {
+            return -1;
+        }
+        memcpy(value, node->value, (size_t) node->size);
+    }
+
+    // The first node comes straight after head on every level it is on
+    for (int level = node->height - 1; level >= 0; level--) {
+        skipList->head->next[level] = node->next[level];
+    }
+    while ((skipList->height > 1)
+        && (skipList->head->next[skipList->height - 1] == NULL)
+    ) {
+        skipList->height--;
+    }
+    node = skipListNodeDestroy(skipList, node);
+    skipList->size--;
+
+    return 0;
+}
+
+// Ordered traversal functions follow
+
+/// @fn SkipListNode* skipListFirst(SkipList *skipList)
+///
+/// @brief Get the node with the smallest value.  Follow next[0] from it to
+/// visit every node in order.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+///
+/// @return Returns a pointer to the first SkipListNode, NULL if the list is
+/// empty.
+SkipListNode* skipListFirst(SkipList *skipList) {
+    if (skipList == NULL) {
+        return NULL;
+    }
+
+    return skipList->head->next[0];
+}
+
+/// @fn SkipListNode* skipListLowerBound(SkipList *skipList,
+///   const void *value)
+///
+/// @brief Find the first node whose value is not less than a given value.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+/// @param value A pointer to the value to search for.
+///
+/// @return Returns a pointer to the SkipListNode, NULL if every value is less
+/// than value.
+SkipListNode* skipListLowerBound(SkipList *skipList, const void *value) {
+    if ((skipList == NULL) || (value == NULL)) {
+        return NULL;
+    }
+
+    return skipListFindBefore(skipList, value, 0, NULL)->next[0];
+}
+
+/// @fn SkipListNode* skipListUpperBound(SkipList *skipList,
+///   const void *value)
+///
+/// @brief Find the first node whose value is greater than a given value.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+/// @param value A pointer to the value to search for.
+///
+/// @return Returns a pointer to the SkipListNode, NULL if no value is greater
+/// than value.
+SkipListNode* skipListUpperBound(SkipList *skipList, const void *value) {
+    if ((skipList == NULL) || (value == NULL)) {
+        return NULL;
+    }
+
+    return skipListFindBefore(skipList, value, 1, NULL)->next[0];
+}
+
+/// @fn ptrdiff_t skipListForEachRange(SkipList *skipList, const void *low,
+///   const void *high,
+///   void (*visit)(const void *value, int size, void *context),
+///   void *context)
+///
+/// @brief Call a function on every value between two bounds, in order.
+///
+/// @param skipList A pointer to a previously-initialized SkipList.
+/// @param low The smallest value to visit, or NULL to start at the front.
+/// @param high The largest value to visit, or NULL to go to the end.
+/// @param visit The function to call on each value.
+/// @param context Passed through to visit.
+///
+/// @note Both bounds are inclusive.  Finding low is O(log n); after that each
+/// value costs one step along level 0.  visit must not change the list.
+///
+/// @return Returns the number of values visited on success, -1 on failure.
+ptrdiff_t skipListForEachRange(SkipList *skipList, const void *low,
+    const void *high, void (*visit)(const void *value, int size, void *context),
+    void *context
+) {
+    if ((skipList == NULL) || (visit == NULL)) {
+        return -1;
+    }
+
+    SkipListNode *node = (low != NULL)
+        ? skipListLowerBound(skipList, low) : skipListFirst(skipList);
+    ptrdiff_t visited = 0;
+    while ((node != NULL)
+        && ((high == NULL) || (skipList->compare(node->value, high) <= 0))
+    ) {
+        visit(node->value, node->size, context);
+        visited++;
+        node = node->next[0];
+    }
+
+    return visited;
+}
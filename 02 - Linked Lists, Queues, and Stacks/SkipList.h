@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              SkipList.h
+///
+/// @brief             Skip list implementation of an ordered container in C.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+// Standard C includes
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Allocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def SKIP_LIST_MAX_HEIGHT
+///
+/// @brief Most levels a SkipListNode can be linked into.  With each level
+/// holding a quarter of the nodes of the one below, 32 levels are plenty for
+/// any list that fits in memory.
+#define SKIP_LIST_MAX_HEIGHT 32
+
+/// @struct SkipListNode
+///
+/// @brief Individual node of a skip list.  The node, its tower of next
+/// pointers and its value are one allocation.
+///
+/// @param value The value that is at this node, stored inline directly after
+///   the tower.
+/// @param size The number of bytes in value.
+/// @param height The number of levels the node is linked into.
+/// @param next The node's tower.  next[ii] is the next node on level ii, and
+///   next[0] is the next node in order.
+typedef struct SkipListNode {
+    unsigned char *value;
+    int size;
+    int height;
+    struct SkipListNode *next[];
+} SkipListNode;
+
+/// @struct SkipList
+///
+/// @brief Base container for a skip list, which keeps its values in the order
+/// given by its compare function.
+///
+/// @param compare Function pointer to the function that will compare two values
+///   in the list.
+/// @param head A node with no value and a full-height tower that every level
+///   starts from.  head->next[0] is the first node in order.
+/// @param height The number of levels currently in use.
+/// @param size Number of elements in the list.
+/// @param randomState State of the generator that picks node heights.
+/// @param allocator Where the list and its nodes get their memory.
+typedef struct SkipList {
+    int (*compare)(const void*, const void*);
+    SkipListNode *head;
+    int height;
+    int size;
+    uint64_t randomState;
+    Allocator allocator;
+} SkipList;
+
+// Base SkipList prototypes
+SkipList* skipListCreate(int (*compare)(const void*, const void*));
+SkipList* skipListCreateWithAllocator(
+    int (*compare)(const void*, const void*), const Allocator *allocator);
+SkipList* skipListDestroy(SkipList *skipList);
+int skipListInsert(SkipList *skipList, const void *value, int size);
+SkipListNode* skipListSearch(SkipList *skipList, const void *value);
+int skipListRemoveValue(SkipList *skipList, const void *value);
+void* skipListPeekFront(SkipList *skipList);
+int skipListPopFront(SkipList *skipList, void *value, int size);
+
+// Ordered traversal prototypes
+SkipListNode* skipListFirst(SkipList *skipList);
+SkipListNode* skipListLowerBound(SkipList *skipList, const void *value);
+SkipListNode* skipListUpperBound(SkipList *skipList, const void *value);
+ptrdiff_t skipListForEachRange(SkipList *skipList, const void *low,
+    const void *high, void (*visit)(const void *value, int size, void *context),
+    void *context);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // SKIP_LIST_H
@@ -0,0 +1,669 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file UnrolledList.c
+///
+/// @brief Library implementation of the UnrolledList.
+
+// Standard C includes
+#include <stdlib.h>
+#include <string.h>
+
+#include "UnrolledList.h"
+
+/// @def UNROLLED_BLOCK_BYTES
+///
+/// @brief Size each UnrolledBlock aims for, header included.  A few cache
+/// lines per block keeps scans streaming through memory.
+#define UNROLLED_BLOCK_BYTES 512
+
+/// @def MIN_BLOCK_CAPACITY
+///
+/// @brief Fewest values an UnrolledBlock holds, no matter how big they are.
+#define MIN_BLOCK_CAPACITY 4
+
+// UnrolledBlock functions follow
+
+/// @fn static unsigned char* unrolledBlockValue(
+///   const UnrolledList *unrolledList, UnrolledBlock *block, int index)
+///
+/// @brief Get a pointer to a value of a block.
+///
+/// @param unrolledList A pointer to the UnrolledList the block is in.
+/// @param block A pointer to the UnrolledBlock.
+/// @param index Which value of the block to get, counting from its first.
+///
+/// @return Returns a pointer to the value.
+static unsigned char* unrolledBlockValue(const UnrolledList *unrolledList,
+    UnrolledBlock *block, int index
+) {
+    return block->values
+        + ((size_t) (block->first + index)
+        * (size_t) unrolledList->elementSize);
+}
+
+/// @fn static size_t unrolledBlockBytes(const UnrolledList *unrolledList)
+///
+/// @brief Get the size of one block of an unrolled list, header included.
+static size_t unrolledBlockBytes(const UnrolledList *unrolledList) {
+    return sizeof(UnrolledBlock) + ((size_t) unrolledList->blockCapacity
+        * (size_t) unrolledList->elementSize);
+}
+
+/// @fn static UnrolledBlock* unrolledBlockCreate(UnrolledList *unrolledList,
+///   int first)
+///
+/// @brief Get an empty block, reusing the list's spare if it has one.
+///
+/// @param unrolledList A pointer to the UnrolledList the block is for.
+/// @param first The slot the block's first value will go in.
+///
+/// @return Returns a pointer to an empty UnrolledBlock on success, NULL on
+/// failure.
+static UnrolledBlock* unrolledBlockCreate(UnrolledList *unrolledList,
+    int first
+) {
+    UnrolledBlock *block = unrolledList->spare;
+    if (block != NULL) {
+        unrolledList->spare = NULL;
+    } else {
+        block = (UnrolledBlock*) allocatorAlloc(&unrolledList->allocator,
+            unrolledBlockBytes(unrolledList));
+        if (block == NULL) {
+            // Out of memory
+            return NULL;
+        }
+    }
+
+    block->next = NULL;
+    block->prev = NULL;
+    block->first = first;
+    block->count = 0;
+
+    return block;
+}
+
+/// @fn static void unrolledBlockDestroy(UnrolledList *unrolledList,
+///   UnrolledBlock *block)
+///
+/// @brief Unlink a block from its list and either keep it as the spare or
+/// free it.
+///
+/// @param unrolledList A pointer to the UnrolledList the block is in.
+/// @param block A pointer to the UnrolledBlock to get rid of.
+static void unrolledBlockDestroy(UnrolledList *unrolledList,
+    UnrolledBlock *block
+) {
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    } else {
+        unrolledList->head = block->next;
+    }
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    } else {
+        unrolledList->tail = block->prev;
+    }
+
+    if (unrolledList->spare == NULL) {
+        unrolledList->spare = block;
+    } else {
+        allocatorFree(&unrolledList->allocator, block,
+            unrolledBlockBytes(unrolledList));
+        block = NULL;
+    }
+}
+
+/// @fn static void unrolledBlockMerge(UnrolledList *unrolledList,
+///   UnrolledBlock *block)
+///
+/// @brief Move all the values of the block after this one onto the end of
+/// this one and get rid of the emptied block.
+///
+/// @param unrolledList A pointer to the UnrolledList the blocks are in.
+/// @param block A pointer to an UnrolledBlock with room for all the values of
+///   the block after it.
+static void unrolledBlockMerge(UnrolledList *unrolledList,
+    UnrolledBlock *block
+) {
+    UnrolledBlock *next = block->next;
+    size_t elementSize = (size_t) unrolledList->elementSize;
+
+    // Pack this block's values at the start so the others fit after them
+    memmove(block->values, unrolledBlockValue(unrolledList, block, 0),
+        (size_t) block->count * elementSize);
+    block->first = 0;
+    memcpy(unrolledBlockValue(unrolledList, block, block->count),
+        unrolledBlockValue(unrolledList, next, 0),
+        (size_t) next->count * elementSize);
+    block->count += next->count;
+
+    unrolledBlockDestroy(unrolledList, next);
+}
+
+/// @fn static int unrolledBlockSplit(UnrolledList *unrolledList,
+///   UnrolledBlock *block)
+///
+/// @brief Move the back half of the values of a block into a new block right
+/// after it.
+///
+/// @param unrolledList A pointer to the UnrolledList the block is in.
+/// @param block A pointer to the UnrolledBlock to split.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int unrolledBlockSplit(UnrolledList *unrolledList,
+    UnrolledBlock *block
+) {
+    UnrolledBlock *next = unrolledBlockCreate(unrolledList, 0);
+    if (next == NULL) {
+        return -1;
+    }
+
+    int keep = block->count / 2;
+    next->count = block->count - keep;
+    memcpy(next->values, unrolledBlockValue(unrolledList, block, keep),
+        (size_t) next->count * (size_t) unrolledList->elementSize);
+    block->count = keep;
+
+    next->prev = block;
+    next->next = block->next;
+    if (block->next != NULL) {
+        block->next->prev = next;
+    } else {
+        unrolledList->tail = next;
+    }
+    block->next = next;
+
+    return 0;
+}
+
+// UnrolledList functions follow
+
+/// @fn UnrolledList* unrolledListCreate(
+///   int (*compare)(const void*, const void*), int elementSize)
+///
+/// @brief Create an empty unrolled list.
+///
+/// @param compare Function that compares two values.
+/// @param elementSize Number of bytes in each value.
+///
+/// @return Returns a pointer to the new UnrolledList on success, NULL on
+/// failure.
+UnrolledList* unrolledListCreate(int (*compare)(const void*, const void*),
+    int elementSize
+) {
+    return unrolledListCreateWithAllocator(compare, elementSize, NULL);
+}
+
+/// @fn UnrolledList* unrolledListCreateWithAllocator(
+///   int (*compare)(const void*, const void*), int elementSize,
+///   const Allocator *allocator)
+///
+/// @brief Create an empty unrolled list that gets all of its memory from a
+/// given allocator.
+///
+/// @param compare Function that compares two values.
+/// @param elementSize Number of bytes in each value.
+/// @param allocator The allocator to use, or NULL for malloc and free.  It is
+///   copied, so only its context has to outlive the list.
+///
+/// @return Returns a pointer to the new UnrolledList on success, NULL on
+/// failure.
+UnrolledList* unrolledListCreateWithAllocator(
+    int (*compare)(const void*, const void*), int elementSize,
+    const Allocator *allocator
+) {
+    if ((compare == NULL) || (elementSize <= 0)) {
+        // We can't create a list like this
+        return NULL;
+    }
+
+    Allocator listAllocator
+        = (allocator != NULL) ? *allocator : allocatorLibc();
+
+    UnrolledList *unrolledList = (UnrolledList*) allocatorCalloc(
+        &listAllocator, 1, sizeof(UnrolledList));
+    if (unrolledList == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    unrolledList->compare = compare;
+    unrolledList->allocator = listAllocator;
+    unrolledList->elementSize = elementSize;
+    unrolledList->blockCapacity = (int) ((UNROLLED_BLOCK_BYTES
+        - sizeof(UnrolledBlock)) / (size_t) elementSize);
+    if (unrolledList->blockCapacity < MIN_BLOCK_CAPACITY) {
+        unrolledList->blockCapacity = MIN_BLOCK_CAPACITY;
+    }
+    // All other values are initialized to 0 by calloc
+
+    return unrolledList;
+}
+
+/// @fn UnrolledList* unrolledListDestroy(UnrolledList *unrolledList)
+///
+/// @brief Release all the memory held by an unrolled list and its values.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+///
+/// @return This function always succeeds and always returns NULL.
+UnrolledList* unrolledListDestroy(UnrolledList *unrolledList) {
+    if (unrolledList != NULL) {
+        size_t blockBytes = unrolledBlockBytes(unrolledList);
+        UnrolledBlock *block = unrolledList->head;
+        while (block != NULL) {
+            UnrolledBlock *next = block->next;
+            allocatorFree(&unrolledList->allocator, block, blockBytes);
+            block = next;
+        }
+        allocatorFree(&unrolledList->allocator, unrolledList->spare,
+            blockBytes);
+        unrolledList->spare = NULL;
+
+        // The allocator is about to be freed along with the list
+        Allocator allocator = unrolledList->allocator;
+        allocatorFree(&allocator, unrolledList, sizeof(UnrolledList));
+        unrolledList = NULL;
+    }
+
+    return NULL;
+}
+
+/// @fn int unrolledListInsertFront(UnrolledList *unrolledList,
+///   const void *value)
+///
+/// @brief Insert a new value at the front of an unrolled list.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+/// @param value A pointer to the elementSize bytes to copy to the front of the
+///   list.
+///
+/// @return Returns 0 on success, -1 on failure.
+int unrolledListInsertFront(UnrolledList *unrolledList, const void *value) {
+    if ((unrolledList == NULL) || (value == NULL)) {
+        // Nothing we can do
+        return -1;
+    }
+
+    UnrolledBlock *block = unrolledList->head;
+    if ((block == NULL) || (block->count == unrolledList->blockCapacity)) {
+        // Start a new block that fills from its end toward the front
+        block = unrolledBlockCreate(unrolledList, unrolledList->blockCapacity);
+        if (block == NULL) {
+            return -1;
+        }
+        block->next = unrolledList->head;
+        if (unrolledList->head != NULL) {
+            unrolledList->head->prev = block;
+        } else {
+            unrolledList->tail = block;
+        }
+        unrolledList->head = block;
+    } else if (block->first == 0) {
+        // The free slots are all at the back.  Slide the values down to them.
+        int shift = unrolledList->blockCapacity - block->count;
+        memmove(unrolledBlockValue(unrolledList, block, shift),
+            unrolledBlockValue(unrolledList, block, 0),
+            (size_t) block->count * (size_t) unrolledList->elementSize);
+        block->first = shift;
+    }
+
+    block->first--;
+    block->count++;
+    memcpy(unrolledBlockValue(unrolledList, block, 0), value,
+        (size_t) unrolledList->elementSize);
+    unrolledList->size++;
+
+    return 0;
+}
+
+/// @fn int unrolledListInsertBack(UnrolledList *unrolledList,
+///   const void *value)
+///
+/// @brief Insert a new value at the back of an unrolled list.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+/// @param value A pointer to the elementSize bytes to copy to the back of the
+///   list.
+///
+/// @return Returns 0 on success, -1 on failure.
+int unrolledListInsertBack(UnrolledList *unrolledList, const void *value) {
+    if ((unrolledList == NULL) || (value == NULL)) {
+        // Nothing we can do
+        return -1;
+    }
+
+    UnrolledBlock *block = unrolledList->tail;
+    if ((block == NULL) || (block->count == unrolledList->blockCapacity)) {
+        // Start a new block that fills from its front toward the end
+        block = unrolledBlockCreate(unrolledList, 0);
+        if (block == NULL) {
+            return -1;
+        }
+        block->prev = unrolledList->tail;
+        if (unrolledList->tail != NULL) {
+            unrolledList->tail->next = block;
+        } else {
+            unrolledList->head = block;
+        }
+        unrolledList->tail = block;
+    } else if (block->first + block->count == unrolledList->blockCapacity) {
+        // The free slots are all at the front.  Slide the values up to them.
+        memmove(block->values, unrolledBlockValue(unrolledList, block, 0),
+            (size_t) block->count * (size_t) unrolledList->elementSize);
+        block->first = 0;
+    }
+
+    memcpy(unrolledBlockValue(unrolledList, block, block->count), value,
+        (size_t) unrolledList->elementSize);
+    block->count++;
+    unrolledList->size++;
+
+    return 0;
+}
+
+/// @fn int unrolledListInsertAt(UnrolledList *unrolledList, int index,
+///   const void *value)
+///
+/// @brief Insert a new value so that it ends up at a given position in an
+/// unrolled list.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+/// @param index The position the value should have, from 0 for the front to
+///   the size of the list for the back.
+/// @param value A pointer to the elementSize bytes to copy into the list.
+///
+/// @note Finding the position walks one block header per blockCapacity
+/// values.  A full block is split in two first, so an insert moves at most
+/// one block's worth of values.
+///
+/// @return Returns 0 on success, -1 on failure.
+int unrolledListInsertAt(UnrolledList *unrolledList, int index,
+    const void *value
+) {
+    if ((unrolledList == NULL) || (value == NULL) || (index < 0)
+        || (index > unrolledList->size)
+    ) {
+        // Nothing we can do
+        return -1;
+    } else if (index == unrolledList->size) {
+        return unrolledListInsertBack(unrolledList, value);
+    } else if (index == 0) {
+        return unrolledListInsertFront(unrolledList, value);
+    }
+
+    UnrolledBlock *block = unrolledList->head;
+    while (index >= block->count) {
+        index -= block->count;
+        block = block->next;
+    }
+
+    if (block->count == unrolledList->blockCapacity) {
+        if (unrolledBlockSplit(unrolledList, block) != 0) {
+            // Out of memory
+            return -1;
+        }
+        if (index > block->count) {
+            index -= block->count;
+            block = block->next;
+        }
+    }
+
+    size_t elementSize = (size_t) unrolledList->elementSize;
+    int roomAtBack = unrolledList->blockCapacity - block->first - block->count;
+    // Open the gap from whichever side has fewer values to move
+    if ((block->first > 0)
+        && ((index < block->count / 2) || (roomAtBack == 0))
+    ) {
+        memmove(unrolledBlockValue(unrolledList, block, -1),
+            unrolledBlockValue(unrolledList, block, 0),
+            (size_t) index * elementSize);
+        block->first--;
+    } else {
+        memmove(unrolledBlockValue(unrolledList, block, index + 1),
+            unrolledBlockValue(unrolledList, block, index),
+            (size_t) (block->count - index) * elementSize);
+    }
+
+    memcpy(unrolledBlockValue(unrolledList, block, index), value, elementSize);
+    block->count++;
+    unrolledList->size++;
+
+    return 0;
+}
+
+/// @fn static int unrolledListFind(UnrolledList *unrolledList,
+///   const void *value, UnrolledBlock **block)
+///
+/// @brief Find the first matching value in an unrolled list.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+/// @param value A pointer to the value to search for.
+/// @param block Where to store a pointer to the block the value is in.
+///
+/// @return Returns the index of the value within its block on success, -1 on
+/// failure.
+static int unrolledListFind(UnrolledList *unrolledList, const void *value,
+    UnrolledBlock **block
+) {
+    size_t elementSize = (size_t) unrolledList->elementSize;
+    for (UnrolledBlock *cur = unrolledList->head; cur != NULL;
+        cur = cur->next
+    ) {
+        unsigned char *curValue = unrolledBlockValue(unrolledList, cur, 0);
+        for (int ii = 0; ii < cur->count; ii++, curValue += elementSize) {
+            if (unrolledList->compare(curValue, value) == 0) {
+                *block = cur;
+                return ii;
+            }
+        }
+    }
+
+    return -1;
+}
+
+/// @fn void* unrolledListSearch(UnrolledList *unrolledList,
+///   const void *value)
+///
+/// @brief Search an unrolled list for a value.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+/// @param value A pointer to the value to search for.
+///
+/// @return Returns a pointer to the first matching value in the list on
+/// success, NULL on failure.  The pointer is only valid until the list is next
+/// changed.
+void* unrolledListSearch(UnrolledList *unrolledList, const void *value) {
+    if (unrolledList == NULL) {
+        // Nothing we can do
+        return NULL;
+    }
+
+    UnrolledBlock *block = NULL;
+    int index = unrolledListFind(unrolledList, value, &block);
+    if (index < 0) {
+        return NULL;
+    }
+
+    return unrolledBlockValue(unrolledList, block, index);
+}
+
+/// @fn int unrolledListRemoveValue(UnrolledList *unrolledList,
+///   const void *value)
+///
+/// @brief Remove the first matching value from an unrolled list.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+/// @param value A pointer to the value to remove.
+///
+/// @note A block left less than half full is merged with a neighbor when
+/// their values fit in one block, so blocks stay dense as values are removed.
+///
+/// @return Returns 0 on success, -1 on failure.
+int unrolledListRemoveValue(UnrolledList *unrolledList, const void *value) {
+    if (unrolledList == NULL) {
+        // Nothing we can do
+        return -1;
+    }
+
+    UnrolledBlock *block = NULL;
+    int index = unrolledListFind(unrolledList, value, &block);
+    if (index < 0) {
+        // Can't remove a value we didn't find
+        return -1;
+    }
+
+    size_t elementSize = (size_t) unrolledList->elementSize;
+    // Close the gap from whichever side has fewer values to move
+    if (index < block->count / 2) {
+        memmove(unrolledBlockValue(unrolledList, block, 1),
+            unrolledBlockValue(unrolledList, block, 0),
+            (size_t) index * elementSize);
+        block->first++;
+    } else {
+        memmove(unrolledBlockValue(unrolledList, block, index),
+            unrolledBlockValue(unrolledList, block, index + 1),
+            (size_t) (block->count - index - 1) * elementSize);
+    }
+    block->count--;
+    unrolledList->size--;
+
+    if (block->count == 0) {
+        unrolledBlockDestroy(unrolledList, block);
+    } else if (block->count < unrolledList->blockCapacity / 2) {
+        if ((block->next != NULL) && (block->count + block->next->count
+            <= unrolledList->blockCapacity)
+        ) {
+            unrolledBlockMerge(unrolledList, block);
+        } else if ((block->prev != NULL) && (block->prev->count + block->count
+            <= unrolledList->blockCapacity)
+        ) {
+            unrolledBlockMerge(unrolledList, block->prev);
+        }
+    }
+
+    return 0;
+}
+
+/// @fn void* unrolledListPeekFront(UnrolledList *unrolledList)
+///
+/// @brief Get the value from the front of the list if there is one.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+///
+/// @return Returns the value at the front of the list on success, NULL on
+/// failure.
+void* unrolledListPeekFront(UnrolledList *unrolledList) {
+    void *front = NULL;
+
+    if ((unrolledList != NULL) && (unrolledList->head != NULL)) {
+        front = unrolledBlockValue(unrolledList, unrolledList->head, 0);
+    }
+
+    return front;
+}
+
+/// @fn void* unrolledListPeekBack(UnrolledList *unrolledList)
+///
+/// @brief Get the value from the back of the list if there is one.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+///
+/// @return Returns the value at the back of the list on success, NULL on
+/// failure.
+void* unrolledListPeekBack(UnrolledList *unrolledList) {
+    void *back = NULL;
+
+    if ((unrolledList != NULL) && (unrolledList->tail != NULL)) {
+        back = unrolledBlockValue(unrolledList, unrolledList->tail,
+            unrolledList->tail->count - 1);
+    }
+
+    return back;
+}
+
+/// @fn int unrolledListPopFront(UnrolledList *unrolledList, void *value)
+///
+/// @brief Copy out the value from the front of the list if there is one and
+/// remove it.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+/// @param value A pointer to an elementSize-byte buffer to copy the value
+///   into, or NULL to discard the value.
+///
+/// @return Returns 0 on success, -1 if the list is empty.
+int unrolledListPopFront(UnrolledList *unrolledList, void *value) {
+    if ((unrolledList == NULL) || (unrolledList->head == NULL)) {
+        return -1;
+    }
+
+    UnrolledBlock *block = unrolledList->head;
+    if (value != NULL) {
+        memcpy(value, unrolledBlockValue(unrolledList, block, 0),
+            (size_t) unrolledList->elementSize);
+    }
+    block->first++;
+    block->count--;
+    unrolledList->size--;
+
+    if (block->count == 0) {
+        unrolledBlockDestroy(unrolledList, block);
+    }
+
+    return 0;
+}
+
+/// @fn int unrolledListPopBack(UnrolledList *unrolledList, void *value)
+///
+/// @brief Copy out the value from the back of the list if there is one and
+/// remove it.
+///
+/// @param unrolledList A pointer to a previously-initialized UnrolledList.
+/// @param value A pointer to an elementSize-byte buffer to copy the value
+///   into, or NULL to discard the value.
+///
+/// @return Returns 0 on success, -1 if the list is empty.
+int unrolledListPopBack(UnrolledList *unrolledList, void *value) {
+    if ((unrolledList == NULL) || (unrolledList->tail == NULL)) {
+        return -1;
+    }
+
+    UnrolledBlock *block = unrolledList->tail;
+    if (value != NULL) {
+        memcpy(value, unrolledBlockValue(unrolledList, block, block->count - 1),
+            (size_t) unrolledList->elementSize);
+    }
+    block->count--;
+    unrolledList->size--;
+
+    if (block->count == 0) {
+        unrolledBlockDestroy(unrolledList, block);
+    }
+
+    return 0;
+}
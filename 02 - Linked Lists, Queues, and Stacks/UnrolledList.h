@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              UnrolledList.h
+///
+/// @brief             Unrolled linked list implementation in C.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include "Allocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct UnrolledBlock
+///
+/// @brief One node of an unrolled list, holding a run of values inline.
+///
+/// @param next Pointer to the next UnrolledBlock in the list.
+/// @param prev Pointer to the previous UnrolledBlock in the list.
+/// @param first Slot of the first value in use.  Values occupy slots first
+///   through first + count - 1, so either end can grow without moving the
+///   others.
+/// @param count Number of values in the block.
+/// @param values Storage for the list's blockCapacity values.
+typedef struct UnrolledBlock {
+    struct UnrolledBlock *next;
+    struct UnrolledBlock *prev;
+    int first;
+    int count;
+    unsigned char values[];
+} UnrolledBlock;
+
+/// @struct UnrolledList
+///
+/// @brief Base container for an unrolled linked list.  Values all have the
+/// same size and are stored many to a block, so walking the list touches one
+/// block header per run of values instead of one node per value.
+///
+/// @param compare Function pointer to the function that will compare two values
+///   in the list.
+/// @param elementSize Number of bytes in each value.
+/// @param blockCapacity Most values one UnrolledBlock can hold.
+/// @param head Pointer to the first UnrolledBlock in the list.
+/// @param tail Pointer to the last UnrolledBlock in the list.
+/// @param spare An empty block kept back from the last time one emptied, so
+///   pushing and popping across a block boundary doesn't allocate every time.
+/// @param size Number of elements in the list.
+/// @param allocator Where the list and its blocks get their memory.
+typedef struct UnrolledList {
+    int (*compare)(const void*, const void*);
+    int elementSize;
+    int blockCapacity;
+    UnrolledBlock *head;
+    UnrolledBlock *tail;
+    UnrolledBlock *spare;
+    int size;
+    Allocator allocator;
+} UnrolledList;
+
+// Base UnrolledList prototypes
+UnrolledList* unrolledListCreate(int (*compare)(const void*, const void*),
+    int elementSize);
+UnrolledList* unrolledListCreateWithAllocator(
+    int (*compare)(const void*, const void*), int elementSize,
+    const Allocator *allocator);
+UnrolledList* unrolledListDestroy(UnrolledList *unrolledList);
+int unrolledListInsertFront(UnrolledList *unrolledList, const void *value);
+int unrolledListInsertBack(UnrolledList *unrolledList, const void *value);
+int unrolledListInsertAt(UnrolledList *unrolledList, int index,
+    const void *value);
+void* unrolledListSearch(UnrolledList *unrolledList, const void *value);
+int unrolledListRemoveValue(UnrolledList *unrolledList, const void *value);
+void* unrolledListPeekFront(UnrolledList *unrolledList);
+void* unrolledListPeekBack(UnrolledList *unrolledList);
+int unrolledListPopFront(UnrolledList *unrolledList, void *value);
+int unrolledListPopBack(UnrolledList *unrolledList, void *value);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // UNROLLED_LIST_H
@@ -0,0 +1,277 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file WorkStealingBenchmark.c
+///
+/// @brief A small work-stealing thread pool built on WorkStealingDeque, and a
+/// benchmark of how often its workers steal under load.
+///
+/// Usage:  WorkStealingBenchmark [maxThreads] [treeDepth] [workPerTask]
+///
+/// The pool runs a binary tree of tasks:  every task spins for workPerTask
+/// iterations and then, unless it is a leaf, spawns two children onto its own
+/// worker's deque.  The whole tree starts on worker 0, so every other worker
+/// only gets anything to do by stealing.  The run is repeated for every worker
+/// count from 1 up to maxThreads, doubling each time.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "WorkStealingDeque.h"
+
+/// @def DEFAULT_TREE_DEPTH
+///
+/// @brief Depth of the task tree when not given on the command line.
+#define DEFAULT_TREE_DEPTH 20
+
+/// @def DEFAULT_WORK_PER_TASK
+///
+/// @brief Spin iterations per task when not given on the command line.
+#define DEFAULT_WORK_PER_TASK 200
+
+struct ThreadPool;
+
+/// @struct Worker
+///
+/// @brief One thread of the pool, its deque and its counters.
+typedef struct Worker {
+    WorkStealingDeque *deque;
+    struct ThreadPool *threadPool;
+    pthread_t thread;
+    unsigned int seed;
+    long long executed;
+    long long steals;
+    long long stealAttempts;
+    long long aborts;
+} Worker;
+
+/// @struct ThreadPool
+///
+/// @brief The workers and the count of tasks that have not finished yet.
+typedef struct ThreadPool {
+    Worker *workers;
+    int numWorkers;
+    long workPerTask;
+    atomic_llong pending;
+} ThreadPool;
+
+// Tasks are just their depth in the tree, stored in the pointer itself so
+// that spawning one doesn't have to allocate.  One is added so that a leaf
+// isn't NULL.
+
+static void* taskFromDepth(int depth) {
+    return (void*) (uintptr_t) (depth + 1);
+}
+
+static int depthFromTask(void *task) {
+    return (int) (uintptr_t) task - 1;
+}
+
+static double nowSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + ((double) now.tv_nsec * 1e-9);
+}
+
+/// @fn static void runTask(Worker *worker, void *task)
+///
+/// @brief Do a task's work and spawn its children onto the worker's deque.
+static void runTask(Worker *worker, void *task) {
+    volatile long sink = 0;
+    for (long ii = 0; ii < worker->threadPool->workPerTask; ii++) {
+        sink += ii;
+    }
+
+    int depth = depthFromTask(task);
+    if (depth > 0) {
+        // Count the children before they can run, so pending can't reach 0
+        // while there is still work about to appear
+        atomic_fetch_add(&worker->threadPool->pending, 2);
+        for (int child = 0; child < 2; child++) {
+            if (workStealingDequePushBack(worker->deque,
+                taskFromDepth(depth - 1)) != 0
+            ) {
+                // Out of memory.  Run the child here instead.
+                runTask(worker, taskFromDepth(depth - 1));
+            }
+        }
+    }
+
+    worker->executed++;
+    atomic_fetch_sub(&worker->threadPool->pending, 1);
+}
+
+/// @fn static void* workerMain(void *arg)
+///
+/// @brief Run tasks from the worker's own deque, stealing from a random other
+/// worker whenever it runs dry, until every task in the pool has finished.
+static void* workerMain(void *arg) {
+    Worker *worker = (Worker*) arg;
+    ThreadPool *threadPool = worker->threadPool;
+
+    while (atomic_load(&threadPool->pending) > 0) {
+        void *task = NULL;
+        if (workStealingDequePopBack(worker->deque, &task) == 0) {
+            runTask(worker, task);
+            continue;
+        }
+
+        if (threadPool->numWorkers == 1) {
+            continue;
+        }
+
+        int victim = rand_r(&worker->seed) % threadPool->numWorkers;
+        if (&threadPool->workers[victim] == worker) {
+            continue;
+        }
+
+        worker->stealAttempts++;
+        int status =
+            workStealingDequeSteal(threadPool->workers[victim].deque, &task);
+        if (status == 0) {
+            worker->steals++;
+            runTask(worker, task);
+        } else if (status == WSD_ABORT) {
+            worker->aborts++;
+        }
+    }
+
+    return NULL;
+}
+
+/// @fn static int runBenchmark(int numWorkers, int treeDepth,
+///   long workPerTask)
+///
+/// @brief Run the whole task tree on a pool of numWorkers and print the steal
+/// statistics.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int runBenchmark(int numWorkers, int treeDepth, long workPerTask) {
+    ThreadPool threadPool;
+    threadPool.numWorkers = numWorkers;
+    threadPool.workPerTask = workPerTask;
+    atomic_init(&threadPool.pending, 1);
+    threadPool.workers = (Worker*) calloc((size_t) numWorkers, sizeof(Worker));
+    if (threadPool.workers == NULL) {
+        printf("Error:  Could not allocate memory for workers!\n");
+        return -1;
+    }
+
+    int status = 0;
+    for (int ii = 0; ii < numWorkers; ii++) {
+        threadPool.workers[ii].threadPool = &threadPool;
+        threadPool.workers[ii].seed = (unsigned int) ii + 1;
+        threadPool.workers[ii].deque = workStealingDequeCreate();
+        if (threadPool.workers[ii].deque == NULL) {
+            printf("Error:  Could not create a deque!\n");
+            status = -1;
+        }
+    }
+
+    if (status == 0) {
+        // Seed worker 0 before its thread exists.  pthread_create makes the
+        // push visible to it, so this doesn't break the owner-only rule.
+        workStealingDequePushBack(threadPool.workers[0].deque,
+            taskFromDepth(treeDepth));
+
+        double start = nowSeconds();
+        for (int ii = 0; ii < numWorkers; ii++) {
+            pthread_create(&threadPool.workers[ii].thread, NULL, workerMain,
+                &threadPool.workers[ii]);
+        }
+        for (int ii = 0; ii < numWorkers; ii++) {
+            pthread_join(threadPool.workers[ii].thread, NULL);
+        }
+        double elapsed = nowSeconds() - start;
+
+        long long executed = 0;
+        long long steals = 0;
+        long long stealAttempts = 0;
+        long long aborts = 0;
+        for (int ii = 0; ii < numWorkers; ii++) {
+            executed += threadPool.workers[ii].executed;
+            steals += threadPool.workers[ii].steals;
+            stealAttempts += threadPool.workers[ii].stealAttempts;
+            aborts += threadPool.workers[ii].aborts;
+        }
+
+        long long expected = (2LL << treeDepth) - 1;
+        printf("%4d workers %10.3f s %10.2f Mtasks/s %10lld steals "
+            "%10lld attempts %8lld aborts %12.0f steals/s%s\n",
+            numWorkers, elapsed, (double) executed / elapsed / 1e6,
+            steals, stealAttempts, aborts, (double) steals / elapsed,
+            (executed == expected) ? "" : "  (MISMATCH!)");
+        if (executed != expected) {
+            status = -1;
+        }
+    }
+
+    for (int ii = 0; ii < numWorkers; ii++) {
+        threadPool.workers[ii].deque =
+            workStealingDequeDestroy(threadPool.workers[ii].deque);
+    }
+    free(threadPool.workers); threadPool.workers = NULL;
+
+    return status;
+}
+
+int main(int argc, char **argv) {
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = (argc > 1) ? atoi(argv[1]) : (int) numCpus;
+    int treeDepth = (argc > 2) ? atoi(argv[2]) : DEFAULT_TREE_DEPTH;
+    long workPerTask = (argc > 3) ? atol(argv[3]) : DEFAULT_WORK_PER_TASK;
+    if (maxThreads < 1) {
+        maxThreads = 1;
+    }
+    if ((treeDepth < 0) || (treeDepth > 40)) {
+        printf("Error:  treeDepth must be between 0 and 40!\n");
+        return 1;
+    }
+
+    int status = 0;
+    for (int numWorkers = 1; ; numWorkers *= 2) {
+        if (numWorkers > maxThreads) {
+            numWorkers = maxThreads;
+        }
+
+        status |= runBenchmark(numWorkers, treeDepth, workPerTask);
+
+        if (numWorkers == maxThreads) {
+            break;
+        }
+    }
+
+    return (status == 0) ? 0 : 1;
+}
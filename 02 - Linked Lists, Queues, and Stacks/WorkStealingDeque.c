@@ -0,0 +1,345 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file WorkStealingDeque.c
+///
+/// @brief Library implementation of the WorkStealingDeque.
+///
+/// This is the Chase-Lev deque, with the memory orderings from Le, Pop, Cohen
+/// and Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory
+/// Models".  The owner pushes and pops at the bottom without any atomic
+/// read-modify-write except when it races a thief for the last value.  Thieves
+/// take from the top with a single compare-and-swap.  The values live in a
+/// circular array that the owner doubles when it fills up.
+
+// Standard C includes
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "WorkStealingDeque.h"
+
+/// @def CACHE_LINE_SIZE
+///
+/// @brief Alignment used to keep top and bottom on separate cache lines.
+#define CACHE_LINE_SIZE 64
+
+/// @def MIN_CAPACITY
+///
+/// @brief Starting capacity of the circular array.  Must be a power of 2.
+#define MIN_CAPACITY 64
+
+/// @struct WSArray
+///
+/// @brief Circular array that holds the values of a WorkStealingDeque.
+///
+/// @param capacity Number of slots.  Always a power of 2.
+/// @param previous The array this one replaced, kept alive because a thief may
+///   still be reading from it.
+/// @param slots The values, indexed by position modulo capacity.
+typedef struct WSArray {
+    long long capacity;
+    struct WSArray *previous;
+    _Atomic(void*) slots[];
+} WSArray;
+
+struct WorkStealingDeque {
+    alignas(CACHE_LINE_SIZE) atomic_llong top;
+    alignas(CACHE_LINE_SIZE) atomic_llong bottom;
+    _Atomic(WSArray*) array;
+};
+
+/// @fn static WSArray* wsArrayCreate(long long capacity)
+///
+/// @brief Allocate an empty circular array.
+///
+/// @return Returns a pointer to the new array on success, NULL on failure.
+static WSArray* wsArrayCreate(long long capacity) {
+    WSArray *wsArray = (WSArray*) malloc(sizeof(WSArray)
+        + ((size_t) capacity * sizeof(_Atomic(void*))));
+    if (wsArray == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    wsArray->capacity = capacity;
+    wsArray->previous = NULL;
+    for (long long ii = 0; ii < capacity; ii++) {
+        atomic_init(&wsArray->slots[ii], NULL);
+    }
+
+    return wsArray;
+}
+
+/// @fn static WSArray* wsArrayGrow(WSArray *wsArray, long long top,
+///   long long bottom)
+///
+/// @brief Copy the live values of a circular array into one twice its size.
+///
+/// @return Returns a pointer to the new array on success, NULL on failure.
+static WSArray* wsArrayGrow(WSArray *wsArray, long long top, long long bottom) {
+    WSArray *grown = wsArrayCreate(wsArray->capacity * 2);
+    if (grown == NULL) {
+        return NULL;
+    }
+
+    for (long long ii = top; ii < bottom; ii++) {
+        void *value = atomic_load_explicit(
+            &wsArray->slots[ii & (wsArray->capacity - 1)],
+            memory_order_relaxed);
+        atomic_store_explicit(&grown->slots[ii & (grown->capacity - 1)],
+            value, memory_order_relaxed);
+    }
+    grown->previous = wsArray;
+
+    return grown;
+}
+
+/// @fn WorkStealingDeque* workStealingDequeCreate(void)
+///
+/// @brief Allocate and initialize an empty work-stealing deque.
+///
+/// @return Returns a pointer to an allocated and initialized WorkStealingDeque
+/// on success, NULL on failure.
+WorkStealingDeque* workStealingDequeCreate(void) {
+    WorkStealingDeque *workStealingDeque =
+        (WorkStealingDeque*) aligned_alloc(CACHE_LINE_SIZE,
+            sizeof(WorkStealingDeque));
+    if (workStealingDeque == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    WSArray *wsArray = wsArrayCreate(MIN_CAPACITY);
+    if (wsArray == NULL) {
+        free(workStealingDeque); workStealingDeque = NULL;
+        return NULL;
+    }
+
+    atomic_init(&workStealingDeque->top, 0);
+    atomic_init(&workStealingDeque->bottom, 0);
+    atomic_init(&workStealingDeque->array, wsArray);
+
+    return workStealingDeque;
+}
+
+/// @fn WorkStealingDeque* workStealingDequeDestroy(
+///   WorkStealingDeque *workStealingDeque)
+///
+/// @brief Release all the memory held by a work-stealing deque.
+///
+/// @param workStealingDeque A pointer to a previously-created
+///   WorkStealingDeque.
+///
+/// @note No other thread may be using the deque.  The values themselves belong
+/// to the caller and are not freed.
+///
+/// @return This function always succeeds and always returns NULL.
+WorkStealingDeque* workStealingDequeDestroy(
+    WorkStealingDeque *workStealingDeque
+) {
+    if (workStealingDeque == NULL) {
+        return NULL;
+    }
+
+    // Retired arrays are only freed here, once no thief can be reading them
+    WSArray *wsArray = atomic_load(&workStealingDeque->array);
+    while (wsArray != NULL) {
+        WSArray *previous = wsArray->previous;
+        free(wsArray);
+        wsArray = previous;
+    }
+
+    free(workStealingDeque); workStealingDeque = NULL;
+
+    return NULL;
+}
+
+/// @fn int workStealingDequePushBack(WorkStealingDeque *workStealingDeque,
+///   void *value)
+///
+/// @brief Push a value onto the bottom of the deque.  Owner only.
+///
+/// @param workStealingDeque A pointer to the deque owned by the calling thread.
+/// @param value The value to push.
+///
+/// @return Returns 0 on success, -1 if the deque was full and could not grow.
+int workStealingDequePushBack(WorkStealingDeque *workStealingDeque,
+    void *value
+) {
+    if (workStealingDeque == NULL) {
+        return -1;
+    }
+
+    long long bottom = atomic_load_explicit(&workStealingDeque->bottom,
+        memory_order_relaxed);
+    long long top = atomic_load_explicit(&workStealingDeque->top,
+        memory_order_acquire);
+    WSArray *wsArray = atomic_load_explicit(&workStealingDeque->array,
+        memory_order_relaxed);
+
+    if (bottom - top > wsArray->capacity - 1) {
+        // Full.  Thieves can keep reading the old array until we publish
+        // the new one, and afterwards the old one stays allocated for them.
+        WSArray *grown = wsArrayGrow(wsArray, top, bottom);
+        if (grown == NULL) {
+            return -1;
+        }
+        atomic_store_explicit(&workStealingDeque->array, grown,
+            memory_order_release);
+        wsArray = grown;
+    }
+
+    atomic_store_explicit(&wsArray->slots[bottom & (wsArray->capacity - 1)],
+        value, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&workStealingDeque->bottom, bottom + 1,
+        memory_order_relaxed);
+
+    return 0;
+}
+
+/// @fn int workStealingDequePopBack(WorkStealingDeque *workStealingDeque,
+///   void **value)
+///
+/// @brief Pop the most recently pushed value off the bottom of the deque.
+/// Owner only.
+///
+/// @param workStealingDeque A pointer to the deque owned by the calling thread.
+/// @param value Set to the popped value on success.
+///
+/// @return Returns 0 on success, WSD_EMPTY if there was nothing to pop.
+int workStealingDequePopBack(WorkStealingDeque *workStealingDeque,
+    void **value
+) {
+    if ((workStealingDeque == NULL) || (value == NULL)) {
+        return WSD_EMPTY;
+    }
+
+    // Claim the bottom slot first, then see whether a thief got there too
+    long long bottom = atomic_load_explicit(&workStealingDeque->bottom,
+        memory_order_relaxed) - 1;
+    WSArray *wsArray = atomic_load_explicit(&workStealingDeque->array,
+        memory_order_relaxed);
+    atomic_store_explicit(&workStealingDeque->bottom, bottom,
+        memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long top = atomic_load_explicit(&workStealingDeque->top,
+        memory_order_relaxed);
+
+    if (top > bottom) {
+        // Was already empty
+        atomic_store_explicit(&workStealingDeque->bottom, bottom + 1,
+            memory_order_relaxed);
+        return WSD_EMPTY;
+    }
+
+    void *popped = atomic_load_explicit(
+        &wsArray->slots[bottom & (wsArray->capacity - 1)],
+        memory_order_relaxed);
+    if (top == bottom) {
+        // Last value.  Race any thieves for it by advancing top ourselves.
+        int status = 0;
+        if (atomic_compare_exchange_strong_explicit(&workStealingDeque->top,
+            &top, top + 1, memory_order_seq_cst, memory_order_relaxed)
+        ) {
+            *value = popped;
+        } else {
+            // A thief owns it now
+            status = WSD_EMPTY;
+        }
+        atomic_store_explicit(&workStealingDeque->bottom, bottom + 1,
+            memory_order_relaxed);
+        return status;
+    }
+
+    *value = popped;
+    return 0;
+}
+
+/// @fn int workStealingDequeSteal(WorkStealingDeque *workStealingDeque,
+///   void **value)
+///
+/// @brief Take the oldest value off the top of a deque owned by another thread.
+///
+/// @param workStealingDeque A pointer to the deque to steal from.
+/// @param value Set to the stolen value on success.
+///
+/// @return Returns 0 on success, WSD_EMPTY if there was nothing to steal or
+/// WSD_ABORT if another thread took the value first.
+int workStealingDequeSteal(WorkStealingDeque *workStealingDeque,
+    void **value
+) {
+    if ((workStealingDeque == NULL) || (value == NULL)) {
+        return WSD_EMPTY;
+    }
+
+    long long top = atomic_load_explicit(&workStealingDeque->top,
+        memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long bottom = atomic_load_explicit(&workStealingDeque->bottom,
+        memory_order_acquire);
+
+    if (top >= bottom) {
+        return WSD_EMPTY;
+    }
+
+    WSArray *wsArray = atomic_load_explicit(&workStealingDeque->array,
+        memory_order_acquire);
+    void *stolen = atomic_load_explicit(
+        &wsArray->slots[top & (wsArray->capacity - 1)], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&workStealingDeque->top,
+        &top, top + 1, memory_order_seq_cst, memory_order_relaxed)
+    ) {
+        return WSD_ABORT;
+    }
+
+    *value = stolen;
+
+    return 0;
+}
+
+/// @fn long long workStealingDequeSize(WorkStealingDeque *workStealingDeque)
+///
+/// @brief Get the number of values in a work-stealing deque.
+///
+/// @param workStealingDeque A pointer to a previously-created
+///   WorkStealingDeque.
+///
+/// @note With other threads active the result is only a snapshot.
+///
+/// @return Returns the number of values in the deque, or 0 on failure.
+long long workStealingDequeSize(WorkStealingDeque *workStealingDeque) {
+    if (workStealingDeque == NULL) {
+        return 0;
+    }
+
+    long long bottom = atomic_load(&workStealingDeque->bottom);
+    long long top = atomic_load(&workStealingDeque->top);
+
+    return (bottom > top) ? bottom - top : 0;
+}
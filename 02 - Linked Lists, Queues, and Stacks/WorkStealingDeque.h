@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              WorkStealingDeque.h
+///
+/// @brief             Chase-Lev work-stealing deque in C.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def WSD_EMPTY
+///
+/// @brief Returned when there was nothing in the deque to take.
+#define WSD_EMPTY -1
+
+/// @def WSD_ABORT
+///
+/// @brief Returned by workStealingDequeSteal when another thread took the
+/// value first.  The deque may still have values in it, so try again.
+#define WSD_ABORT -2
+
+/// @struct WorkStealingDeque
+///
+/// @brief Deque of pointers owned by one thread that other threads can steal
+/// from.  The layout is private to WorkStealingDeque.c because it is made of
+/// C11 atomics.
+///
+/// Only the owning thread may call workStealingDequePushBack and
+/// workStealingDequePopBack.  Any thread may call workStealingDequeSteal,
+/// which takes from the front.
+typedef struct WorkStealingDeque WorkStealingDeque;
+
+// Base WorkStealingDeque prototypes
+WorkStealingDeque* workStealingDequeCreate(void);
+WorkStealingDeque* workStealingDequeDestroy(
+    WorkStealingDeque *workStealingDeque);
+int workStealingDequePushBack(WorkStealingDeque *workStealingDeque,
+    void *value);
+int workStealingDequePopBack(WorkStealingDeque *workStealingDeque,
+    void **value);
+int workStealingDequeSteal(WorkStealingDeque *workStealingDeque,
+    void **value);
+long long workStealingDequeSize(WorkStealingDeque *workStealingDeque);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // WORK_STEALING_DEQUE_H
@@ -0,0 +1,687 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ListBenchmark.c
+///
+/// @brief Time the basic operations of ArrayList and LinkedList side by side
+/// across list sizes and access patterns.
+///
+/// Usage:  ListBenchmark [--min N] [--max N] [--budget-ms MS]
+///                       [--csv PATH] [--json PATH] [--quiet]
+///
+/// For every size from min to max (multiplying by 10 each time) and every
+/// structure, a list of the values 0 through size - 1 is built and then
+/// inserted into, iterated, searched, removed from and popped, each under the
+/// access patterns that make sense for it.  Every row reports ns/op,
+/// operations per second and the peak resident set size.  Results go to
+/// stdout as a table and, if asked, to CSV and JSON files ("-" for stdout).
+///
+/// Each structure and size runs in its own child process so that its peak RSS
+/// is its own.  Each measurement repeats until it has done BENCH_MIN_OPS
+/// operations or used up the time budget, whichever comes first, so the big
+/// O(n) cases finish in bounded time with fewer operations.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ArrayList.h"
+#include "LinkedList.h"
+
+/// @def DEFAULT_MIN_SIZE
+///
+/// @brief Smallest list size when not given on the command line.
+#define DEFAULT_MIN_SIZE 10
+
+/// @def DEFAULT_MAX_SIZE
+///
+/// @brief Largest list size when not given on the command line.  Sizes up to
+/// 10^8 work but need tens of GB for the LinkedList.
+#define DEFAULT_MAX_SIZE 1000000
+
+/// @def DEFAULT_BUDGET_MS
+///
+/// @brief Time each measurement may take when not given on the command line.
+#define DEFAULT_BUDGET_MS 200
+
+/// @def BENCH_MIN_OPS
+///
+/// @brief Operations a measurement is repeated up to, time permitting, so that
+/// fast operations on small lists are still timed accurately.
+#define BENCH_MIN_OPS 1000000
+
+/// @def MAX_BATCH
+///
+/// @brief Most operations run between checks of the clock.
+#define MAX_BATCH 65536
+
+/// @def CHILD_NO_ROWS
+///
+/// @brief Exit status bit a benchmark child sets when it wrote no JSON rows.
+#define CHILD_NO_ROWS 1
+
+/// @def CHILD_FAILED
+///
+/// @brief Exit status bit a benchmark child sets when its case failed.
+#define CHILD_FAILED 2
+
+/// @enum KeyPattern
+///
+/// @brief Which values an operation asks for, in what order.
+typedef enum KeyPattern {
+    PATTERN_SEQUENTIAL = 0,
+    PATTERN_REVERSE,
+    PATTERN_RANDOM,
+    PATTERN_MISS
+} KeyPattern;
+
+static const char *patternNames[] = {
+    "sequential", "reverse", "random", "miss"
+};
+
+/// @struct BenchList
+///
+/// @brief Adapts one list type to the operations the benchmark times.  Every
+/// keyed operation takes a value and returns nonzero if it found it.
+typedef struct BenchList {
+    const char *name;
+    void* (*create)(void);
+    void (*destroy)(void *list);
+    int (*insert)(void *list, int value);
+    int (*search)(void *list, int value);
+    int (*remove)(void *list, int value);
+    int (*popFront)(void *list, int value);
+    int (*popBack)(void *list, int value);
+    long long (*iterate)(void *list);
+} BenchList;
+
+/// @struct BenchOutput
+///
+/// @brief Where results go.
+typedef struct BenchOutput {
+    int table;
+    FILE *csv;
+    FILE *json;
+    int jsonRows;
+} BenchOutput;
+
+/// @struct BenchResult
+///
+/// @brief Totals for one measurement.
+typedef struct BenchResult {
+    size_t ops;
+    uint64_t ns;
+} BenchResult;
+
+// Keeps the compiler from discarding the results of timed operations
+static volatile long long benchSink;
+
+/// @fn static uint64_t nowNs(void)
+///
+/// @brief Read the monotonic clock.
+///
+/// @return Returns the current time in nanoseconds.
+static uint64_t nowNs(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec * 1000000000u) + (uint64_t) now.tv_nsec;
+}
+
+/// @fn static long peakRssKib(void)
+///
+/// @brief Get the peak resident set size of this process.
+///
+/// @return Returns the peak RSS in KiB, or -1 if it could not be read.
+static long peakRssKib(void) {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+
+    // Linux reports kilobytes
+    return usage.ru_maxrss;
+}
+
+/// @fn static int keyAt(KeyPattern pattern, size_t ii, size_t size)
+///
+/// @brief Get the value the ii-th operation of a pattern asks for.
+///
+/// @note The random pattern walks a fixed bijection of [0, size), so its first
+/// size keys are all different and removals never ask for a value twice.
+static int keyAt(KeyPattern pattern, size_t ii, size_t size) {
+    size_t position = ii % size;
+    switch (pattern) {
+        case PATTERN_SEQUENTIAL:
+            return (int) position;
+        case PATTERN_REVERSE:
+            return (int) (size - 1 - position);
+        case PATTERN_RANDOM: {
+            int bits = 1;
+            while ((bits < 63) && (((uint64_t) 1 << bits) < size)) {
+                bits++;
+            }
+            uint64_t mask = ((uint64_t) 1 << bits) - 1;
+            uint64_t key = position;
+            do {
+                // Each step is a bijection on [0, 2^bits), so cycle-walking
+                // until the result is in range is a bijection on [0, size)
+                key = (key * 0x9E3779B97F4A7C15ull + 0x632BE59BD9B4E019ull)
+                    & mask;
+                key ^= key >> ((bits + 1) / 2);
+            } while (key >= size);
+            return (int) key;
+        }
+        case PATTERN_MISS:
+        default:
+            return -1 - (int) (ii % INT32_MAX);
+    }
+}
+
+// ArrayList adapters
+
+static void* arrayListBenchCreate(void) {
+    return arrayListCreate();
+}
+
+static void arrayListBenchDestroy(void *list) {
+    arrayListDestroy((ArrayList*) list);
+}
+
+static int arrayListBenchInsert(void *list, int value) {
+    return arrayListInsert((ArrayList*) list, value) == 0;
+}
+
+static int arrayListBenchSearch(void *list, int value) {
+    return arrayListSearch((ArrayList*) list, value) >= 0;
+}
+
+static int arrayListBenchRemove(void *list, int value) {
+    return arrayListRemove((ArrayList*) list, value) == 0;
+}
+
+static int arrayListBenchPopFront(void *list, int value) {
+    (void) value;
+    return arrayListRemoveAt((ArrayList*) list, 0) == 0;
+}
+
+static int arrayListBenchPopBack(void *list, int value) {
+    ArrayList *arrayList = (ArrayList*) list;
+    (void) value;
+    return (arrayList->listSize > 0)
+        && (arrayListRemoveAt(arrayList, arrayList->listSize - 1) == 0);
+}
+
+static long long arrayListBenchIterate(void *list) {
+    long long sum = 0;
+    ALIter iterStorage;
+    for (ALIter *alIter = alIterInit(&iterStorage, (ArrayList*) list);
+        alIter != NULL;
+        alIter = alIterStep(alIter)
+    ) {
+        sum += alIterValue(alIter);
+    }
+
+    return sum;
+}
+
+// LinkedList adapters
+
+static int compareInts(const void *a, const void *b) {
+    int left = *((const int*) a);
+    int right = *((const int*) b);
+    return (left > right) - (left < right);
+}
+
+static void* linkedListBenchCreate(void) {
+    return linkedListCreate(compareInts);
+}
+
+static void linkedListBenchDestroy(void *list) {
+    linkedListDestroy((LinkedList*) list);
+}
+
+static int linkedListBenchInsert(void *list, int value) {
+    return linkedListInsertBack((LinkedList*) list, &value, sizeof(value)) == 0;
+}
+
+static int linkedListBenchSearch(void *list, int value) {
+    return linkedListSearch((LinkedList*) list, &value) != NULL;
+}
+
+static int linkedListBenchRemove(void *list, int value) {
+    return linkedListRemoveValue((LinkedList*) list, &value) == 0;
+}
+
+static int linkedListBenchPopFront(void *list, int value) {
+    (void) value;
+    return linkedListPopFront((LinkedList*) list, NULL, 0) == 0;
+}
+
+static int linkedListBenchPopBack(void *list, int value) {
+    (void) value;
+    return linkedListPopBack((LinkedList*) list, NULL, 0) == 0;
+}
+
+static long long linkedListBenchIterate(void *list) {
+    long long sum = 0;
+    for (ListNode *cur = ((LinkedList*) list)->head;
+        cur != NULL;
+        cur = cur->next
+    ) {
+        int value;
+        memcpy(&value, cur->value, sizeof(value));
+        sum += value;
+    }
+
+    return sum;
+}
+
+static const BenchList benchLists[] = {
+    {
+        "ArrayList", arrayListBenchCreate, arrayListBenchDestroy,
+        arrayListBenchInsert, arrayListBenchSearch, arrayListBenchRemove,
+        arrayListBenchPopFront, arrayListBenchPopBack, arrayListBenchIterate
+    },
+    {
+        "LinkedList", linkedListBenchCreate, linkedListBenchDestroy,
+        linkedListBenchInsert, linkedListBenchSearch, linkedListBenchRemove,
+        linkedListBenchPopFront, linkedListBenchPopBack, linkedListBenchIterate
+    },
+};
+
+// Measurement
+
+static void* buildList(const BenchList *benchList, size_t size) {
+    void *list = benchList->create();
+    if (list == NULL) {
+        return NULL;
+    }
+
+    for (size_t ii = 0; ii < size; ii++) {
+        if (!benchList->insert(list, (int) ii)) {
+            benchList->destroy(list);
+            return NULL;
+        }
+    }
+
+    return list;
+}
+
+/// @fn static BenchResult runKeyed(void *list,
+///   int (*operation)(void*, int), KeyPattern pattern, size_t size,
+///   size_t maxOps, uint64_t budgetNs)
+///
+/// @brief Time up to maxOps calls of a keyed operation, stopping early once
+/// the budget is used up.
+///
+/// @note The clock is read after batches that double in length, so it costs
+/// next to nothing per operation.  Key generation is a few ns per operation
+/// and is included in the time.
+static BenchResult runKeyed(void *list, int (*operation)(void*, int),
+    KeyPattern pattern, size_t size, size_t maxOps, uint64_t budgetNs
+) {
+    BenchResult result = { 0, 0 };
+    long long found = 0;
+    size_t batch = 1;
+    uint64_t start = nowNs();
+
+    while (result.ops < maxOps) {
+        size_t end = result.ops + batch;
+        if (end > maxOps) {
+            end = maxOps;
+        }
+        for (; result.ops < end; result.ops++) {
+            found += operation(list, keyAt(pattern, result.ops, size));
+        }
+
+        result.ns = nowNs() - start;
+        if (result.ns >= budgetNs) {
+            break;
+        }
+        if (batch < MAX_BATCH) {
+            batch *= 2;
+        }
+    }
+
+    benchSink += found;
+    return result;
+}
+
+static void printHeader(BenchOutput *benchOutput) {
+    if (benchOutput->table) {
+        printf("%-10s %-8s %-10s %10s %12s %12s %14s %12s\n", "structure",
+            "op", "pattern", "size", "ops", "ns/op", "ops/s", "peakRssKiB");
+    }
+    if (benchOutput->csv != NULL) {
+        fprintf(benchOutput->csv, "structure,operation,pattern,size,ops,"
+            "ns_per_op,ops_per_sec,peak_rss_kib\n");
+    }
+    if (benchOutput->json != NULL) {
+        fprintf(benchOutput->json, "[\n");
+    }
+    fflush(NULL);
+}
+
+static void printRow(BenchOutput *benchOutput, const char *structure,
+    const char *operation, const char *pattern, size_t size,
+    BenchResult result
+) {
+    double nsPerOp = (result.ops > 0)
+        ? (double) result.ns / (double) result.ops : 0.0;
+    double opsPerSec = (result.ns > 0)
+        ? (double) result.ops * 1e9 / (double) result.ns : 0.0;
+    long peakRss = peakRssKib();
+
+    if (benchOutput->table) {
+        printf("%-10s %-8s %-10s %10zu %12zu %12.2f %14.0f %12ld\n",
+            structure, operation, pattern, size, result.ops, nsPerOp,
+            opsPerSec, peakRss);
+    }
+    if (benchOutput->csv != NULL) {
+        fprintf(benchOutput->csv, "%s,%s,%s,%zu,%zu,%.3f,%.1f,%ld\n",
+            structure, operation, pattern, size, result.ops, nsPerOp,
+            opsPerSec, peakRss);
+    }
+    if (benchOutput->json != NULL) {
+        fprintf(benchOutput->json, "%s  {\"structure\": \"%s\", "
+            "\"operation\": \"%s\", \"pattern\": \"%s\", \"size\": %zu, "
+            "\"ops\": %zu, \"ns_per_op\": %.3f, \"ops_per_sec\": %.1f, "
+            "\"peak_rss_kib\": %ld}", (benchOutput->jsonRows > 0) ? ",\n" : "",
+            structure, operation, pattern, size, result.ops, nsPerOp,
+            opsPerSec, peakRss);
+        benchOutput->jsonRows++;
+    }
+    fflush(NULL);
+}
+
+static void printFooter(BenchOutput *benchOutput) {
+    if (benchOutput->json != NULL) {
+        fprintf(benchOutput->json, "%s]\n",
+            (benchOutput->jsonRows > 0) ? "\n" : "");
+    }
+    fflush(NULL);
+}
+
+/// @fn static int runDestructive(BenchOutput *benchOutput,
+///   const BenchList *benchList, const char *operationName,
+///   int (*operation)(void*, int), const char *patternName,
+///   KeyPattern pattern, size_t size, uint64_t budgetNs)
+///
+/// @brief Time an operation that shrinks the list, rebuilding the list
+/// outside the timed region whenever it needs more rounds.
+///
+/// @return Returns 0 on success, -1 if a list could not be built.
+static int runDestructive(BenchOutput *benchOutput, const BenchList *benchList,
+    const char *operationName, int (*operation)(void*, int),
+    const char *patternName, KeyPattern pattern, size_t size,
+    uint64_t budgetNs
+) {
+    BenchResult total = { 0, 0 };
+    uint64_t start = nowNs();
+    do {
+        void *list = buildList(benchList, size);
+        if (list == NULL) {
+            return -1;
+        }
+
+        BenchResult round = runKeyed(list, operation, pattern, size, size,
+            budgetNs - ((total.ns < budgetNs) ? total.ns : 0));
+        total.ops += round.ops;
+        total.ns += round.ns;
+        benchList->destroy(list);
+    } while ((total.ops < BENCH_MIN_OPS) && (nowNs() - start < budgetNs));
+
+    printRow(benchOutput, benchList->name, operationName, patternName, size,
+        total);
+    return 0;
+}
+
+/// @fn static int runCase(BenchOutput *benchOutput,
+///   const BenchList *benchList, size_t size, uint64_t budgetNs)
+///
+/// @brief Run every measurement for one structure at one size.
+///
+/// @return Returns 0 on success, -1 if a list could not be built.
+static int runCase(BenchOutput *benchOutput, const BenchList *benchList,
+    size_t size, uint64_t budgetNs
+) {
+    // Insert:  build the list from scratch as many times as needed, keeping
+    // the last one for the read-only measurements
+    BenchResult total = { 0, 0 };
+    void *list = NULL;
+    uint64_t start = nowNs();
+    do {
+        if (list != NULL) {
+            benchList->destroy(list);
+        }
+        list = benchList->create();
+        if (list == NULL) {
+            return -1;
+        }
+
+        uint64_t roundStart = nowNs();
+        for (size_t ii = 0; ii < size; ii++) {
+            if (!benchList->insert(list, (int) ii)) {
+                benchList->destroy(list);
+                return -1;
+            }
+        }
+        total.ns += nowNs() - roundStart;
+        total.ops += size;
+    } while ((total.ops < BENCH_MIN_OPS) && (nowNs() - start < budgetNs));
+    printRow(benchOutput, benchList->name, "insert", "back", size, total);
+
+    // Iterate:  whole traversals, counting one op per element
+    total.ops = 0;
+    total.ns = 0;
+    do {
+        uint64_t roundStart = nowNs();
+        benchSink += benchList->iterate(list);
+        total.ns += nowNs() - roundStart;
+        total.ops += size;
+    } while ((total.ops < BENCH_MIN_OPS) && (total.ns < budgetNs));
+    printRow(benchOutput, benchList->name, "iterate", "forward", size, total);
+
+    // Search:  the list doesn't change, so keys just keep cycling
+    for (int pattern = PATTERN_SEQUENTIAL; pattern <= PATTERN_MISS; pattern++) {
+        total = runKeyed(list, benchList->search, (KeyPattern) pattern, size,
+            BENCH_MIN_OPS, budgetNs);
+        printRow(benchOutput, benchList->name, "search",
+            patternNames[pattern], size, total);
+    }
+    benchList->destroy(list);
+
+    // Remove:  every value at most once per list
+    for (int pattern = PATTERN_SEQUENTIAL;
+        pattern <= PATTERN_RANDOM;
+        pattern++
+    ) {
+        if (runDestructive(benchOutput, benchList, "remove",
+            benchList->remove, patternNames[pattern], (KeyPattern) pattern,
+            size, budgetNs) != 0
+        ) {
+            return -1;
+        }
+    }
+
+    // Pop:  from either end until the list is empty
+    if ((runDestructive(benchOutput, benchList, "pop", benchList->popFront,
+            "front", PATTERN_SEQUENTIAL, size, budgetNs) != 0)
+        || (runDestructive(benchOutput, benchList, "pop", benchList->popBack,
+            "back", PATTERN_SEQUENTIAL, size, budgetNs) != 0)
+    ) {
+        return -1;
+    }
+
+    return 0;
+}
+
+static FILE* openOutput(const char *path) {
+    if (path == NULL) {
+        return NULL;
+    } else if (strcmp(path, "-") == 0) {
+        return stdout;
+    }
+
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        fprintf(stderr, "Error:  Could not open %s for writing\n", path);
+    }
+
+    return file;
+}
+
+static void usage(const char *program) {
+    fprintf(stderr, "Usage:  %s [--min N] [--max N] [--budget-ms MS] "
+        "[--csv PATH] [--json PATH] [--quiet]\n", program);
+}
+
+int main(int argc, char **argv) {
+    size_t minSize = DEFAULT_MIN_SIZE;
+    size_t maxSize = DEFAULT_MAX_SIZE;
+    uint64_t budgetMs = DEFAULT_BUDGET_MS;
+    const char *csvPath = NULL;
+    const char *jsonPath = NULL;
+    int quiet = 0;
+
+    for (int ii = 1; ii < argc; ii++) {
+        const char *arg = argv[ii];
+        const char *value = (ii + 1 < argc) ? argv[ii + 1] : NULL;
+        if (strcmp(arg, "--quiet") == 0) {
+            quiet = 1;
+            continue;
+        } else if (value == NULL) {
+            usage(argv[0]);
+            return 1;
+        }
+
+        if (strcmp(arg, "--min") == 0) {
+            minSize = (size_t) strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--max") == 0) {
+            maxSize = (size_t) strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--budget-ms") == 0) {
+            budgetMs = (uint64_t) strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--csv") == 0) {
+            csvPath = value;
+        } else if (strcmp(arg, "--json") == 0) {
+            jsonPath = value;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+        ii++;
+    }
+
+    if ((minSize == 0) || (maxSize < minSize) || (maxSize > INT32_MAX)) {
+        fprintf(stderr, "Error:  Sizes must satisfy 0 < min <= max <= %d\n",
+            INT32_MAX);
+        return 1;
+    }
+
+    BenchOutput benchOutput;
+    benchOutput.csv = openOutput(csvPath);
+    benchOutput.json = openOutput(jsonPath);
+    benchOutput.jsonRows = 0;
+    if (((csvPath != NULL) && (benchOutput.csv == NULL))
+        || ((jsonPath != NULL) && (benchOutput.json == NULL))
+    ) {
+        return 1;
+    }
+    // Don't mix the table in with machine-readable output on stdout
+    benchOutput.table = !quiet && (benchOutput.csv != stdout)
+        && (benchOutput.json != stdout);
+
+    printHeader(&benchOutput);
+
+    int status = 0;
+    uint64_t budgetNs = budgetMs * 1000000u;
+    size_t numLists = sizeof(benchLists) / sizeof(benchLists[0]);
+    for (size_t size = minSize; ; size *= 10) {
+        for (size_t ii = 0; ii < numLists; ii++) {
+            // Everything is flushed, so the child starts with empty buffers
+            pid_t child = fork();
+            if (child == 0) {
+                int rowsBefore = benchOutput.jsonRows;
+                int caseStatus = runCase(&benchOutput, &benchLists[ii], size,
+                    budgetNs);
+                if (caseStatus != 0) {
+                    fprintf(stderr, "Error:  %s ran out of memory at size "
+                        "%zu\n", benchLists[ii].name, size);
+                }
+                fflush(NULL);
+                // Tell the parent whether any JSON rows went out and whether
+                // the case finished
+                _exit(((benchOutput.jsonRows > rowsBefore) ? 0 : CHILD_NO_ROWS)
+                    | ((caseStatus != 0) ? CHILD_FAILED : 0));
+            }
+
+            int childStatus = 0;
+            if ((child < 0) || (waitpid(child, &childStatus, 0) != child)) {
+                fprintf(stderr, "Error:  Could not run %s at size %zu\n",
+                    benchLists[ii].name, size);
+                status = 1;
+                continue;
+            }
+            if (!WIFEXITED(childStatus)) {
+                fprintf(stderr, "Error:  %s at size %zu was killed\n",
+                    benchLists[ii].name, size);
+                status = 1;
+                continue;
+            }
+            if ((WEXITSTATUS(childStatus) & CHILD_NO_ROWS) == 0) {
+                // Only the count matters, for placing commas
+                benchOutput.jsonRows++;
+            }
+            if ((WEXITSTATUS(childStatus) & CHILD_FAILED) != 0) {
+                // The child already said what went wrong
+                status = 1;
+            }
+        }
+
+        if (size > maxSize / 10) {
+            break;
+        }
+    }
+
+    printFooter(&benchOutput);
+    if ((benchOutput.csv != NULL) && (benchOutput.csv != stdout)) {
+        fclose(benchOutput.csv);
+    }
+    if ((benchOutput.json != NULL) && (benchOutput.json != stdout)) {
+        fclose(benchOutput.json);
+    }
+
+    return status;
+}
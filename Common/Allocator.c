@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file Allocator.c
+///
+/// @brief Library implementation of the Allocator helpers and the default
+/// allocator, which is plain malloc, realloc and free.
+
+// Standard C includes
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Allocator.h"
+
+// The default allocator is a thin wrapper around the C library
+
+static void* libcAlloc(void *context, size_t size) {
+    (void) context;
+    return malloc(size);
+}
+
+static void* libcRealloc(void *context, void *pointer, size_t oldSize,
+    size_t newSize
+) {
+    (void) context;
+    (void) oldSize;
+    return realloc(pointer, newSize);
+}
+
+static void libcFree(void *context, void *pointer, size_t size) {
+    (void) context;
+    (void) size;
+    free(pointer);
+}
+
+/// @fn Allocator allocatorLibc(void)
+///
+/// @brief Get the allocator that containers use unless they are given
+/// another.
+///
+/// @return Returns an Allocator backed by malloc, realloc and free.
+Allocator allocatorLibc(void) {
+    Allocator allocator = { libcAlloc, libcRealloc, libcFree, NULL };
+    return allocator;
+}
+
+/// @fn void* allocatorAlloc(const Allocator *allocator, size_t size)
+///
+/// @brief Allocate memory from an allocator.
+///
+/// @param allocator The allocator to use, or NULL for the default.
+/// @param size The number of bytes to allocate.
+///
+/// @return Returns a pointer to the new block on success, NULL on failure.
+void* allocatorAlloc(const Allocator *allocator, size_t size) {
+    if (allocator == NULL) {
+        return malloc(size);
+    }
+
+    return allocator->alloc(allocator->context, size);
+}
+
+/// @fn void* allocatorCalloc(const Allocator *allocator, size_t count,
+///   size_t size)
+///
+/// @brief Allocate zeroed memory for an array from an allocator.
+///
+/// @param allocator The allocator to use, or NULL for the default.
+/// @param count The number of elements.
+/// @param size The size of each element.
+///
+/// @return Returns a pointer to the new block on success, NULL on failure.
+void* allocatorCalloc(const Allocator *allocator, size_t count, size_t size) {
+    if (allocator == NULL) {
+        return calloc(count, size);
+    } else if ((size != 0) && (count > (SIZE_MAX / size))) {
+        // Can't be allocated
+        return NULL;
+    }
+
+    void *pointer = allocator->alloc(allocator->context, count * size);
+    if (pointer != NULL) {
+        memset(pointer, 0, count * size);
+    }
+
+    return pointer;
+}
+
+/// @fn void* allocatorRealloc(const Allocator *allocator, void *pointer,
+///   size_t oldSize, size_t newSize)
+///
+/// @brief Resize memory from an allocator.
+///
+/// @param allocator The allocator the block came from, or NULL for the
+///   default.
+/// @param pointer The block to resize, or NULL to allocate a new one.
+/// @param oldSize The size the block was allocated with.
+/// @param newSize The size the block should have.
+///
+/// @return Returns a pointer to the resized block on success, NULL on failure.
+void* allocatorRealloc(const Allocator *allocator, void *pointer,
+    size_t oldSize, size_t newSize
+) {
+    if (allocator == NULL) {
+        return realloc(pointer, newSize);
+    }
+
+    return allocator->realloc(allocator->context, pointer, oldSize, newSize);
+}
+
+/// @fn void allocatorFree(const Allocator *allocator, void *pointer,
+///   size_t size)
+///
+/// @brief Give memory back to an allocator.
+///
+/// @param allocator The allocator the block came from, or NULL for the
+///   default.
+/// @param pointer The block to release.  May be NULL.
+/// @param size The size the block was allocated with.
+void allocatorFree(const Allocator *allocator, void *pointer, size_t size) {
+    if (pointer == NULL) {
+        return;
+    } else if (allocator == NULL) {
+        free(pointer);
+        return;
+    }
+
+    allocator->free(allocator->context, pointer, size);
+}
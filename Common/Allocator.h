@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              Allocator.h
+///
+/// @brief             Pluggable memory allocators for the containers.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+
+// Standard C includes
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct Allocator
+///
+/// @brief The memory functions a container gets its memory from.
+///
+/// @var alloc Allocate size bytes aligned for any type.  Returns NULL on
+///   failure.
+/// @var realloc Resize a block from oldSize to newSize bytes, keeping its
+///   contents up to the smaller of the two.  Returns NULL on failure, leaving
+///   the old block untouched.
+/// @var free Release a block of size bytes.
+/// @var context Arbitrary pointer passed through as the first argument of
+///   every function.
+///
+/// @note Containers always pass back the exact size they allocated, so
+/// allocators don't need to record sizes themselves.
+typedef struct Allocator {
+    void* (*alloc)(void *context, size_t size);
+    void* (*realloc)(void *context, void *pointer, size_t oldSize,
+        size_t newSize);
+    void (*free)(void *context, void *pointer, size_t size);
+    void *context;
+} Allocator;
+
+// Allocator prototypes
+Allocator allocatorLibc(void);
+void* allocatorAlloc(const Allocator *allocator, size_t size);
+void* allocatorCalloc(const Allocator *allocator, size_t count, size_t size);
+void* allocatorRealloc(const Allocator *allocator, void *pointer,
+    size_t oldSize, size_t newSize);
+void allocatorFree(const Allocator *allocator, void *pointer, size_t size);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // ALLOCATOR_H
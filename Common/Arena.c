@@ -0,0 +1,328 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file Arena.c
+///
+/// @brief Library implementation of the Arena.
+///
+/// An Arena is a chain of blocks, newest first.  Allocations bump an offset
+/// through the newest block and a new block is started when one doesn't fit.
+/// Individual frees are ignored, except that freeing or resizing the most
+/// recent allocation moves the offset back, which is exactly the pattern of a
+/// container growing its array.
+
+// Standard C includes
+#include <stdint.h>
+#include <string.h>
+
+#include "Arena.h"
+
+/// @def ARENA_ALIGNMENT
+///
+/// @brief Alignment of every allocation.  Enough for any standard type.
+#define ARENA_ALIGNMENT 16
+
+/// @def ARENA_ROUND_UP
+///
+/// @brief Round a size up to a multiple of ARENA_ALIGNMENT.
+#define ARENA_ROUND_UP(size) \
+    (((size) + (ARENA_ALIGNMENT - 1)) & ~((size_t) ARENA_ALIGNMENT - 1))
+
+/// @struct ArenaBlock
+///
+/// @brief Header of one block of an Arena.  The usable memory starts
+/// ARENA_BLOCK_HEADER bytes in.
+///
+/// @param next The next older block.
+/// @param size The total size of the block, header included.
+/// @param used The number of bytes handed out so far, header included.
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    size_t size;
+    size_t used;
+} ArenaBlock;
+
+/// @def ARENA_BLOCK_HEADER
+///
+/// @brief Bytes at the start of each block taken by its header.
+#define ARENA_BLOCK_HEADER ARENA_ROUND_UP(sizeof(ArenaBlock))
+
+/// @struct Arena
+///
+/// @brief Internals of an Arena.
+///
+/// @param backing Where the blocks come from.
+/// @param blockSize The size of an ordinary block.
+/// @param blocks The newest block, which allocations come from.
+/// @param last The most recent allocation, or NULL if it has been freed.
+/// @param bytesUsed Total bytes handed out since the last reset.
+struct Arena {
+    Allocator backing;
+    size_t blockSize;
+    ArenaBlock *blocks;
+    unsigned char *last;
+    size_t bytesUsed;
+};
+
+/// @fn static void* arenaAlloc(void *context, size_t size)
+///
+/// @brief Allocator function that bumps through the newest block.
+///
+/// @return Returns a pointer to the new allocation on success, NULL on
+/// failure.
+static void* arenaAlloc(void *context, size_t size) {
+    Arena *arena = (Arena*) context;
+    if (size > (SIZE_MAX - ARENA_BLOCK_HEADER - ARENA_ALIGNMENT)) {
+        // Can't be allocated
+        return NULL;
+    }
+    size = ARENA_ROUND_UP((size > 0) ? size : 1);
+
+    ArenaBlock *block = arena->blocks;
+    if ((block == NULL) || (block->size - block->used < size)) {
+        // Oversized allocations get a block of their own
+        size_t blockSize = ARENA_BLOCK_HEADER + size;
+        if (blockSize < arena->blockSize) {
+            blockSize = arena->blockSize;
+        }
+
+        block = (ArenaBlock*) allocatorAlloc(&arena->backing, blockSize);
+        if (block == NULL) {
+            // Out of memory
+            return NULL;
+        }
+        block->next = arena->blocks;
+        block->size = blockSize;
+        block->used = ARENA_BLOCK_HEADER;
+        arena->blocks = block;
+    }
+
+    unsigned char *pointer = (unsigned char*) block + block->used;
+    block->used += size;
+    arena->bytesUsed += size;
+    arena->last = pointer;
+
+    return pointer;
+}
+
+/// @fn static void* arenaRealloc(void *context, void *pointer,
+///   size_t oldSize, size_t newSize)
+///
+/// @brief Allocator function that resizes the most recent allocation in place
+/// when there is room, and otherwise copies to a new allocation.
+///
+/// @note Any other allocation that shrinks is returned unchanged.  Only the
+/// most recent one can give bytes back, and copying the rest would just use
+/// more of the arena.
+///
+/// @return Returns a pointer to the resized allocation on success, NULL on
+/// failure.
+static void* arenaRealloc(void *context, void *pointer, size_t oldSize,
+    size_t newSize
+) {
+    Arena *arena = (Arena*) context;
+    if (pointer == NULL) {
+        return arenaAlloc(context, newSize);
+    }
+
+    ArenaBlock *block = arena->blocks;
+    if (((unsigned char*) pointer == arena->last)
+        && (newSize <= (SIZE_MAX - ARENA_ALIGNMENT))
+    ) {
+        size_t start = (size_t) ((unsigned char*) pointer
+            - (unsigned char*) block);
+        size_t oldEnd = block->used;
+        size_t newEnd = start + ARENA_ROUND_UP((newSize > 0) ? newSize : 1);
+        if ((newEnd >= start) && (newEnd <= block->size)) {
+            block->used = newEnd;
+            arena->bytesUsed = arena->bytesUsed - (oldEnd - start)
+                + (newEnd - start);
+            return pointer;
+        }
+    }
+    if (newSize <= oldSize) {
+        // Already big enough
+        return pointer;
+    }
+
+    void *check = arenaAlloc(context, newSize);
+    if (check == NULL) {
+        // Out of memory
+        return NULL;
+    }
+    memcpy(check, pointer, oldSize);
+
+    return check;
+}
+
+/// @fn static void arenaFree(void *context, void *pointer, size_t size)
+///
+/// @brief Allocator function that gives back the most recent allocation and
+/// ignores every other free.
+static void arenaFree(void *context, void *pointer, size_t size) {
+    Arena *arena = (Arena*) context;
+    (void) size;
+
+    if ((pointer != NULL) && ((unsigned char*) pointer == arena->last)) {
+        ArenaBlock *block = arena->blocks;
+        size_t start = (size_t) ((unsigned char*) pointer
+            - (unsigned char*) block);
+        arena->bytesUsed -= block->used - start;
+        block->used = start;
+        arena->last = NULL;
+    }
+}
+
+/// @fn Arena* arenaCreate(size_t blockSize, const Allocator *backing)
+///
+/// @brief Allocate and initialize an Arena.
+///
+/// @param blockSize The size of the blocks to carve allocations out of, or 0
+///   for ARENA_DEFAULT_BLOCK_SIZE.
+/// @param backing The allocator the blocks come from, or NULL for the
+///   default.  It is copied, so it only needs to live as long as its context.
+///
+/// @note No memory is taken from the backing allocator until the first
+/// allocation.
+///
+/// @return Returns a pointer to the new Arena on success, NULL on failure.
+Arena* arenaCreate(size_t blockSize, const Allocator *backing) {
+    Allocator backingAllocator
+        = (backing != NULL) ? *backing : allocatorLibc();
+
+    Arena *arena = (Arena*) allocatorAlloc(&backingAllocator, sizeof(Arena));
+    if (arena == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    if (blockSize == 0) {
+        blockSize = ARENA_DEFAULT_BLOCK_SIZE;
+    }
+    if (blockSize < 2 * ARENA_BLOCK_HEADER) {
+        blockSize = 2 * ARENA_BLOCK_HEADER;
+    }
+
+    arena->backing = backingAllocator;
+    arena->blockSize = blockSize;
+    arena->blocks = NULL;
+    arena->last = NULL;
+    arena->bytesUsed = 0;
+
+    return arena;
+}
+
+/// @fn Arena* arenaDestroy(Arena *arena)
+///
+/// @brief Give every block of an Arena back to its backing allocator and free
+/// the Arena.
+///
+/// @param arena A pointer to the Arena to destroy.
+///
+/// @note Everything allocated from the Arena goes with it, whether or not it
+/// was freed.
+///
+/// @return This function always succeeds and always returns NULL.
+Arena* arenaDestroy(Arena *arena) {
+    if (arena == NULL) {
+        return NULL;
+    }
+
+    arenaReset(arena);
+    ArenaBlock *block = arena->blocks;
+    if (block != NULL) {
+        allocatorFree(&arena->backing, block, block->size);
+    }
+
+    Allocator backing = arena->backing;
+    allocatorFree(&backing, arena, sizeof(Arena));
+    arena = NULL;
+
+    return NULL;
+}
+
+/// @fn void arenaReset(Arena *arena)
+///
+/// @brief Free everything allocated from an Arena at once.
+///
+/// @param arena A pointer to the Arena to reset.
+///
+/// @note The newest block is kept for reuse and every other block goes back
+/// to the backing allocator, so the cost depends on the number of blocks, not
+/// the number of allocations.  Containers built on the Arena must not be used
+/// afterwards.
+void arenaReset(Arena *arena) {
+    if ((arena == NULL) || (arena->blocks == NULL)) {
+        return;
+    }
+
+    ArenaBlock *keep = arena->blocks;
+    ArenaBlock *block = keep->next;
+    while (block != NULL) {
+        ArenaBlock *next = block->next;
+        allocatorFree(&arena->backing, block, block->size);
+        block = next;
+    }
+
+    keep->next = NULL;
+    keep->used = ARENA_BLOCK_HEADER;
+    arena->blocks = keep;
+    arena->last = NULL;
+    arena->bytesUsed = 0;
+}
+
+/// @fn size_t arenaBytesUsed(const Arena *arena)
+///
+/// @brief Get the number of bytes handed out by an Arena since it was created
+/// or last reset, after alignment padding.
+///
+/// @param arena A pointer to the Arena to query.
+///
+/// @return Returns the number of bytes in use, or 0 if arena is NULL.
+size_t arenaBytesUsed(const Arena *arena) {
+    if (arena == NULL) {
+        return 0;
+    }
+
+    return arena->bytesUsed;
+}
+
+/// @fn Allocator arenaAllocator(Arena *arena)
+///
+/// @brief Get an Allocator that allocates from an Arena.
+///
+/// @param arena A pointer to the Arena to allocate from.  It must outlive
+///   every container using the Allocator.
+///
+/// @note An Arena is not thread-safe, so every container sharing one must be
+/// used from the same thread.
+///
+/// @return Returns the Allocator.
+Allocator arenaAllocator(Arena *arena) {
+    Allocator allocator = { arenaAlloc, arenaRealloc, arenaFree, arena };
+    return allocator;
+}
@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              Arena.h
+///
+/// @brief             Bump allocator that frees everything at once.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ARENA_H
+#define ARENA_H
+
+// Standard C includes
+#include <stddef.h>
+
+#include "Allocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def ARENA_DEFAULT_BLOCK_SIZE
+///
+/// @brief Size of the blocks an Arena carves allocations out of when not told
+/// otherwise.
+#define ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+/// @struct Arena
+///
+/// @brief Bump allocator.  Allocations are carved in order out of large
+/// blocks and are only given back all at once, by arenaReset or
+/// arenaDestroy.
+typedef struct Arena Arena;
+
+// Arena prototypes
+Arena* arenaCreate(size_t blockSize, const Allocator *backing);
+Arena* arenaDestroy(Arena *arena);
+void arenaReset(Arena *arena);
+size_t arenaBytesUsed(const Arena *arena);
+Allocator arenaAllocator(Arena *arena);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // ARENA_H
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file HugePageAllocator.c
+///
+/// @brief Library implementation of the huge page allocator.
+///
+/// Blocks of at least HUGE_PAGE_SIZE are mapped directly.  Explicit huge
+/// pages (MAP_HUGETLB) are tried first, but they only exist if the
+/// administrator has reserved some, so the fallback is an ordinary mapping
+/// aligned to HUGE_PAGE_SIZE and marked with MADV_HUGEPAGE, which lets
+/// transparent huge pages back it.  Smaller blocks would waste most of a huge
+/// page and go to malloc instead.  Either way a block's size says where it
+/// came from, so nothing has to be recorded per block.
+
+#define _DEFAULT_SOURCE
+
+// Standard C includes
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "HugePageAllocator.h"
+
+/// @fn static size_t hugePageRoundUp(size_t size)
+///
+/// @brief Round a size up to a whole number of huge pages.
+///
+/// @return Returns the rounded size, or 0 if it would overflow.
+static size_t hugePageRoundUp(size_t size) {
+    if (size > (SIZE_MAX - HUGE_PAGE_SIZE)) {
+        return 0;
+    }
+
+    return (size + (HUGE_PAGE_SIZE - 1)) & ~(HUGE_PAGE_SIZE - 1);
+}
+
+/// @fn static void* hugePageMap(size_t bytes)
+///
+/// @brief Map bytes of memory, a multiple of HUGE_PAGE_SIZE, backed by huge
+/// pages if at all possible.
+///
+/// @return Returns a pointer to the mapping on success, NULL on failure.
+static void* hugePageMap(size_t bytes) {
+    void *mapping = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    mapping = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mapping != MAP_FAILED) {
+        return mapping;
+    }
+#endif
+
+    // Map an extra huge page so that an aligned run of bytes fits, then trim
+    // off what's left over on either side
+    if (bytes > (SIZE_MAX - HUGE_PAGE_SIZE)) {
+        return NULL;
+    }
+    size_t mappedBytes = bytes + HUGE_PAGE_SIZE;
+    mapping = mmap(NULL, mappedBytes, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        // Out of memory
+        return NULL;
+    }
+
+    uintptr_t start = (uintptr_t) mapping;
+    uintptr_t aligned = (start + (HUGE_PAGE_SIZE - 1)) & ~(HUGE_PAGE_SIZE - 1);
+    size_t head = (size_t) (aligned - start);
+    size_t tail = mappedBytes - head - bytes;
+    if (head > 0) {
+        munmap(mapping, head);
+    }
+    if (tail > 0) {
+        munmap((void*) (aligned + bytes), tail);
+    }
+
+#ifdef MADV_HUGEPAGE
+    // Only a hint; without transparent huge pages this quietly does nothing
+    madvise((void*) aligned, bytes, MADV_HUGEPAGE);
+#endif
+
+    return (void*) aligned;
+}
+
+/// @fn static void* hugePageAlloc(void *context, size_t size)
+///
+/// @brief Allocator function that maps large blocks and mallocs small ones.
+///
+/// @return Returns a pointer to the new block on success, NULL on failure.
+static void* hugePageAlloc(void *context, size_t size) {
+    (void) context;
+
+    if (size < HUGE_PAGE_SIZE) {
+        return malloc(size);
+    }
+
+    size_t bytes = hugePageRoundUp(size);
+    if (bytes == 0) {
+        // Can't be allocated
+        return NULL;
+    }
+
+    return hugePageMap(bytes);
+}
+
+/// @fn static void hugePageFree(void *context, void *pointer, size_t size)
+///
+/// @brief Allocator function that unmaps large blocks and frees small ones.
+static void hugePageFree(void *context, void *pointer, size_t size) {
+    (void) context;
+
+    if (pointer == NULL) {
+        return;
+    } else if (size < HUGE_PAGE_SIZE) {
+        free(pointer);
+        return;
+    }
+
+    munmap(pointer, hugePageRoundUp(size));
+}
+
+/// @fn static void* hugePageRealloc(void *context, void *pointer,
+///   size_t oldSize, size_t newSize)
+///
+/// @brief Allocator function that resizes a block, moving it between malloc
+/// and a mapping when it crosses HUGE_PAGE_SIZE.
+///
+/// @note A mapped block that still fits in the huge pages it already has is
+/// returned as is.  Growing past them maps a new block and copies, which is
+/// what realloc would do anyway for a block this size.
+///
+/// @return Returns a pointer to the resized block on success, NULL on failure.
+static void* hugePageRealloc(void *context, void *pointer, size_t oldSize,
+    size_t newSize
+) {
+    if (pointer == NULL) {
+        return hugePageAlloc(context, newSize);
+    } else if ((oldSize < HUGE_PAGE_SIZE) && (newSize < HUGE_PAGE_SIZE)) {
+        return realloc(pointer, newSize);
+    } else if ((oldSize >= HUGE_PAGE_SIZE) && (newSize >= HUGE_PAGE_SIZE)
+        && (hugePageRoundUp(oldSize) == hugePageRoundUp(newSize))
+    ) {
+        return pointer;
+    }
+
+    void *check = hugePageAlloc(context, newSize);
+    if (check == NULL) {
+        // Out of memory
+        return NULL;
+    }
+    memcpy(check, pointer, (oldSize < newSize) ? oldSize : newSize);
+    hugePageFree(context, pointer, oldSize);
+
+    return check;
+}
+
+/// @fn Allocator hugePageAllocator(void)
+///
+/// @brief Get an Allocator that backs blocks of HUGE_PAGE_SIZE or more with
+/// huge pages, which cuts TLB misses when scanning big arrays.
+///
+/// @note Huge pages are only worth it for big blocks, so this is meant for
+/// ArrayLists and Arenas with large blocks rather than for node-based lists.
+///
+/// @return Returns the Allocator.
+Allocator hugePageAllocator(void) {
+    Allocator allocator = { hugePageAlloc, hugePageRealloc, hugePageFree,
+        NULL };
+    return allocator;
+}
@@ -0,0 +1,446 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ListStats.c
+///
+/// @brief Library implementation of the list container instrumentation.
+///
+/// Every instrumented container owns a ListStatsRecord, and every record is
+/// linked into one registry so that all live containers can be inspected from
+/// anywhere in the process.  The registry is guarded by a mutex, but the
+/// counters are not:  each one is only ever written by the thread using its
+/// container, so they are relaxed atomics that are loaded and stored rather
+/// than incremented with read-modify-write instructions, which keeps them
+/// about as cheap as plain adds while still letting other threads read them.
+///
+/// Without DS_INSTRUMENTATION every function here is a stub that does nothing
+/// and reports failure.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ListStats.h"
+
+static const char *counterNames[LIST_STATS_COUNTERS] = {
+    "reallocs",
+    "bytes_copied",
+    "elements_shifted",
+    "searches",
+    "compares",
+    "nodes_visited",
+    "mallocs",
+    "frees"
+};
+
+static const char *opNames[LIST_STATS_OPS] = {
+    "insert",
+    "search",
+    "remove",
+    "pop"
+};
+
+/// @fn const char* listStatsCounterName(ListStatsCounter counter)
+///
+/// @brief Get the name of a counter, as used by listStatsDump.
+///
+/// @return Returns the name of the counter, or NULL if there is no such
+/// counter.
+const char* listStatsCounterName(ListStatsCounter counter) {
+    if ((unsigned) counter >= LIST_STATS_COUNTERS) {
+        return NULL;
+    }
+
+    return counterNames[counter];
+}
+
+/// @fn const char* listStatsOpName(ListStatsOp op)
+///
+/// @brief Get the name of an operation, as used by listStatsDump.
+///
+/// @return Returns the name of the operation, or NULL if there is no such
+/// operation.
+const char* listStatsOpName(ListStatsOp op) {
+    if ((unsigned) op >= LIST_STATS_OPS) {
+        return NULL;
+    }
+
+    return opNames[op];
+}
+
+#ifdef DS_INSTRUMENTATION
+
+/// @struct ListStatsRecord
+///
+/// @brief The live statistics of one container.
+///
+/// @param kind The type of the container.
+/// @param container The address of the container.
+/// @param counters One count per ListStatsCounter.
+/// @param latency One histogram per ListStatsOp.
+/// @param next The next record in the registry.
+/// @param prev The previous record in the registry.
+struct ListStatsRecord {
+    const char *kind;
+    const void *container;
+    _Atomic uint64_t counters[LIST_STATS_COUNTERS];
+    _Atomic uint64_t latency[LIST_STATS_OPS][LIST_STATS_BUCKETS];
+    struct ListStatsRecord *next;
+    struct ListStatsRecord *prev;
+};
+
+// Every live record, newest first
+static struct ListStatsRecord *registry = NULL;
+static pthread_mutex_t registryLock = PTHREAD_MUTEX_INITIALIZER;
+
+/// @fn static void listStatsBump(_Atomic uint64_t *counter, uint64_t amount)
+///
+/// @brief Add to a counter that only the calling thread writes.
+static void listStatsBump(_Atomic uint64_t *counter, uint64_t amount) {
+    uint64_t current = atomic_load_explicit(counter, memory_order_relaxed);
+    atomic_store_explicit(counter, current + amount, memory_order_relaxed);
+}
+
+/// @fn struct ListStatsRecord* listStatsRegister(const char *kind,
+///   const void *container)
+///
+/// @brief Create the statistics record for a new container and add it to the
+/// registry.
+///
+/// @param kind The type of the container.  Must outlive the container.
+/// @param container The address of the container.
+///
+/// @note Failing to get a record doesn't stop a container from working, it
+/// just isn't counted.  The record's own allocation is not counted either.
+///
+/// @return Returns a pointer to the new record on success, NULL on failure.
+struct ListStatsRecord* listStatsRegister(const char *kind,
+    const void *container
+) {
+    struct ListStatsRecord *record
+        = (struct ListStatsRecord*) malloc(sizeof(struct ListStatsRecord));
+    if (record == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    record->kind = kind;
+    record->container = container;
+    for (int ii = 0; ii < LIST_STATS_COUNTERS; ii++) {
+        atomic_init(&record->counters[ii], 0);
+    }
+    for (int ii = 0; ii < LIST_STATS_OPS; ii++) {
+        for (int jj = 0; jj < LIST_STATS_BUCKETS; jj++) {
+            atomic_init(&record->latency[ii][jj], 0);
+        }
+    }
+
+    pthread_mutex_lock(&registryLock);
+    record->prev = NULL;
+    record->next = registry;
+    if (registry != NULL) {
+        registry->prev = record;
+    }
+    registry = record;
+    pthread_mutex_unlock(&registryLock);
+
+    return record;
+}
+
+/// @fn struct ListStatsRecord* listStatsUnregister(
+///   struct ListStatsRecord *record)
+///
+/// @brief Remove a container's record from the registry and free it.
+///
+/// @param record The record returned by listStatsRegister.  May be NULL.
+///
+/// @return This function always succeeds and always returns NULL.
+struct ListStatsRecord* listStatsUnregister(struct ListStatsRecord *record) {
+    if (record == NULL) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&registryLock);
+    if (record->prev != NULL) {
+        record->prev->next = record->next;
+    } else {
+        registry = record->next;
+    }
+    if (record->next != NULL) {
+        record->next->prev = record->prev;
+    }
+    pthread_mutex_unlock(&registryLock);
+
+    free(record); record = NULL;
+
+    return NULL;
+}
+
+/// @fn void listStatsAdd(struct ListStatsRecord *record,
+///   ListStatsCounter counter, uint64_t amount)
+///
+/// @brief Add to one of a container's counters.
+///
+/// @param record The container's record.  May be NULL.
+/// @param counter The counter to add to.
+/// @param amount The amount to add.
+///
+/// @note Must only be called by the thread using the container.
+void listStatsAdd(struct ListStatsRecord *record, ListStatsCounter counter,
+    uint64_t amount
+) {
+    if ((record != NULL) && ((unsigned) counter < LIST_STATS_COUNTERS)) {
+        listStatsBump(&record->counters[counter], amount);
+    }
+}
+
+/// @fn uint64_t listStatsNow(void)
+///
+/// @brief Read the monotonic clock for timing an operation.
+///
+/// @return Returns the current time in nanoseconds.
+uint64_t listStatsNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec * 1000000000u) + (uint64_t) now.tv_nsec;
+}
+
+/// @fn void listStatsRecordLatency(struct ListStatsRecord *record,
+///   ListStatsOp op, uint64_t startNs)
+///
+/// @brief Record how long an operation took in its latency histogram.
+///
+/// @param record The container's record.  May be NULL.
+/// @param op The operation that just finished.
+/// @param startNs The time the operation started, from listStatsNow.
+///
+/// @note Must only be called by the thread using the container.
+void listStatsRecordLatency(struct ListStatsRecord *record, ListStatsOp op,
+    uint64_t startNs
+) {
+    if ((record == NULL) || ((unsigned) op >= LIST_STATS_OPS)) {
+        return;
+    }
+
+    // The bucket is the position of the highest set bit
+    uint64_t elapsed = listStatsNow() - startNs;
+    int bucket = 0;
+    while ((elapsed > 1) && (bucket < LIST_STATS_BUCKETS - 1)) {
+        elapsed >>= 1;
+        bucket++;
+    }
+
+    listStatsBump(&record->latency[op][bucket], 1);
+}
+
+/// @fn int listStatsGet(const struct ListStatsRecord *record,
+///   ListStats *stats)
+///
+/// @brief Take a snapshot of a container's statistics.
+///
+/// @param record The container's record.
+/// @param stats The snapshot to fill in.
+///
+/// @note This may be called from any thread, but a container must not be
+/// destroyed while its statistics are being read.  Each counter is read
+/// atomically, but the snapshot as a whole is not.
+///
+/// @return Returns 0 on success, -1 on failure.
+int listStatsGet(const struct ListStatsRecord *record, ListStats *stats) {
+    if ((record == NULL) || (stats == NULL)) {
+        return -1;
+    }
+
+    // The counters are only ever loaded here, so casting away the const is
+    // harmless
+    struct ListStatsRecord *source = (struct ListStatsRecord*) record;
+    stats->kind = source->kind;
+    stats->container = source->container;
+    for (int ii = 0; ii < LIST_STATS_COUNTERS; ii++) {
+        stats->counters[ii] = atomic_load_explicit(&source->counters[ii],
+            memory_order_relaxed);
+    }
+    for (int ii = 0; ii < LIST_STATS_OPS; ii++) {
+        for (int jj = 0; jj < LIST_STATS_BUCKETS; jj++) {
+            stats->latency[ii][jj] = atomic_load_explicit(
+                &source->latency[ii][jj], memory_order_relaxed);
+        }
+    }
+
+    return 0;
+}
+
+/// @fn int listStatsForEach(
+///   int (*callback)(const ListStats *stats, void *context), void *context)
+///
+/// @brief Call a function with a snapshot of the statistics of every live
+/// container, newest first.
+///
+/// @param callback The function to call.  Returning nonzero stops the walk.
+/// @param context An arbitrary pointer passed through to callback.
+///
+/// @note The registry is locked during the walk, so callback must not create
+/// or destroy instrumented containers.
+///
+/// @return Returns 0 on success, -1 on failure.
+int listStatsForEach(int (*callback)(const ListStats *stats, void *context),
+    void *context
+) {
+    if (callback == NULL) {
+        return -1;
+    }
+
+    ListStats stats;
+    pthread_mutex_lock(&registryLock);
+    for (struct ListStatsRecord *cur = registry; cur != NULL; cur = cur->next) {
+        listStatsGet(cur, &stats);
+        if (callback(&stats, context) != 0) {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&registryLock);
+
+    return 0;
+}
+
+/// @fn static int listStatsDumpOne(const ListStats *stats, void *context)
+///
+/// @brief listStatsForEach callback that prints one container's statistics.
+///
+/// @return Always returns 0 so that the walk continues.
+static int listStatsDumpOne(const ListStats *stats, void *context) {
+    FILE *file = (FILE*) context;
+
+    fprintf(file, "%s %p", stats->kind, stats->container);
+    for (int ii = 0; ii < LIST_STATS_COUNTERS; ii++) {
+        fprintf(file, " %s=%" PRIu64, counterNames[ii], stats->counters[ii]);
+    }
+    fprintf(file, "\n");
+
+    for (int ii = 0; ii < LIST_STATS_OPS; ii++) {
+        int printed = 0;
+        for (int jj = 0; jj < LIST_STATS_BUCKETS; jj++) {
+            if (stats->latency[ii][jj] == 0) {
+                continue;
+            }
+            if (printed == 0) {
+                fprintf(file, "  %s ns:", opNames[ii]);
+                printed = 1;
+            }
+            uint64_t low = (jj == 0) ? 0 : ((uint64_t) 1 << jj);
+            fprintf(file, " >=%" PRIu64 ":%" PRIu64, low,
+                stats->latency[ii][jj]);
+        }
+        if (printed != 0) {
+            fprintf(file, "\n");
+        }
+    }
+
+    return 0;
+}
+
+/// @fn int listStatsDump(FILE *file)
+///
+/// @brief Print the statistics of every live container.
+///
+/// @param file The stream to print to.
+///
+/// @note Each container gets one line of counters, followed by one line per
+/// operation with a nonempty latency histogram listing the lower bound of each
+/// nonempty bucket in nanoseconds and its count.
+///
+/// @return Returns 0 on success, -1 on failure.
+int listStatsDump(FILE *file) {
+    if (file == NULL) {
+        return -1;
+    }
+
+    return listStatsForEach(listStatsDumpOne, file);
+}
+
+#else // DS_INSTRUMENTATION
+
+// Nothing is counted, so nothing can be registered or queried
+
+struct ListStatsRecord* listStatsRegister(const char *kind,
+    const void *container
+) {
+    (void) kind;
+    (void) container;
+    return NULL;
+}
+
+struct ListStatsRecord* listStatsUnregister(struct ListStatsRecord *record) {
+    (void) record;
+    return NULL;
+}
+
+void listStatsAdd(struct ListStatsRecord *record, ListStatsCounter counter,
+    uint64_t amount
+) {
+    (void) record;
+    (void) counter;
+    (void) amount;
+}
+
+uint64_t listStatsNow(void) {
+    return 0;
+}
+
+void listStatsRecordLatency(struct ListStatsRecord *record, ListStatsOp op,
+    uint64_t startNs
+) {
+    (void) record;
+    (void) op;
+    (void) startNs;
+}
+
+int listStatsGet(const struct ListStatsRecord *record, ListStats *stats) {
+    (void) record;
+    (void) stats;
+    return -1;
+}
+
+int listStatsForEach(int (*callback)(const ListStats *stats, void *context),
+    void *context
+) {
+    (void) callback;
+    (void) context;
+    return -1;
+}
+
+int listStatsDump(FILE *file) {
+    (void) file;
+    return -1;
+}
+
+#endif // DS_INSTRUMENTATION
@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              ListStats.h
+///
+/// @brief             Optional hot-path instrumentation for the list containers.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef LIST_STATS_H
+#define LIST_STATS_H
+
+// Standard C includes
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Latency histograms are built on top of the counters
+#if defined(DS_INSTRUMENTATION_LATENCY) && !defined(DS_INSTRUMENTATION)
+#define DS_INSTRUMENTATION
+#endif
+
+/// @def LIST_STATS_BUCKETS
+///
+/// @brief Number of buckets in each latency histogram.  Bucket b counts the
+/// operations that took from 2^b up to 2^(b+1) nanoseconds; the last bucket
+/// also takes everything slower.
+#define LIST_STATS_BUCKETS 32
+
+/// @enum ListStatsCounter
+///
+/// @brief The events counted for each container.
+///
+/// @var LIST_STATS_REALLOCS Times the element storage was reallocated.
+/// @var LIST_STATS_BYTES_COPIED Bytes moved by reallocations that could not
+///   grow in place.
+/// @var LIST_STATS_ELEMENTS_SHIFTED Elements moved to open or close a gap in
+///   the middle of an array.
+/// @var LIST_STATS_SEARCHES Searches for a value.
+/// @var LIST_STATS_COMPARES Calls to the container's compare function by
+///   searches that walk the container.
+/// @var LIST_STATS_NODES_VISITED Nodes walked by searches.
+/// @var LIST_STATS_MALLOCS Calls to malloc, calloc or realloc for new blocks.
+/// @var LIST_STATS_FREES Calls to free.
+typedef enum ListStatsCounter {
+    LIST_STATS_REALLOCS = 0,
+    LIST_STATS_BYTES_COPIED,
+    LIST_STATS_ELEMENTS_SHIFTED,
+    LIST_STATS_SEARCHES,
+    LIST_STATS_COMPARES,
+    LIST_STATS_NODES_VISITED,
+    LIST_STATS_MALLOCS,
+    LIST_STATS_FREES,
+    LIST_STATS_COUNTERS
+} ListStatsCounter;
+
+/// @enum ListStatsOp
+///
+/// @brief The operations latency histograms are kept for.
+typedef enum ListStatsOp {
+    LIST_STATS_OP_INSERT = 0,
+    LIST_STATS_OP_SEARCH,
+    LIST_STATS_OP_REMOVE,
+    LIST_STATS_OP_POP,
+    LIST_STATS_OPS
+} ListStatsOp;
+
+/// @struct ListStats
+///
+/// @brief A snapshot of the statistics of one container.
+///
+/// @var kind The type of the container, such as "ArrayList".
+/// @var container The address of the container.
+/// @var counters How many times each ListStatsCounter event has happened.
+/// @var latency One histogram per ListStatsOp.  All zero unless built with
+///   DS_INSTRUMENTATION_LATENCY.
+typedef struct ListStats {
+    const char *kind;
+    const void *container;
+    uint64_t counters[LIST_STATS_COUNTERS];
+    uint64_t latency[LIST_STATS_OPS][LIST_STATS_BUCKETS];
+} ListStats;
+
+/// @def LIST_STATS_ADD
+///
+/// @brief Add to one of a container's counters.  Compiles to nothing unless
+/// built with DS_INSTRUMENTATION.  The amount is never evaluated then, but it
+/// still counts as used, so locals that only feed counters don't need their
+/// own #ifdefs.
+#ifdef DS_INSTRUMENTATION
+#define LIST_STATS_ADD(record, counter, amount) \
+    listStatsAdd((record), (counter), (uint64_t) (amount))
+#else
+#define LIST_STATS_ADD(record, counter, amount) ((void) sizeof(amount))
+#endif
+
+/// @def LIST_STATS_TIMER
+///
+/// @brief Declare a variable holding the start time of an operation.  Compiles
+/// to nothing unless built with DS_INSTRUMENTATION_LATENCY.
+///
+/// @def LIST_STATS_LATENCY
+///
+/// @brief Record the time since LIST_STATS_TIMER in an operation's histogram.
+/// Compiles to nothing unless built with DS_INSTRUMENTATION_LATENCY.
+#ifdef DS_INSTRUMENTATION_LATENCY
+#define LIST_STATS_TIMER(name) uint64_t name = listStatsNow()
+#define LIST_STATS_LATENCY(record, op, name) \
+    listStatsRecordLatency((record), (op), (name))
+#else
+#define LIST_STATS_TIMER(name) ((void) 0)
+#define LIST_STATS_LATENCY(record, op, name) ((void) 0)
+#endif
+
+// Container-side ListStats prototypes
+struct ListStatsRecord* listStatsRegister(const char *kind,
+    const void *container);
+struct ListStatsRecord* listStatsUnregister(struct ListStatsRecord *record);
+void listStatsAdd(struct ListStatsRecord *record, ListStatsCounter counter,
+    uint64_t amount);
+uint64_t listStatsNow(void);
+void listStatsRecordLatency(struct ListStatsRecord *record, ListStatsOp op,
+    uint64_t startNs);
+
+// Query ListStats prototypes
+int listStatsGet(const struct ListStatsRecord *record, ListStats *stats);
+int listStatsForEach(int (*callback)(const ListStats *stats, void *context),
+    void *context);
+int listStatsDump(FILE *file);
+const char* listStatsCounterName(ListStatsCounter counter);
+const char* listStatsOpName(ListStatsOp op);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // LIST_STATS_H
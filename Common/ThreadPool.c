@@ -0,0 +1,316 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//                       Copyright (c) 2026 Brian Card
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+//                                 Brian Card
+//                       https://github.com/brian-card
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// @file ThreadPool.c
+///
+/// @brief Library implementation of the ThreadPool.
+///
+/// Workers sleep on a condition variable until a run starts, then claim task
+/// indices from a shared atomic counter until there are none left.  Claiming
+/// one index at a time balances uneven tasks on its own, so callers only have
+/// to cut their work into a few more tasks than there are threads.  The thread
+/// that starts a run works on it too instead of just waiting.
+
+#define _POSIX_C_SOURCE 200809L
+
+// Standard C includes
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "ThreadPool.h"
+
+/// @def MAX_THREADS
+///
+/// @brief Most threads a ThreadPool may have.
+#define MAX_THREADS 1024
+
+/// @struct ThreadPool
+///
+/// @brief Internals of a ThreadPool.
+///
+/// @param workers The worker threads.
+/// @param numWorkers The number of worker threads, one less than the size of
+///   the pool since the thread calling threadPoolRun also works.
+/// @param lock Guards everything below it except nextTask.
+/// @param wake Signalled when a run starts or the pool shuts down.
+/// @param done Signalled when the last worker finishes a run.
+/// @param generation Incremented by every run so workers can tell a new run
+///   from a spurious wakeup.
+/// @param busyWorkers Workers that haven't finished the current run.
+/// @param shutdown Nonzero once the pool is being destroyed.
+/// @param task The task function of the current run.
+/// @param context The context of the current run.
+/// @param numTasks The number of tasks in the current run.
+/// @param nextTask The next task index to hand out.
+/// @param runLock Keeps two threads from starting runs at the same time.
+struct ThreadPool {
+    pthread_t *workers;
+    int numWorkers;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    unsigned long generation;
+    int busyWorkers;
+    int shutdown;
+    void (*task)(size_t taskIndex, void *context);
+    void *context;
+    size_t numTasks;
+    atomic_size_t nextTask;
+    pthread_mutex_t runLock;
+};
+
+/// @fn static void threadPoolWork(ThreadPool *threadPool)
+///
+/// @brief Run tasks of the current run until they have all been claimed.
+static void threadPoolWork(ThreadPool *threadPool) {
+    size_t numTasks = threadPool->numTasks;
+    for (;;) {
+        size_t taskIndex = atomic_fetch_add_explicit(&threadPool->nextTask, 1,
+            memory_order_relaxed);
+        if (taskIndex >= numTasks) {
+            break;
+        }
+        threadPool->task(taskIndex, threadPool->context);
+    }
+}
+
+/// @fn static void* threadPoolWorker(void *arg)
+///
+/// @brief Main function of a worker thread.
+///
+/// @return Always returns NULL.
+static void* threadPoolWorker(void *arg) {
+    ThreadPool *threadPool = (ThreadPool*) arg;
+
+    // Every worker is started before the first run, when generation is still
+    // 0.  Reading it here instead would miss a run that started before this
+    // thread first got the lock, and that run would wait for it forever.
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&threadPool->lock);
+    for (;;) {
+        while ((threadPool->generation == seen)
+            && (threadPool->shutdown == 0)
+        ) {
+            pthread_cond_wait(&threadPool->wake, &threadPool->lock);
+        }
+        if (threadPool->shutdown != 0) {
+            break;
+        }
+        seen = threadPool->generation;
+        pthread_mutex_unlock(&threadPool->lock);
+
+        threadPoolWork(threadPool);
+
+        pthread_mutex_lock(&threadPool->lock);
+        threadPool->busyWorkers--;
+        if (threadPool->busyWorkers == 0) {
+            pthread_cond_signal(&threadPool->done);
+        }
+    }
+    pthread_mutex_unlock(&threadPool->lock);
+
+    return NULL;
+}
+
+/// @fn ThreadPool* threadPoolCreate(int numThreads)
+///
+/// @brief Start a pool of threads.
+///
+/// @param numThreads The number of threads that work on each run, counting
+///   the thread that calls threadPoolRun, or 0 for one per online CPU.
+///
+/// @return Returns a pointer to the new ThreadPool on success, NULL on
+/// failure.
+ThreadPool* threadPoolCreate(int numThreads) {
+    if (numThreads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        numThreads = (online > 0) ? (int) online : 1;
+    }
+    if ((numThreads < 1) || (numThreads > MAX_THREADS)) {
+        return NULL;
+    }
+
+    ThreadPool *threadPool = (ThreadPool*) calloc(1, sizeof(ThreadPool));
+    if (threadPool == NULL) {
+        // Out of memory
+        return NULL;
+    }
+
+    int numWorkers = numThreads - 1;
+    threadPool->workers = (pthread_t*) calloc(
+        (numWorkers > 0) ? (size_t) numWorkers : 1, sizeof(pthread_t));
+    if (threadPool->workers == NULL) {
+        free(threadPool); threadPool = NULL;
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&threadPool->lock, NULL) != 0) {
+        free(threadPool->workers); threadPool->workers = NULL;
+        free(threadPool); threadPool = NULL;
+        return NULL;
+    } else if (pthread_cond_init(&threadPool->wake, NULL) != 0) {
+        pthread_mutex_destroy(&threadPool->lock);
+        free(threadPool->workers); threadPool->workers = NULL;
+        free(threadPool); threadPool = NULL;
+        return NULL;
+    } else if (pthread_cond_init(&threadPool->done, NULL) != 0) {
+        pthread_cond_destroy(&threadPool->wake);
+        pthread_mutex_destroy(&threadPool->lock);
+        free(threadPool->workers); threadPool->workers = NULL;
+        free(threadPool); threadPool = NULL;
+        return NULL;
+    } else if (pthread_mutex_init(&threadPool->runLock, NULL) != 0) {
+        pthread_cond_destroy(&threadPool->done);
+        pthread_cond_destroy(&threadPool->wake);
+        pthread_mutex_destroy(&threadPool->lock);
+        free(threadPool->workers); threadPool->workers = NULL;
+        free(threadPool); threadPool = NULL;
+        return NULL;
+    }
+    atomic_init(&threadPool->nextTask, 0);
+    // All other values are initialized to 0 by calloc
+
+    for (int ii = 0; ii < numWorkers; ii++) {
+        if (pthread_create(&threadPool->workers[ii], NULL, threadPoolWorker,
+            threadPool) != 0
+        ) {
+            // Keep the threads that did start
+            break;
+        }
+        threadPool->numWorkers++;
+    }
+
+    return threadPool;
+}
+
+/// @fn ThreadPool* threadPoolDestroy(ThreadPool *threadPool)
+///
+/// @brief Stop the threads of a pool and release it.
+///
+/// @param threadPool A pointer to the ThreadPool to destroy.  No run may be in
+///   progress.
+///
+/// @return This function always succeeds and always returns NULL.
+ThreadPool* threadPoolDestroy(ThreadPool *threadPool) {
+    if (threadPool == NULL) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&threadPool->lock);
+    threadPool->shutdown = 1;
+    pthread_cond_broadcast(&threadPool->wake);
+    pthread_mutex_unlock(&threadPool->lock);
+
+    for (int ii = 0; ii < threadPool->numWorkers; ii++) {
+        pthread_join(threadPool->workers[ii], NULL);
+    }
+
+    pthread_mutex_destroy(&threadPool->runLock);
+    pthread_cond_destroy(&threadPool->done);
+    pthread_cond_destroy(&threadPool->wake);
+    pthread_mutex_destroy(&threadPool->lock);
+    free(threadPool->workers); threadPool->workers = NULL;
+    free(threadPool); threadPool = NULL;
+
+    return NULL;
+}
+
+/// @fn int threadPoolSize(const ThreadPool *threadPool)
+///
+/// @brief Get the number of threads that work on each run of a pool.
+///
+/// @param threadPool A pointer to the ThreadPool to query.  May be NULL.
+///
+/// @return Returns the number of threads, counting the caller of
+/// threadPoolRun.  A NULL pool has just the caller.
+int threadPoolSize(const ThreadPool *threadPool) {
+    if (threadPool == NULL) {
+        return 1;
+    }
+
+    return threadPool->numWorkers + 1;
+}
+
+/// @fn int threadPoolRun(ThreadPool *threadPool, size_t numTasks,
+///   void (*task)(size_t taskIndex, void *context), void *context)
+///
+/// @brief Call task once for every index from 0 to numTasks - 1, spread across
+/// the threads of a pool, and wait for all of them to finish.
+///
+/// @param threadPool A pointer to the ThreadPool to run on, or NULL to run
+///   every task on the calling thread.
+/// @param numTasks The number of tasks.
+/// @param task The function to call for each task.
+/// @param context An arbitrary pointer passed through to task.
+///
+/// @note Tasks start roughly in index order but may run in any order and at
+/// the same time as each other.  Everything the tasks wrote is visible to the
+/// caller once this returns.  A task must not start a run on the same pool.
+///
+/// @return Returns 0 on success, -1 on failure.
+int threadPoolRun(ThreadPool *threadPool, size_t numTasks,
+    void (*task)(size_t taskIndex, void *context), void *context
+) {
+    if (task == NULL) {
+        return -1;
+    } else if ((threadPool == NULL) || (threadPool->numWorkers == 0)
+        || (numTasks <= 1)
+    ) {
+        // Not worth waking anyone up
+        for (size_t ii = 0; ii < numTasks; ii++) {
+            task(ii, context);
+        }
+        return 0;
+    }
+
+    pthread_mutex_lock(&threadPool->runLock);
+
+    pthread_mutex_lock(&threadPool->lock);
+    threadPool->task = task;
+    threadPool->context = context;
+    threadPool->numTasks = numTasks;
+    atomic_store_explicit(&threadPool->nextTask, 0, memory_order_relaxed);
+    threadPool->busyWorkers = threadPool->numWorkers;
+    threadPool->generation++;
+    pthread_cond_broadcast(&threadPool->wake);
+    pthread_mutex_unlock(&threadPool->lock);
+
+    threadPoolWork(threadPool);
+
+    pthread_mutex_lock(&threadPool->lock);
+    while (threadPool->busyWorkers > 0) {
+        pthread_cond_wait(&threadPool->done, &threadPool->lock);
+    }
+    pthread_mutex_unlock(&threadPool->lock);
+
+    pthread_mutex_unlock(&threadPool->runLock);
+
+    return 0;
+}
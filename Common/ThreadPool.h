@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            Brian Card
+/// @date              10.16.2026
+///
+/// @file              ThreadPool.h
+///
+/// @brief             Fixed pool of worker threads for data-parallel loops.
+///
+/// @copyright
+///                      Copyright (c) 2026 Brian Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                Brian Card
+///                      https://github.com/brian-card
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+// Standard C includes
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @struct ThreadPool
+///
+/// @brief A fixed set of worker threads that run the tasks of one parallel
+/// loop at a time.
+typedef struct ThreadPool ThreadPool;
+
+// ThreadPool prototypes
+ThreadPool* threadPoolCreate(int numThreads);
+ThreadPool* threadPoolDestroy(ThreadPool *threadPool);
+int threadPoolSize(const ThreadPool *threadPool);
+int threadPoolRun(ThreadPool *threadPool, size_t numTasks,
+    void (*task)(size_t taskIndex, void *context), void *context);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // THREAD_POOL_H